@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <utility>
+
+namespace ovms {
+
+/**
+ * @brief Queue with limited capacity passing elements between producer and consumer threads.
+ * Producer waits while queue is full, consumer waits while queue is empty and not closed.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) :
+        capacity(capacity) {}
+
+    /**
+     * @brief Pushes element, waiting for free space if queue is full
+     *
+     * @param depth number of elements in queue after push
+     * @param waited time spent waiting for free space
+     * @return false if queue was closed and element was not pushed
+     */
+    bool push(T&& element, size_t& depth, std::chrono::microseconds& waited) {
+        std::unique_lock<std::mutex> lock(mtx);
+        auto start = std::chrono::steady_clock::now();
+        notFull.wait(lock, [this]() { return closed || queue.size() < capacity; });
+        waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        if (closed) {
+            return false;
+        }
+        queue.push(std::move(element));
+        depth = queue.size();
+        lock.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Pops element, waiting for one if queue is empty
+     *
+     * @return std::nullopt once queue is closed and all remaining elements were popped
+     */
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mtx);
+        notEmpty.wait(lock, [this]() { return closed || !queue.empty(); });
+        if (queue.empty()) {
+            return std::nullopt;
+        }
+        T element = std::move(queue.front());
+        queue.pop();
+        lock.unlock();
+        notFull.notify_one();
+        return std::optional<T>{std::move(element)};
+    }
+
+    /**
+     * @brief Rejects further pushes and wakes up waiting threads. Elements already pushed can still be popped.
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            closed = true;
+        }
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return queue.size();
+    }
+
+private:
+    const size_t capacity;
+    bool closed = false;
+    std::mutex mtx;
+    std::queue<T> queue;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+};
+}  // namespace ovms
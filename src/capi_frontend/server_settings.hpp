@@ -36,12 +36,18 @@ struct ServerSettingsImpl {
 #ifdef MTR_ENABLED
     std::string tracePath;
 #endif
+    std::string traceExportPath;
+    uint32_t traceSampleRate = 0;
     std::optional<size_t> grpcMemoryQuota;
+    uint32_t grpcStreamMaxInFlight = 4;
     std::string grpcChannelArguments;
     uint32_t filesystemPollWaitSeconds = 1;
     uint32_t sequenceCleanerPollWaitMinutes = 5;
     uint32_t resourcesCleanerPollWaitSeconds = 1;
     std::string cacheDir;
+    std::string cloudModelCacheDir;
+    uint64_t cloudModelCacheSizeMb = 10240;
+    uint64_t pipelineTensorPoolSizeMb = 0;
     bool withPython = false;
 };
 
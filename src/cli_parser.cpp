@@ -64,6 +64,10 @@ void CLIParser::parse(int argc, char** argv) {
                 "GRPC server buffer memory quota. Default value set to 2147483648 (2GB).",
                 cxxopts::value<size_t>(),
                 "GRPC_MEMORY_QUOTA")
+            ("grpc_stream_max_in_flight",
+                "Maximum number of requests from a single ModelStreamInfer stream to a model or DAG processed concurrently. Responses are sent in the order of requests. Default: 4.",
+                cxxopts::value<uint32_t>()->default_value("4"),
+                "GRPC_STREAM_MAX_IN_FLIGHT")
             ("rest_workers",
                 "Number of worker threads in REST server - has no effect if rest_port is not set. Default value depends on number of CPUs. ",
                 cxxopts::value<uint32_t>(),
@@ -79,6 +83,12 @@ void CLIParser::parse(int argc, char** argv) {
                 "Path to the trace file",
                 cxxopts::value<std::string>(), "TRACE_PATH")
 #endif
+            ("trace_export_path",
+                "Path to the file where spans of sampled requests are exported in Chrome trace format. Enables request tracing.",
+                cxxopts::value<std::string>(), "TRACE_EXPORT_PATH")
+            ("trace_sample_rate",
+                "Trace every N-th inference request. Requests with ovms-trace header or gRPC metadata are always traced. Default: 0 (only requests with the header).",
+                cxxopts::value<uint32_t>()->default_value("0"), "TRACE_SAMPLE_RATE")
             ("grpc_channel_arguments",
                 "A comma separated list of arguments to be passed to the gRPC server. (e.g. grpc.max_connection_age_ms=2000)",
                 cxxopts::value<std::string>(), "GRPC_CHANNEL_ARGUMENTS")
@@ -98,12 +108,24 @@ void CLIParser::parse(int argc, char** argv) {
                 "Overrides model cache directory. By default cache files are saved into /opt/cache if the directory is present. When enabled, first model load will produce cache files.",
                 cxxopts::value<std::string>(),
                 "CACHE_DIR")
+            ("cloud_model_cache_dir",
+                "Enables persistent cache of model versions downloaded from cloud storage in given directory. Unchanged model versions are not downloaded again on reload or restart. Default: disabled.",
+                cxxopts::value<std::string>(),
+                "CLOUD_MODEL_CACHE_DIR")
+            ("cloud_model_cache_size_mb",
+                "Maximum size of cloud model cache in megabytes. Least recently used model versions not in use are evicted above this limit. Default: 10240.",
+                cxxopts::value<uint64_t>()->default_value("10240"),
+                "CLOUD_MODEL_CACHE_SIZE_MB")
+            ("pipeline_tensor_pool_size_mb",
+                "Maximum size in megabytes of idle buffers kept by each DAG pipeline for reuse by intermediate tensors of following requests. Default: 0 (disabled).",
+                cxxopts::value<uint64_t>()->default_value("0"),
+                "PIPELINE_TENSOR_POOL_SIZE_MB")
             ("metrics_enable",
                 "Flag enabling metrics endpoint on rest_port.",
                 cxxopts::value<bool>()->default_value("false"),
                 "METRICS")
             ("metrics_list",
-                "Comma separated list of metrics. If unset, only default metrics will be enabled. Default metrics: ovms_requests_success, ovms_requests_fail, ovms_request_time_us, ovms_streams, ovms_inference_time_us, ovms_wait_for_infer_req_time_us. When set, only the listed metrics will be enabled. Optional metrics: ovms_infer_req_queue_size, ovms_infer_req_active.",
+                "Comma separated list of metrics. If unset, only default metrics will be enabled. Default metrics: ovms_requests_success, ovms_requests_fail, ovms_request_time_us, ovms_streams, ovms_inference_time_us, ovms_wait_for_infer_req_time_us. When set, only the listed metrics will be enabled. Optional metrics: ovms_infer_req_queue_size, ovms_infer_req_active, ovms_infer_req_waiting, ovms_infer_req_utilization, ovms_compile_time_us, ovms_shape_cache_hits, ovms_shape_cache_misses, ovms_pipeline_bytes_copied, ovms_pipeline_tensor_pool_hits, ovms_pipeline_tensor_pool_misses, ovms_pipeline_tensor_pool_held_bytes, ovms_request_stage_time_us, ovms_pipeline_node_time_us, ovms_stream_queue_depth, ovms_stream_backpressure_time_us.",
                 cxxopts::value<std::string>()->default_value(""),
                 "METRICS_LIST")
             ("cpu_extension",
@@ -233,6 +255,8 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
     if (result->count("grpc_memory_quota"))
         serverSettings->grpcMemoryQuota = result->operator[]("grpc_memory_quota").as<size_t>();
 
+    serverSettings->grpcStreamMaxInFlight = result->operator[]("grpc_stream_max_in_flight").as<uint32_t>();
+
     if (result->count("rest_workers"))
         serverSettings->restWorkers = result->operator[]("rest_workers").as<uint32_t>();
 
@@ -281,6 +305,9 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
     if (result->count("trace_path"))
         serverSettings->tracePath = result->operator[]("trace_path").as<std::string>();
 #endif
+    if (result->count("trace_export_path"))
+        serverSettings->traceExportPath = result->operator[]("trace_export_path").as<std::string>();
+    serverSettings->traceSampleRate = result->operator[]("trace_sample_rate").as<uint32_t>();
 
     if (result->count("grpc_channel_arguments"))
         serverSettings->grpcChannelArguments = result->operator[]("grpc_channel_arguments").as<std::string>();
@@ -293,6 +320,12 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
         serverSettings->cacheDir = result->operator[]("cache_dir").as<std::string>();
     }
 
+    if (result->count("cloud_model_cache_dir")) {
+        serverSettings->cloudModelCacheDir = result->operator[]("cloud_model_cache_dir").as<std::string>();
+    }
+    serverSettings->cloudModelCacheSizeMb = result->operator[]("cloud_model_cache_size_mb").as<uint64_t>();
+    serverSettings->pipelineTensorPoolSizeMb = result->operator[]("pipeline_tensor_pool_size_mb").as<uint64_t>();
+
     if (result->count("config_path"))
         modelsSettings->configPath = result->operator[]("config_path").as<std::string>();
 }
@@ -0,0 +1,345 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "cloudmodelcache.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <system_error>
+#include <utility>
+
+#include "filesystem.hpp"
+#include "logging.hpp"
+#include "metric.hpp"
+#include "metric_config.hpp"
+#include "metric_family.hpp"
+#include "metric_registry.hpp"
+#include "stringutils.hpp"
+
+namespace ovms {
+
+namespace fs = std::filesystem;
+
+static const std::string INCOMPLETE_ENTRY_SUFFIX = ".incomplete";
+
+CloudModelCache::CloudModelCache() = default;
+CloudModelCache::~CloudModelCache() = default;
+
+static std::unique_ptr<MetricCounter> createCounter(MetricRegistry& registry, const MetricConfig& metricConfig, const std::string& familyName, const std::string& description) {
+    if (!metricConfig.isFamilyEnabled(familyName)) {
+        return nullptr;
+    }
+    auto family = registry.createFamily<MetricCounter>(familyName, description);
+    if (!family) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Cannot create metric family: {}", familyName);
+        return nullptr;
+    }
+    return family->addMetric();
+}
+
+void CloudModelCache::registerMetrics(MetricRegistry* registry, const MetricConfig* metricConfig) {
+    std::unique_lock lock(mtx);
+    this->metricsRegistry = nullptr;
+    hitsCounter.reset();
+    missesCounter.reset();
+    bytesSavedCounter.reset();
+    if (!registry || !metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+    this->metricsRegistry = registry;
+    hitsCounter = createCounter(*registry, *metricConfig, METRIC_NAME_CLOUD_MODEL_CACHE_HITS,
+        "Number of model versions loaded from the cloud model cache without downloading.");
+    missesCounter = createCounter(*registry, *metricConfig, METRIC_NAME_CLOUD_MODEL_CACHE_MISSES,
+        "Number of model versions downloaded into the cloud model cache.");
+    bytesSavedCounter = createCounter(*registry, *metricConfig, METRIC_NAME_CLOUD_MODEL_CACHE_BYTES_SAVED,
+        "Number of bytes of model versions not downloaded thanks to the cloud model cache.");
+}
+
+void CloudModelCache::unregisterMetrics(const MetricRegistry* registry) {
+    std::unique_lock lock(mtx);
+    if (this->metricsRegistry != registry) {
+        return;
+    }
+    this->metricsRegistry = nullptr;
+    hitsCounter.reset();
+    missesCounter.reset();
+    bytesSavedCounter.reset();
+}
+
+StatusCode CloudModelCache::configure(const std::string& directory, uint64_t maxSizeBytes) {
+    std::unique_lock lock(mtx);
+    this->entries.clear();
+    this->lru.clear();
+    this->currentSizeBytes = 0;
+    this->directory.clear();
+    this->maxSizeBytes = maxSizeBytes;
+    if (directory.empty()) {
+        return StatusCode::OK;
+    }
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create cloud model cache directory: {} {}", directory, ec.message());
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    // model version directories are absolute symlinks to cache entries
+    this->directory = fs::canonical(directory, ec).string();
+    if (ec) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to resolve cloud model cache directory: {} {}", directory, ec.message());
+        this->directory.clear();
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    indexExistingEntries();
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Cloud model cache is enabled: {}; entries: {}; size: {} of {} bytes",
+        this->directory, entries.size(), currentSizeBytes, maxSizeBytes);
+    evictIfNeeded("");
+    return StatusCode::OK;
+}
+
+bool CloudModelCache::isEnabled() const {
+    return !getDirectory().empty();
+}
+
+std::string CloudModelCache::getDirectory() const {
+    std::unique_lock lock(mtx);
+    return directory;
+}
+
+uint64_t CloudModelCache::getCurrentSizeBytes() const {
+    std::unique_lock lock(mtx);
+    return currentSizeBytes;
+}
+
+uint32_t CloudModelCache::getUsers(const std::string& key) const {
+    std::unique_lock lock(mtx);
+    auto it = entries.find(key);
+    return it == entries.end() ? 0 : it->second.users;
+}
+
+std::string CloudModelCache::createKey(const std::string& remotePath, const std::string& fingerprint) {
+    std::string md5 = FileSystem::getStringMD5(remotePath + "\n" + fingerprint);
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (unsigned char c : md5) {
+        ss << std::setw(2) << static_cast<unsigned int>(c);
+    }
+    return ss.str();
+}
+
+std::string CloudModelCache::getEntryPath(const std::string& key) const {
+    return FileSystem::joinPath({directory, key});
+}
+
+uint64_t CloudModelCache::getDirectorySize(const std::string& path) {
+    uint64_t size = 0;
+    std::error_code ec;
+    for (const auto& entry : fs::recursive_directory_iterator(path, ec)) {
+        if (entry.is_regular_file(ec)) {
+            size += entry.file_size(ec);
+        }
+    }
+    return size;
+}
+
+void CloudModelCache::indexExistingEntries() {
+    std::vector<std::pair<fs::file_time_type, std::string>> existing;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        if (!entry.is_directory(ec)) {
+            continue;
+        }
+        const std::string name = entry.path().filename().string();
+        if (endsWith(name, INCOMPLETE_ENTRY_SUFFIX)) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Removing incomplete cloud model cache entry: {}", entry.path().string());
+            fs::remove_all(entry.path(), ec);
+            continue;
+        }
+        existing.emplace_back(fs::last_write_time(entry.path(), ec), name);
+    }
+    std::sort(existing.begin(), existing.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    for (const auto& [time, key] : existing) {
+        lru.push_back(key);
+        Entry entry;
+        entry.sizeBytes = getDirectorySize(getEntryPath(key));
+        entry.lruIt = std::prev(lru.end());
+        currentSizeBytes += entry.sizeBytes;
+        entries.emplace(key, entry);
+    }
+}
+
+void CloudModelCache::evictIfNeeded(const std::string& keyToKeep) {
+    auto it = lru.end();
+    while (currentSizeBytes > maxSizeBytes && it != lru.begin()) {
+        --it;
+        const std::string key = *it;
+        auto& entry = entries.at(key);
+        if (entry.users > 0 || key == keyToKeep) {
+            continue;
+        }
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Evicting cloud model cache entry: {}; size: {} bytes", key, entry.sizeBytes);
+        std::error_code ec;
+        fs::remove_all(getEntryPath(key), ec);
+        if (ec) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Failed to remove cloud model cache entry: {} {}", key, ec.message());
+        }
+        currentSizeBytes -= entry.sizeBytes;
+        entries.erase(key);
+        it = lru.erase(it);
+    }
+    if (currentSizeBytes > maxSizeBytes) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Cloud model cache size: {} bytes exceeds limit: {} bytes since all entries are in use", currentSizeBytes, maxSizeBytes);
+    }
+}
+
+StatusCode CloudModelCache::acquire(const std::string& key, const download_function_t& download, std::string* entryPath) {
+    std::unique_lock lock(mtx);
+    // Concurrent requests for the same entry wait for the first download instead of repeating it
+    inFlightFinished.wait(lock, [this, &key]() { return inFlight.count(key) == 0; });
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        auto& entry = it->second;
+        lru.splice(lru.begin(), lru, entry.lruIt);
+        entry.users++;
+        hits++;
+        bytesSaved += entry.sizeBytes;
+        INCREMENT_IF_ENABLED(hitsCounter);
+        if (bytesSavedCounter) {
+            bytesSavedCounter->increment(entry.sizeBytes);
+        }
+        *entryPath = getEntryPath(key);
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Cloud model cache hit: {}; saved download of: {} bytes", *entryPath, entry.sizeBytes);
+        return StatusCode::OK;
+    }
+    misses++;
+    INCREMENT_IF_ENABLED(missesCounter);
+    inFlight.insert(key);
+    const std::string path = getEntryPath(key);
+    lock.unlock();
+
+    auto status = downloadEntry(path, download);
+    uint64_t sizeBytes = status == StatusCode::OK ? getDirectorySize(path) : 0;
+
+    lock.lock();
+    inFlight.erase(key);
+    inFlightFinished.notify_all();
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    lru.push_front(key);
+    Entry entry;
+    entry.sizeBytes = sizeBytes;
+    entry.users = 1;
+    entry.lruIt = lru.begin();
+    currentSizeBytes += entry.sizeBytes;
+    entries.emplace(key, entry);
+    *entryPath = path;
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Cloud model cache miss: {}; downloaded: {} bytes", *entryPath, entry.sizeBytes);
+    evictIfNeeded(key);
+    return StatusCode::OK;
+}
+
+StatusCode CloudModelCache::downloadEntry(const std::string& entryPath, const download_function_t& download) {
+    // Download into temporary entry first so interrupted downloads are never treated as complete
+    const std::string incompletePath = entryPath + INCOMPLETE_ENTRY_SUFFIX;
+    std::error_code ec;
+    fs::remove_all(incompletePath, ec);
+    fs::create_directories(incompletePath, ec);
+    if (ec) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create cloud model cache entry: {} {}", incompletePath, ec.message());
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    auto status = download(incompletePath);
+    if (status != StatusCode::OK) {
+        fs::remove_all(incompletePath, ec);
+        return status;
+    }
+    fs::rename(incompletePath, entryPath, ec);
+    if (ec) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to commit cloud model cache entry: {} {}", entryPath, ec.message());
+        fs::remove_all(incompletePath, ec);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+void CloudModelCache::release(const std::string& versionPath) {
+    std::error_code ec;
+    if (!fs::is_symlink(versionPath, ec)) {
+        return;
+    }
+    fs::path target = fs::read_symlink(versionPath, ec);
+    if (ec) {
+        return;
+    }
+    if (target.parent_path() != fs::path(getDirectory())) {
+        return;
+    }
+    releaseEntry(target.filename().string());
+}
+
+void CloudModelCache::releaseEntry(const std::string& key) {
+    std::unique_lock lock(mtx);
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second.users == 0) {
+        return;
+    }
+    it->second.users--;
+    evictIfNeeded("");
+}
+
+StatusCode CloudModelCache::downloadModelVersions(FileSystem& remoteFs, const std::string& path, std::string* localPath, const std::vector<model_version_t>& versions) {
+    auto sc = FileSystem::createTempPath(localPath);
+    if (sc != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create a temporary path {}", Status(sc).string());
+        return sc;
+    }
+    StatusCode result = StatusCode::OK;
+    for (auto& ver : versions) {
+        const std::string versionPath = FileSystem::joinPath({path, std::to_string(ver)});
+        const std::string localVersionPath = FileSystem::joinPath({*localPath, std::to_string(ver)});
+        std::string fingerprint;
+        auto status = remoteFs.getDirectoryFingerprint(versionPath, &fingerprint);
+        if (status != StatusCode::OK) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Cannot fingerprint {}, downloading without cloud model cache", versionPath);
+            fs::create_directory(localVersionPath);
+            status = remoteFs.downloadFileFolder(versionPath, localVersionPath);
+        } else {
+            const std::string key = createKey(versionPath, fingerprint);
+            std::string entryPath;
+            status = acquire(
+                key,
+                [&remoteFs, &versionPath](const std::string& destination) { return remoteFs.downloadFileFolder(versionPath, destination); },
+                &entryPath);
+            if (status == StatusCode::OK) {
+                std::error_code ec;
+                fs::create_directory_symlink(entryPath, localVersionPath, ec);
+                if (ec) {
+                    SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to link cloud model cache entry: {} to {} {}", entryPath, localVersionPath, ec.message());
+                    releaseEntry(key);
+                    status = StatusCode::FILESYSTEM_ERROR;
+                }
+            }
+        }
+        if (status != StatusCode::OK) {
+            result = status;
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to download model version {}", versionPath);
+        }
+    }
+    return result;
+}
+
+}  // namespace ovms
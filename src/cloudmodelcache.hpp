@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "modelversion.hpp"
+#include "status.hpp"
+
+namespace ovms {
+class FileSystem;
+class MetricConfig;
+class MetricCounter;
+class MetricRegistry;
+
+/**
+ * @brief Persistent, content addressed cache of model versions downloaded from cloud storage.
+ *
+ * Entries are keyed by remote path and fingerprint of remote objects (ETags/generations) so unchanged
+ * versions are not downloaded again on reload or server restart. Total size of entries is bounded,
+ * least recently used entries which are not used by any loaded model version are evicted first.
+ */
+class CloudModelCache {
+public:
+    using download_function_t = std::function<StatusCode(const std::string& localPath)>;
+
+    CloudModelCache();
+    CloudModelCache(const CloudModelCache&) = delete;
+    ~CloudModelCache();
+
+    static CloudModelCache& instance() {
+        static CloudModelCache instance;
+        return instance;
+    }
+
+    /**
+     * @brief Enables the cache in given directory. Entries left from previous runs are indexed.
+     *
+     * @param directory cache root, empty value disables the cache
+     * @param maxSizeBytes upper bound on cumulative size of cached entries
+     * @return StatusCode
+     */
+    StatusCode configure(const std::string& directory, uint64_t maxSizeBytes);
+
+    bool isEnabled() const;
+    std::string getDirectory() const;
+
+    /**
+     * @brief Makes requested model versions available in a fresh temporary directory.
+     * Version directories are symlinks to cache entries. If filesystem does not support fingerprinting
+     * version is downloaded directly into temporary directory.
+     *
+     * @param remoteFs
+     * @param path remote model base path
+     * @param localPath created temporary directory
+     * @param versions
+     * @return StatusCode
+     */
+    StatusCode downloadModelVersions(FileSystem& remoteFs, const std::string& path, std::string* localPath, const std::vector<model_version_t>& versions);
+
+    /**
+     * @brief Returns entry matching the key, downloading it when missing. Entry is marked as used until released.
+     *
+     * @param key
+     * @param download function filling the directory passed as argument
+     * @param entryPath
+     * @return StatusCode
+     */
+    StatusCode acquire(const std::string& key, const download_function_t& download, std::string* entryPath);
+
+    /**
+     * @brief Releases entry linked from given model version path. Path not pointing to the cache is ignored.
+     *
+     * @param versionPath
+     */
+    void release(const std::string& versionPath);
+
+    /**
+     * @brief Reports hits, misses and bytes saved with counters of enabled metric families in given registry.
+     *
+     * @param registry
+     * @param metricConfig
+     */
+    void registerMetrics(MetricRegistry* registry, const MetricConfig* metricConfig);
+
+    /**
+     * @brief Stops reporting metrics to given registry, if it is the one registered.
+     *
+     * @param registry
+     */
+    void unregisterMetrics(const MetricRegistry* registry);
+
+    static std::string createKey(const std::string& remotePath, const std::string& fingerprint);
+
+    uint64_t getHits() const { return hits; }
+    uint64_t getMisses() const { return misses; }
+    uint64_t getBytesSaved() const { return bytesSaved; }
+    uint64_t getCurrentSizeBytes() const;
+    // Number of model versions using the entry, 0 for missing entries
+    uint32_t getUsers(const std::string& key) const;
+
+private:
+    struct Entry {
+        uint64_t sizeBytes = 0;
+        uint32_t users = 0;
+        std::list<std::string>::iterator lruIt;
+    };
+
+    void releaseEntry(const std::string& key);
+    StatusCode downloadEntry(const std::string& entryPath, const download_function_t& download);
+    void indexExistingEntries();
+    void evictIfNeeded(const std::string& keyToKeep);
+    std::string getEntryPath(const std::string& key) const;
+    static uint64_t getDirectorySize(const std::string& path);
+
+    mutable std::mutex mtx;
+    std::string directory;
+    uint64_t maxSizeBytes = 0;
+    uint64_t currentSizeBytes = 0;
+    std::unordered_map<std::string, Entry> entries;
+    // most recently used entries are at the front
+    std::list<std::string> lru;
+    // keys being downloaded, mtx is not held during download so other entries can be served meanwhile
+    std::unordered_set<std::string> inFlight;
+    std::condition_variable inFlightFinished;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> bytesSaved{0};
+
+    const MetricRegistry* metricsRegistry = nullptr;
+    std::unique_ptr<MetricCounter> hitsCounter;
+    std::unique_ptr<MetricCounter> missesCounter;
+    std::unique_ptr<MetricCounter> bytesSavedCounter;
+};
+
+}  // namespace ovms
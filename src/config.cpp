@@ -101,6 +101,11 @@ bool Config::validate() {
         return false;
     }
 
+    if (grpcStreamMaxInFlight() < 1) {
+        std::cerr << "grpc_stream_max_in_flight should be greater than 0" << std::endl;
+        return false;
+    }
+
     // check rest_workers value
     if (((restWorkers() > MAX_REST_WORKERS) || (restWorkers() < 2))) {
         std::cerr << "rest_workers count should be from 2 to " << MAX_REST_WORKERS << std::endl;
@@ -134,6 +139,12 @@ bool Config::validate() {
         return false;
     }
 
+    // trace_sample_rate without trace_export_path
+    if (traceSampleRate() > 0 && traceExportPath().empty()) {
+        std::cerr << "trace_export_path setting is missing, required when trace_sample_rate is provided" << std::endl;
+        return false;
+    }
+
     // check bind addresses:
     if (!restBindAddress().empty() && check_hostname_or_ip(restBindAddress()) == false) {
         std::cerr << "rest_bind_address has invalid format: proper hostname or IP address expected." << std::endl;
@@ -179,6 +190,7 @@ const std::string Config::restBindAddress() const { return this->serverSettings.
 uint32_t Config::grpcWorkers() const { return this->serverSettings.grpcWorkers; }
 uint32_t Config::grpcMaxThreads() const { return this->serverSettings.grpcMaxThreads.value_or(DEFAULT_GRPC_MAX_THREADS); }
 size_t Config::grpcMemoryQuota() const { return this->serverSettings.grpcMemoryQuota.value_or(DEFAULT_GRPC_MEMORY_QUOTA); }
+uint32_t Config::grpcStreamMaxInFlight() const { return this->serverSettings.grpcStreamMaxInFlight; }
 uint32_t Config::restWorkers() const { return this->serverSettings.restWorkers.value_or(DEFAULT_REST_WORKERS); }
 const std::string& Config::modelName() const { return this->modelsSettings.modelName; }
 const std::string& Config::modelPath() const { return this->modelsSettings.modelPath; }
@@ -206,10 +218,15 @@ const std::string& Config::logPath() const { return this->serverSettings.logPath
 #ifdef MTR_ENABLED
 const std::string& Config::tracePath() const { return this->serverSettings.tracePath; }
 #endif
+const std::string& Config::traceExportPath() const { return this->serverSettings.traceExportPath; }
+uint32_t Config::traceSampleRate() const { return this->serverSettings.traceSampleRate; }
 const std::string& Config::grpcChannelArguments() const { return this->serverSettings.grpcChannelArguments; }
 uint32_t Config::filesystemPollWaitSeconds() const { return this->serverSettings.filesystemPollWaitSeconds; }
 uint32_t Config::sequenceCleanerPollWaitMinutes() const { return this->serverSettings.sequenceCleanerPollWaitMinutes; }
 uint32_t Config::resourcesCleanerPollWaitSeconds() const { return this->serverSettings.resourcesCleanerPollWaitSeconds; }
 const std::string Config::cacheDir() const { return this->serverSettings.cacheDir; }
+const std::string& Config::cloudModelCacheDir() const { return this->serverSettings.cloudModelCacheDir; }
+uint64_t Config::cloudModelCacheSizeMb() const { return this->serverSettings.cloudModelCacheSizeMb; }
+uint64_t Config::pipelineTensorPoolSizeMb() const { return this->serverSettings.pipelineTensorPoolSizeMb; }
 
 }  // namespace ovms
@@ -146,6 +146,13 @@ public:
          */
     size_t grpcMemoryQuota() const;
 
+    /**
+         * @brief Gets the maximum number of concurrently processed requests of a single gRPC stream to a model or DAG
+         * 
+         * @return uint
+         */
+    uint32_t grpcStreamMaxInFlight() const;
+
     /**
          * @brief Gets the rest workers count
          * 
@@ -281,6 +288,20 @@ public:
     const std::string& tracePath() const;
 #endif
 
+    /**
+     * @brief Get the path of request tracing export file
+     *
+     * @return const std::string&
+     */
+    const std::string& traceExportPath() const;
+
+    /**
+     * @brief Get the request tracing sample rate
+     *
+     * @return uint32_t
+     */
+    uint32_t traceSampleRate() const;
+
     /**
         * @brief Get the plugin config
         *
@@ -315,5 +336,26 @@ public:
          * @return const std::string& 
          */
     const std::string cacheDir() const;
+
+    /**
+     * @brief Get the cloud model cache directory
+     *
+     * @return const std::string&
+     */
+    const std::string& cloudModelCacheDir() const;
+
+    /**
+     * @brief Get the cloud model cache size limit in megabytes
+     *
+     * @return uint64_t
+     */
+    uint64_t cloudModelCacheSizeMb() const;
+
+    /**
+     * @brief Get the size limit of idle buffers kept by each pipeline tensor pool in megabytes
+     *
+     * @return uint64_t
+     */
+    uint64_t pipelineTensorPoolSizeMb() const;
 };
 }  // namespace ovms
@@ -0,0 +1,316 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "continuous_batching_scheduler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <utility>
+
+#include "logging.hpp"
+#include "profiler.hpp"
+#include "sequence.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+struct ContinuousBatchingScheduler::Step {
+    Step(ov::InferRequest& request, Sequence& sequence, bool sequenceStart, bool sequenceEnd) :
+        request(request),
+        sequence(sequence),
+        sequenceStart(sequenceStart),
+        sequenceEnd(sequenceEnd) {}
+
+    ov::InferRequest& request;
+    Sequence& sequence;
+    const bool sequenceStart;
+    const bool sequenceEnd;
+    // Ordered as compiled model inputs
+    std::vector<ov::Tensor> inputs;
+    // Ordered as scheduler state names, empty on sequence start
+    std::vector<ov::Tensor> states;
+    std::promise<Status> done;
+};
+
+namespace {
+bool hasDynamicBatch(const ov::PartialShape& shape) {
+    return shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0].is_dynamic();
+}
+
+bool isBatchable(const ov::Tensor& tensor) {
+    return tensor.get_shape().size() > 0 &&
+           tensor.get_shape()[0] == 1 &&
+           tensor.get_element_type() != ov::element::string &&
+           tensor.get_element_type().bitwidth() >= 8;
+}
+
+// Tensors can be concatenated if they differ only in the first dimension
+bool haveSameRowShape(const ov::Tensor& first, const ov::Tensor& second) {
+    if (first.get_element_type() != second.get_element_type())
+        return false;
+    const auto& firstShape = first.get_shape();
+    const auto& secondShape = second.get_shape();
+    return firstShape.size() == secondShape.size() &&
+           std::equal(firstShape.begin() + 1, firstShape.end(), secondShape.begin() + 1);
+}
+
+// Batched tensor is reused between iterations, its memory is reallocated only when larger batch is needed
+void concatenateRows(const std::vector<const ov::Tensor*>& rows, ov::Tensor& batched) {
+    ov::Shape shape = rows.front()->get_shape();
+    shape[0] = rows.size();
+    if (!batched || batched.get_element_type() != rows.front()->get_element_type()) {
+        batched = ov::Tensor(rows.front()->get_element_type(), shape);
+    } else {
+        batched.set_shape(shape);
+    }
+    char* destination = static_cast<char*>(batched.data());
+    for (const ov::Tensor* row : rows) {
+        std::memcpy(destination, row->data(), row->get_byte_size());
+        destination += row->get_byte_size();
+    }
+}
+
+// Copies row into existing tensor, which is reshaped if needed
+void copyRow(const ov::Tensor& batched, size_t row, ov::Tensor& destination) {
+    ov::Shape shape = batched.get_shape();
+    const size_t rowByteSize = batched.get_byte_size() / shape[0];
+    shape[0] = 1;
+    if (destination.get_shape() != shape) {
+        destination.set_shape(shape);
+    }
+    std::memcpy(destination.data(), static_cast<const char*>(batched.data()) + row * rowByteSize, rowByteSize);
+}
+
+ov::Tensor extractRow(const ov::Tensor& batched, size_t row) {
+    ov::Shape shape = batched.get_shape();
+    shape[0] = 1;
+    ov::Tensor tensor(batched.get_element_type(), shape);
+    copyRow(batched, row, tensor);
+    return tensor;
+}
+}  // namespace
+
+ContinuousBatchingScheduler::ContinuousBatchingScheduler(const std::string& modelName, model_version_t modelVersion, const ov::CompiledModel& compiledModel) :
+    modelName(modelName),
+    modelVersion(modelVersion),
+    compiledModel(compiledModel) {
+    OV_LOGGER("ov::CompiledModel: {} compiledModel.create_infer_request()", reinterpret_cast<const void*>(&compiledModel));
+    this->batchedRequest = this->compiledModel.create_infer_request();
+    for (auto& state : this->batchedRequest.query_state()) {
+        this->stateNames.emplace_back(state.get_name());
+    }
+    this->batchedInputs.resize(this->compiledModel.inputs().size());
+    this->batchedStates.resize(this->stateNames.size());
+    this->worker = std::thread([this]() { run(); });
+}
+
+ContinuousBatchingScheduler::~ContinuousBatchingScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->stopped = true;
+    }
+    this->cv.notify_all();
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+}
+
+Status ContinuousBatchingScheduler::validateModel(const std::string& modelName, model_version_t modelVersion, const ov::CompiledModel& compiledModel) {
+    for (const auto& input : compiledModel.inputs()) {
+        if (!hasDynamicBatch(input.get_partial_shape())) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Continuous batching requires dynamic first dimension of all inputs and outputs; model: {} version: {} input: {} shape: {}",
+                modelName, modelVersion, input.get_any_name(), input.get_partial_shape().to_string());
+            return Status(StatusCode::INVALID_BATCH_DIMENSION, "continuous batching requires dynamic first dimension of input " + input.get_any_name());
+        }
+    }
+    for (const auto& output : compiledModel.outputs()) {
+        if (!hasDynamicBatch(output.get_partial_shape())) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Continuous batching requires dynamic first dimension of all inputs and outputs; model: {} version: {} output: {} shape: {}",
+                modelName, modelVersion, output.get_any_name(), output.get_partial_shape().to_string());
+            return Status(StatusCode::INVALID_BATCH_DIMENSION, "continuous batching requires dynamic first dimension of output " + output.get_any_name());
+        }
+    }
+    return StatusCode::OK;
+}
+
+Status ContinuousBatchingScheduler::schedule(ov::InferRequest& stepRequest, Sequence& sequence, bool sequenceStart, bool sequenceEnd) {
+    OVMS_PROFILE_FUNCTION();
+    auto step = std::make_shared<Step>(stepRequest, sequence, sequenceStart, sequenceEnd);
+    try {
+        for (const auto& input : this->compiledModel.inputs()) {
+            step->inputs.emplace_back(stepRequest.get_tensor(input));
+            if (!isBatchable(step->inputs.back())) {
+                SPDLOG_DEBUG("[Model: {} version: {}] Continuous batching requires batch size 1 and fixed width precision of input: {}; shape: {}",
+                    this->modelName, this->modelVersion, input.get_any_name(), step->inputs.back().get_shape().to_string());
+                return Status(StatusCode::INVALID_BATCH_SIZE, "continuous batching requires batch size 1 of input " + input.get_any_name());
+            }
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("[Model: {} version: {}] Failed to get step input tensors: {}", this->modelName, this->modelVersion, e.what());
+        return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+    }
+    if (!sequenceStart) {
+        const sequence_memory_state_t& memoryState = sequence.getMemoryState();
+        for (const auto& stateName : this->stateNames) {
+            auto it = memoryState.find(stateName);
+            if (it == memoryState.end() || !isBatchable(it->second)) {
+                SPDLOG_DEBUG("[Model: {} version: {}] Sequence: {} memory state: {} is missing or cannot be batched", this->modelName, this->modelVersion, sequence.getId(), stateName);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            step->states.emplace_back(it->second);
+        }
+    }
+    auto done = step->done.get_future();
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->pending.emplace_back(std::move(step));
+    }
+    this->cv.notify_one();
+    return done.get();
+}
+
+bool ContinuousBatchingScheduler::canBatchTogether(const Step& first, const Step& second) const {
+    // Sequence starts are batched separately, since default memory state is set by resetting whole batch
+    if (first.sequenceStart != second.sequenceStart)
+        return false;
+    for (size_t i = 0; i < first.inputs.size(); ++i) {
+        if (!haveSameRowShape(first.inputs[i], second.inputs[i]))
+            return false;
+    }
+    for (size_t i = 0; i < first.states.size(); ++i) {
+        if (!haveSameRowShape(first.states[i], second.states[i]))
+            return false;
+    }
+    return true;
+}
+
+void ContinuousBatchingScheduler::run() {
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Started continuous batching scheduler for model: {} version: {}", this->modelName, this->modelVersion);
+    while (true) {
+        std::vector<std::vector<std::shared_ptr<Step>>> buckets;
+        {
+            std::unique_lock<std::mutex> lock(this->mtx);
+            this->cv.wait(lock, [this]() { return this->stopped || !this->pending.empty(); });
+            if (this->pending.empty())
+                break;
+            // All pending steps are served in this round. Steps which cannot be batched together, e.g. sequences
+            // with different memory state length, are split into buckets executed one after another, oldest first.
+            for (auto& step : this->pending) {
+                auto bucket = std::find_if(buckets.begin(), buckets.end(), [this, &step](const std::vector<std::shared_ptr<Step>>& candidates) {
+                    return canBatchTogether(*candidates.front(), *step);
+                });
+                if (bucket == buckets.end()) {
+                    bucket = buckets.emplace(buckets.end());
+                }
+                bucket->emplace_back(std::move(step));
+            }
+            this->pending.clear();
+        }
+        for (auto& steps : buckets) {
+            Status status = executeIteration(steps);
+            for (auto& step : steps) {
+                step->done.set_value(status);
+            }
+        }
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Stopped continuous batching scheduler for model: {} version: {}", this->modelName, this->modelVersion);
+}
+
+Status ContinuousBatchingScheduler::executeIteration(const std::vector<std::shared_ptr<Step>>& steps) {
+    OVMS_PROFILE_FUNCTION();
+    const size_t batchSize = steps.size();
+    SPDLOG_DEBUG("[Model: {} version: {}] Continuous batching iteration with batch size: {}", this->modelName, this->modelVersion, batchSize);
+    try {
+        std::vector<const ov::Tensor*> rows(batchSize);
+        const auto inputs = this->compiledModel.inputs();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            for (size_t row = 0; row < batchSize; ++row) {
+                rows[row] = &steps[row]->inputs[i];
+            }
+            concatenateRows(rows, this->batchedInputs[i]);
+            this->batchedRequest.set_tensor(inputs[i], this->batchedInputs[i]);
+        }
+        auto states = this->batchedRequest.query_state();
+        for (size_t i = 0; i < states.size(); ++i) {
+            if (steps.front()->sequenceStart) {
+                states[i].reset();
+                continue;
+            }
+            for (size_t row = 0; row < batchSize; ++row) {
+                rows[row] = &steps[row]->states[i];
+            }
+            // State content is copied by set_state, so the staging tensor can be reused
+            concatenateRows(rows, this->batchedStates[i]);
+            states[i].set_state(this->batchedStates[i]);
+        }
+
+        OVMS_PROFILE_SYNC_BEGIN("ov::InferRequest::infer");
+        this->batchedRequest.infer();
+        OVMS_PROFILE_SYNC_END("ov::InferRequest::infer");
+
+        for (const auto& output : this->compiledModel.outputs()) {
+            ov::Tensor batched = this->batchedRequest.get_tensor(output);
+            if (batched.get_shape().size() == 0 || batched.get_shape()[0] != batchSize) {
+                SPDLOG_DEBUG("[Model: {} version: {}] Output: {} shape: {} does not match batch size: {}", this->modelName, this->modelVersion, output.get_any_name(), batched.get_shape().to_string(), batchSize);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            // Rows are copied into output tensors owned by step requests, which are returned to the pool afterwards
+            for (size_t row = 0; row < batchSize; ++row) {
+                ov::Tensor destination = steps[row]->request.get_tensor(output);
+                copyRow(batched, row, destination);
+            }
+        }
+        // All states are validated before sequences are updated, so failed iteration leaves them unchanged
+        std::vector<ov::Tensor> batchedNewStates;
+        for (size_t i = 0; i < states.size(); ++i) {
+            batchedNewStates.emplace_back(states[i].get_state());
+            const ov::Tensor& batched = batchedNewStates.back();
+            if (batched.get_shape().size() == 0 || batched.get_shape()[0] != batchSize) {
+                SPDLOG_DEBUG("[Model: {} version: {}] Memory state: {} shape: {} does not match batch size: {}", this->modelName, this->modelVersion, this->stateNames[i], batched.get_shape().to_string(), batchSize);
+                return StatusCode::INTERNAL_ERROR;
+            }
+        }
+        for (size_t row = 0; row < batchSize; ++row) {
+            if (steps[row]->sequenceEnd) {
+                continue;
+            }
+            sequence_memory_state_t newState;
+            for (size_t i = 0; i < batchedNewStates.size(); ++i) {
+                const ov::Tensor& batched = batchedNewStates[i];
+                ov::Shape rowShape = batched.get_shape();
+                rowShape[0] = 1;
+                // Memory of previous state of the sequence is reused when its shape does not change
+                if (!steps[row]->sequenceStart && steps[row]->states[i].get_shape() == rowShape) {
+                    copyRow(batched, row, steps[row]->states[i]);
+                    newState[this->stateNames[i]] = steps[row]->states[i];
+                } else {
+                    newState[this->stateNames[i]] = extractRow(batched, row);
+                }
+            }
+            steps[row]->sequence.updateMemoryState(std::move(newState));
+        }
+    } catch (const ov::Exception& e) {
+        Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Continuous batching iteration caught an exception {}: {}", status.string(), e.what());
+        return status;
+    }
+    this->iterations++;
+    size_t currentMax = this->maxBatchSize.load();
+    while (currentMax < batchSize && !this->maxBatchSize.compare_exchange_weak(currentMax, batchSize)) {
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "modelversion.hpp"
+
+namespace ovms {
+class Sequence;
+class Status;
+
+/**
+ * @brief Combines steps of many sequences of stateful model into one batched inference.
+ *
+ * Each request still gets its own infer request used to deserialize inputs and serialize outputs.
+ * Instead of running inference on it, the step is queued and worker thread takes all pending steps
+ * in each round. Steps are batched only if their inputs and memory states have the same shape apart from
+ * the first dimension, so sequences move in lockstep - ones at different memory state length are not padded,
+ * but executed in separate inferences of the same round. Inputs and memory states of the sequences are concatenated
+ * along the first dimension, inference is executed once and outputs and new memory states are split back
+ * to the requests and sequences. Sequences join and leave between rounds.
+ */
+class ContinuousBatchingScheduler {
+public:
+    ContinuousBatchingScheduler(const std::string& modelName, model_version_t modelVersion, const ov::CompiledModel& compiledModel);
+    ~ContinuousBatchingScheduler();
+    ContinuousBatchingScheduler(const ContinuousBatchingScheduler&) = delete;
+    ContinuousBatchingScheduler& operator=(const ContinuousBatchingScheduler&) = delete;
+
+    /**
+     * @brief Checks if first dimension of all model inputs and outputs is dynamic, so steps can be batched
+     */
+    static Status validateModel(const std::string& modelName, model_version_t modelVersion, const ov::CompiledModel& compiledModel);
+
+    /**
+     * @brief Executes single step of the sequence as part of batched inference. Blocks until step is finished.
+     * Inputs with batch size 1 are read from step infer request and outputs are set back to it.
+     * Caller is expected to hold sequence lock.
+     *
+     * @param sequenceStart step starts from default memory state
+     * @param sequenceEnd memory state after the step is not stored in the sequence
+     */
+    Status schedule(ov::InferRequest& stepRequest, Sequence& sequence, bool sequenceStart, bool sequenceEnd);
+
+    size_t getIterationsCount() const { return this->iterations.load(); }
+    size_t getMaxBatchSize() const { return this->maxBatchSize.load(); }
+
+private:
+    struct Step;
+
+    void run();
+    Status executeIteration(const std::vector<std::shared_ptr<Step>>& steps);
+    bool canBatchTogether(const Step& first, const Step& second) const;
+
+    const std::string modelName;
+    const model_version_t modelVersion;
+    ov::CompiledModel compiledModel;
+    ov::InferRequest batchedRequest;
+    std::vector<std::string> stateNames;
+    // Staging tensors reused between iterations, ordered as compiled model inputs and state names
+    std::vector<ov::Tensor> batchedInputs;
+    std::vector<ov::Tensor> batchedStates;
+
+    std::atomic<size_t> iterations{0};
+    std::atomic<size_t> maxBatchSize{0};
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<Step>> pending;
+    bool stopped = false;
+    std::thread worker;
+};
+}  // namespace ovms
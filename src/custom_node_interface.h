@@ -73,6 +73,28 @@ int getInputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const stru
 int getOutputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager);
 int release(void* ptr, void* customNodeLibraryInternalManager);
 
+/**
+ * @brief Optional version 2 of execution interface in which output buffers are allocated by the server.
+ * Libraries exporting both getOutputsInfoForInputs and executeWithOutputs are executed with this interface,
+ * otherwise execute is used. Libraries still need to export all of the functions above.
+ *
+ * getOutputsInfoForInputs returns outputs metadata with all dimensions known for given inputs.
+ * Info array and dims are allocated by the library and freed with release, the same as in getOutputsInfo.
+ */
+int getOutputsInfoForInputs(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeTensor* inputs, int inputsCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager);
+/**
+ * @brief Fills outputs prepared by the server according to getOutputsInfoForInputs.
+ * Output names, dims and data buffers are owned by the server and must not be released nor used after return.
+ */
+int executeWithOutputs(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor* outputs, int outputsCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager);
+/**
+ * @brief Optional batched variant of executeWithOutputs, requires version 2 interface to be exported.
+ * Processes batchSize node executions at once. Inputs of item i start at inputs[i * inputsCount]
+ * and its outputs at outputs[i * outputsCount]. Outputs are prepared by the server according to
+ * getOutputsInfoForInputs called for each item separately.
+ */
+int executeBatch(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor* outputs, int outputsCount, int batchSize, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager);
+
 #ifdef __cplusplus
 }
 #endif
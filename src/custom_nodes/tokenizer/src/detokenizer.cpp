@@ -22,6 +22,8 @@
 
 #include "custom_node_interface.h"  // NOLINT
 #include "model.hpp"
+#include "node_resources.hpp"
+#include "parallel.hpp"
 #include "utils.hpp"
 
 #define DEBUG_MSG(str)                                     \
@@ -46,9 +48,11 @@ int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeP
     bool debugMode = get_string_parameter("debug", params, paramsCount) == "true";
     std::string modelPath = get_string_parameter("model_path", params, paramsCount, "");
     NODE_ASSERT(!modelPath.empty(), "model_path cannot be empty");
+    int threads = get_int_parameter("threads", params, paramsCount, static_cast<int>(getDefaultThreadsCount()));
+    NODE_ASSERT(threads > 0, "threads param must be larger than 0");
     try {
-        auto cnlim = std::make_unique<BlingFireModel>(modelPath, debugMode);
-        if (!cnlim->isValid())
+        auto cnlim = std::make_unique<NodeResources>(modelPath, debugMode, threads);
+        if (!cnlim->model.isValid())
             throw std::exception();
         *customNodeLibraryInternalManager = cnlim.release();
     } catch (...) {
@@ -60,7 +64,7 @@ int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeP
 
 int deinitialize(void* customNodeLibraryInternalManager) {
     if (customNodeLibraryInternalManager != nullptr) {
-        BlingFireModel* manager = static_cast<BlingFireModel*>(customNodeLibraryInternalManager);
+        NodeResources* manager = static_cast<NodeResources*>(customNodeLibraryInternalManager);
         delete manager;
     }
     return 0;
@@ -129,6 +133,8 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     // Parameters reading
     int maxBufferLength = get_int_parameter("max_buffer_length", params, paramsCount, DEFAULT_MAX_BUF_LEN);
     NODE_ASSERT(maxBufferLength > 0, "max_buffer_length param must be larger than 0");
+    int threads = get_int_parameter("threads", params, paramsCount, static_cast<int>(getDefaultThreadsCount()));
+    NODE_ASSERT(threads > 0, "threads param must be larger than 0");
 
     const CustomNodeTensor* logitsTensor = nullptr;
     const CustomNodeTensor* inputIdsTensor = nullptr;
@@ -137,12 +143,14 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     NODE_ASSERT(retrieveInputs(inputs, inputsCount, &logitsTensor, &inputIdsTensor, &attentionMaskTensor) == 0, "retrieveInputs() failed");
     NODE_ASSERT(validateInputs(logitsTensor, inputIdsTensor, attentionMaskTensor) == 0, "validateInputs() failed");
 
-    BlingFireModel* model = static_cast<BlingFireModel*>(customNodeLibraryInternalManager);
+    NodeResources* resources = static_cast<NodeResources*>(customNodeLibraryInternalManager);
+    const BlingFireModel* model = &resources->model;
 
-    std::vector<std::string> results;
-    for (uint64_t batch = 0; batch < logitsTensor->dims[0]; batch++) {
+    const uint64_t batchSize = logitsTensor->dims[0];
+    std::vector<std::string> results(batchSize);
+    DEBUG_MSG("detokenizing " << batchSize << " texts using up to " << threads << " threads");
+    resources->threadPool.parallelFor(batchSize, threads, [&](size_t batch) {
         // get previous tokens of current batch for context
-        DEBUG_MSG("get previous tokens of batch " << batch);
         int64_t* inputIds = reinterpret_cast<int64_t*>(
             inputIdsTensor->data +
             batch * (inputIdsTensor->dims[1] * sizeof(int64_t)));
@@ -158,26 +166,28 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
         if (lastNonZeroIndex < 0)
             lastNonZeroIndex = 0;
 
-        std::vector<int64_t> previousTokens(inputIds, inputIds + distance);
+        std::vector<int64_t> previousTokens;
+        previousTokens.reserve(distance + 1);
+        previousTokens.assign(inputIds, inputIds + distance);
 
         // slice
-        DEBUG_MSG("slicing batch " << batch);
         float* logits = reinterpret_cast<float*>(
             logitsTensor->data +
             batch * (logitsTensor->dims[1] * logitsTensor->dims[2] * sizeof(float)) +  // offset by batch
             (lastNonZeroIndex * logitsTensor->dims[2] * sizeof(float)));               // offset to get last element of second dimension
 
         // argmax
-        DEBUG_MSG("argmax batch " << batch);
         float* result = std::max_element(logits, logits + logitsTensor->dims[2]);
         int64_t token = std::distance(logits, result);
         previousTokens.push_back(token);
 
         // detokenize
-        DEBUG_MSG("detokenizing token batch " << batch);
-        auto text = model->detokenize(previousTokens, maxBufferLength);
-        DEBUG_MSG("detokenized token: (" << token << ") to: (" << text << ") for batch " << batch);
-        results.emplace_back(std::move(text));
+        results[batch] = model->detokenize(previousTokens.data(), previousTokens.size(), maxBufferLength);
+    });
+    if (debugMode) {
+        for (size_t batch = 0; batch < results.size(); batch++) {
+            DEBUG_MSG("detokenized to: (" << results[batch] << ") for batch " << batch);
+        }
     }
 
     DEBUG_MSG("getting max string length");
@@ -208,10 +218,10 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     output.precision = U8;
 
     DEBUG_MSG("writing output");
-    for (size_t i = 0; i < results.size(); i++) {
+    resources->threadPool.parallelFor(results.size(), threads, [&](size_t i) {
         std::memcpy(output.data + i * width, results[i].data(), results[i].size());
-        output.data[i * width + results[i].size()] = 0;
-    }
+        std::memset(output.data + i * width + results[i].size(), 0, width - results[i].size());
+    });
     DEBUG_MSG("execute() end");
     auto end = std::chrono::steady_clock::now();
     DEBUG_MSG("execute() end; took " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.f << " ms");
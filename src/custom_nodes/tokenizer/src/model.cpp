@@ -54,19 +54,28 @@ BlingFireModel::~BlingFireModel() {
 
 std::vector<int64_t> BlingFireModel::tokenize(const std::string& text, int maxIdsArrLength) {
     auto ids = std::make_unique<int32_t[]>(maxIdsArrLength);
-    const int idsLength = BlingFire::TextToIds(handle, text.c_str(), text.size(), ids.get(), maxIdsArrLength);
+    const int idsLength = tokenize(text.c_str(), text.size(), ids.get(), maxIdsArrLength);
     std::vector<int64_t> vec(idsLength);
     std::transform(ids.get(), ids.get() + idsLength, vec.begin(),
         [](int32_t val) { return static_cast<int64_t>(val); });
     return vec;
 }
 
+int BlingFireModel::tokenize(const char* text, size_t textLength, int32_t* ids, int maxIdsArrLength) const {
+    const int idsLength = BlingFire::TextToIds(handle, text, textLength, ids, maxIdsArrLength);
+    return std::clamp(idsLength, 0, maxIdsArrLength);
+}
+
 std::string BlingFireModel::detokenize(const std::vector<int64_t>& tokens, int maxBufferLength, bool skipSpecialTokens) {
-    auto ids = std::make_unique<int32_t[]>(tokens.size());
-    std::transform(tokens.begin(), tokens.end(), ids.get(),
+    return detokenize(tokens.data(), tokens.size(), maxBufferLength, skipSpecialTokens);
+}
+
+std::string BlingFireModel::detokenize(const int64_t* tokens, size_t tokensCount, int maxBufferLength, bool skipSpecialTokens) const {
+    auto ids = std::make_unique<int32_t[]>(tokensCount);
+    std::transform(tokens, tokens + tokensCount, ids.get(),
         [](int64_t val) { return static_cast<int32_t>(val); });
     std::string str(maxBufferLength + 1, '\0');  // +1 due to null ending
-    BlingFire::IdsToText(handle, ids.get(), tokens.size(), str.data(), maxBufferLength, skipSpecialTokens);
+    BlingFire::IdsToText(handle, ids.get(), tokensCount, str.data(), maxBufferLength, skipSpecialTokens);
     str.resize(std::strlen(str.data()));  // remove all remaining zero bytes
     return str;
 }
@@ -33,7 +33,11 @@ public:
     bool isValid() const { return handle != nullptr; }
 
     std::vector<int64_t> tokenize(const std::string& text, int maxIdsArrLength);
+    // Writes up to maxIdsArrLength ids into preallocated buffer and returns their number. Safe to call from multiple threads.
+    int tokenize(const char* text, size_t textLength, int32_t* ids, int maxIdsArrLength) const;
     std::string detokenize(const std::vector<int64_t>& tokens, int maxBufferLength, bool skipSpecialTokens = false);
+    // Safe to call from multiple threads
+    std::string detokenize(const int64_t* tokens, size_t tokensCount, int maxBufferLength, bool skipSpecialTokens = false) const;
 };
 
 }  // namespace tokenizer
@@ -0,0 +1,37 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+#include <cstddef>
+#include <string>
+
+#include "model.hpp"
+#include "parallel.hpp"
+
+namespace custom_nodes {
+namespace tokenizer {
+
+// Internal manager of tokenizer and detokenizer nodes
+struct NodeResources {
+    NodeResources(const std::string& modelPath, bool debug, size_t threadsCount) :
+        model(modelPath, debug),
+        threadPool(threadsCount) {}
+
+    BlingFireModel model;
+    ThreadPool threadPool;
+};
+
+}  // namespace tokenizer
+}  // namespace custom_nodes
@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace custom_nodes {
+namespace tokenizer {
+
+// Batch elements are picked in chunks, so threads processing short texts take more of them
+constexpr size_t PARALLEL_CHUNK_SIZE = 16;
+
+inline size_t getDefaultThreadsCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Worker threads are created once per node instance instead of on every execute() call.
+// Pool can be shared by concurrent execute() calls, each calling thread processes its own batch as well.
+class ThreadPool {
+public:
+    // Starts threadsCount - 1 workers, the calling thread of parallelFor is the remaining one
+    explicit ThreadPool(size_t threadsCount) {
+        try {
+            for (size_t i = 1; i < threadsCount; i++) {
+                workers.emplace_back([this]() { work(); });
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+    ~ThreadPool() {
+        stop();
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t getThreadsCount() const { return workers.size() + 1; }
+
+    // Calls body(i) for each i in [0, count) using up to maxThreads threads including the calling one.
+    // Small batches are processed on the calling thread only.
+    template <typename F>
+    void parallelFor(size_t count, size_t maxThreads, F&& body) {
+        const size_t chunks = (count + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+        const size_t threadsCount = std::min({std::max<size_t>(maxThreads, 1), chunks, getThreadsCount()});
+        if (threadsCount <= 1) {
+            for (size_t i = 0; i < count; i++) {
+                body(i);
+            }
+            return;
+        }
+        // Helpers started after all chunks are taken only touch the job state, which they keep alive
+        auto job = std::make_shared<Job>();
+        auto process = [job, &body, count, chunks]() {
+            for (size_t chunk = job->nextChunk++; chunk < chunks; chunk = job->nextChunk++) {
+                const size_t end = std::min(count, (chunk + 1) * PARALLEL_CHUNK_SIZE);
+                for (size_t i = chunk * PARALLEL_CHUNK_SIZE; i < end; i++) {
+                    body(i);
+                }
+                if (++job->doneChunks == chunks) {
+                    std::lock_guard<std::mutex> lock(job->mtx);
+                    job->done.notify_all();
+                }
+            }
+        };
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            for (size_t i = 1; i < threadsCount; i++) {
+                tasks.emplace(process);
+            }
+        }
+        cv.notify_all();
+        process();
+        std::unique_lock<std::mutex> lock(job->mtx);
+        job->done.wait(lock, [job, chunks]() { return job->doneChunks == chunks; });
+    }
+
+private:
+    struct Job {
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> doneChunks{0};
+        std::mutex mtx;
+        std::condition_variable done;
+    };
+
+    void work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [this]() { return stopped || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopped = true;
+        }
+        cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::queue<std::function<void()>> tasks;
+    bool stopped = false;
+    std::vector<std::thread> workers;
+};
+
+}  // namespace tokenizer
+}  // namespace custom_nodes
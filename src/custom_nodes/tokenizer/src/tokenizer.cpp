@@ -13,9 +13,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <new>
 #include <string>
 #include <vector>
 
@@ -24,6 +27,8 @@
 
 #include "custom_node_interface.h"  // NOLINT
 #include "model.hpp"
+#include "node_resources.hpp"
+#include "parallel.hpp"
 #include "utils.hpp"
 
 #define INPUT_NAME_TEXTS "texts"
@@ -48,9 +53,11 @@ int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeP
     bool debugMode = get_string_parameter("debug", params, paramsCount) == "true";
     std::string modelPath = get_string_parameter("model_path", params, paramsCount, "");
     NODE_ASSERT(!modelPath.empty(), "model_path cannot be empty");
+    int threads = get_int_parameter("threads", params, paramsCount, static_cast<int>(getDefaultThreadsCount()));
+    NODE_ASSERT(threads > 0, "threads param must be larger than 0");
     try {
-        auto cnlim = std::make_unique<BlingFireModel>(modelPath, debugMode);
-        if (!cnlim->isValid())
+        auto cnlim = std::make_unique<NodeResources>(modelPath, debugMode, threads);
+        if (!cnlim->model.isValid())
             throw std::exception();
         *customNodeLibraryInternalManager = cnlim.release();
     } catch (...) {
@@ -62,7 +69,7 @@ int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeP
 
 int deinitialize(void* customNodeLibraryInternalManager) {
     if (customNodeLibraryInternalManager != nullptr) {
-        BlingFireModel* manager = static_cast<BlingFireModel*>(customNodeLibraryInternalManager);
+        NodeResources* manager = static_cast<NodeResources*>(customNodeLibraryInternalManager);
         delete manager;
     }
     return 0;
@@ -102,14 +109,35 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     // Parameters reading
     int maxIdsArrLength = get_int_parameter("max_ids_arr_length", params, paramsCount, DEFAULT_MAX_ID_ARR_LEN);
     NODE_ASSERT(maxIdsArrLength > 0, "max_ids_arr_length param must be larger than 0");
+    int threads = get_int_parameter("threads", params, paramsCount, static_cast<int>(getDefaultThreadsCount()));
+    NODE_ASSERT(threads > 0, "threads param must be larger than 0");
 
     const CustomNodeTensor* textTensor = nullptr;
 
     NODE_ASSERT(retrieveInputs(inputs, inputsCount, &textTensor) == 0, "retrieveInputs() failed");
     NODE_ASSERT(validateInputs(textTensor) == 0, "validateInputs() failed");
 
-    BlingFireModel* model = static_cast<BlingFireModel*>(customNodeLibraryInternalManager);
+    NodeResources* resources = static_cast<NodeResources*>(customNodeLibraryInternalManager);
+    const BlingFireModel* model = &resources->model;
 
+    const uint64_t batchSize = textTensor->dims[0];
+    const uint64_t maxTextLength = textTensor->dims[1];
+
+    // Padded width is known only after all texts are tokenized, so ids are generated into scratch rows first
+    std::unique_ptr<int32_t[]> ids(new (std::nothrow) int32_t[batchSize * maxIdsArrLength]);
+    NODE_ASSERT(ids != nullptr, "scratch buffer allocation has failed");
+    std::vector<int> idsLengths(batchSize);
+    DEBUG_MSG("tokenizing " << batchSize << " texts using up to " << threads << " threads");
+    resources->threadPool.parallelFor(batchSize, threads, [&](size_t batch) {
+        const char* strStart = (const char*)textTensor->data + batch * maxTextLength;
+        idsLengths[batch] = model->tokenize(strStart, strnlen(strStart, maxTextLength), ids.get() + batch * maxIdsArrLength, maxIdsArrLength);
+    });
+
+    DEBUG_MSG("getting max token size");
+    // max_element returns end() for an empty batch
+    const size_t maxTokenSize = idsLengths.empty() ? 0 : *std::max_element(idsLengths.begin(), idsLengths.end());
+
+    DEBUG_MSG("preparing output tensors");
     *outputsCount = 3;
     *outputs = (struct CustomNodeTensor*)malloc(*outputsCount * sizeof(CustomNodeTensor));
     if ((*outputs) == nullptr) {
@@ -117,69 +145,58 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
         return 1;
     }
 
-    std::vector<std::vector<int64_t>> ids(textTensor->dims[0]);
-    // For each batch, sequentially
-    for (uint64_t batch = 0; batch < textTensor->dims[0]; batch++) {
-        DEBUG_MSG("tokenizing batch " << batch);
-        const char* strStart = (const char*)textTensor->data + batch * textTensor->dims[1];
-        std::string text(strStart, strnlen(strStart, textTensor->dims[1]));
-        ids[batch] = model->tokenize(text, maxIdsArrLength);
-        DEBUG_MSG("tokenized batch " << batch << "; of string: " << text);
-    }
-
-    DEBUG_MSG("getting max token size");
-    size_t maxTokenSize = 0;
-    for (const auto& id : ids) {
-        maxTokenSize = std::max(maxTokenSize, id.size());
-    }
-
-    DEBUG_MSG("preparing output tensors");
     CustomNodeTensor& tokens = (*outputs)[0];
     tokens.name = OUTPUT_NAME_TOKENS;
-    tokens.dataBytes = sizeof(int64_t) * maxTokenSize * ids.size();
+    tokens.dataBytes = sizeof(int64_t) * maxTokenSize * batchSize;
     tokens.data = (uint8_t*)malloc(tokens.dataBytes);
+    NODE_ASSERT(tokens.data != nullptr || tokens.dataBytes == 0, "malloc has failed");
     tokens.dimsCount = 2;
     tokens.dims = (uint64_t*)malloc(tokens.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(tokens.dims != nullptr, "malloc has failed");
-    tokens.dims[0] = ids.size();
+    tokens.dims[0] = batchSize;
     tokens.dims[1] = maxTokenSize;
     tokens.precision = I64;
 
     CustomNodeTensor& attention = (*outputs)[1];
     attention.name = OUTPUT_NAME_ATTENTION;
-    attention.dataBytes = sizeof(int64_t) * maxTokenSize * ids.size();
+    attention.dataBytes = sizeof(int64_t) * maxTokenSize * batchSize;
     attention.data = (uint8_t*)malloc(attention.dataBytes);
+    NODE_ASSERT(attention.data != nullptr || attention.dataBytes == 0, "malloc has failed");
     attention.dimsCount = 2;
     attention.dims = (uint64_t*)malloc(attention.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(attention.dims != nullptr, "malloc has failed");
-    attention.dims[0] = ids.size();
+    attention.dims[0] = batchSize;
     attention.dims[1] = maxTokenSize;
     attention.precision = I64;
 
     CustomNodeTensor& position = (*outputs)[2];
     position.name = OUTPUT_NAME_POSITION;
-    position.dataBytes = sizeof(int64_t) * maxTokenSize * ids.size();
+    position.dataBytes = sizeof(int64_t) * maxTokenSize * batchSize;
     position.data = (uint8_t*)malloc(position.dataBytes);
+    NODE_ASSERT(position.data != nullptr || position.dataBytes == 0, "malloc has failed");
     position.dimsCount = 2;
     position.dims = (uint64_t*)malloc(position.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(position.dims != nullptr, "malloc has failed");
-    position.dims[0] = ids.size();
+    position.dims[0] = batchSize;
     position.dims[1] = maxTokenSize;
     position.precision = I64;
-    DEBUG_MSG("writing output");
 
-    for (size_t i = 0; i < ids.size(); i++) {
-        std::memcpy(tokens.data + i * maxTokenSize * sizeof(int64_t), ids[i].data(), ids[i].size() * sizeof(int64_t));
-        for (size_t j = 0; j < ids[i].size(); j++) {
-            ((int64_t*)attention.data)[i * maxTokenSize + j] = 1;
-        }
-        for (size_t j = 0; j < ids[i].size(); j++) {
-            ((int64_t*)position.data)[i * maxTokenSize + j] = j;
-        }
-        for (size_t j = ids[i].size(); j < maxTokenSize; j++) {
-            ((int64_t*)attention.data)[i * maxTokenSize + j] = 0;
+    DEBUG_MSG("writing output");
+    resources->threadPool.parallelFor(batchSize, threads, [&](size_t batch) {
+        const int32_t* batchIds = ids.get() + batch * maxIdsArrLength;
+        const size_t idsLength = idsLengths[batch];
+        int64_t* tokensRow = (int64_t*)tokens.data + batch * maxTokenSize;
+        int64_t* attentionRow = (int64_t*)attention.data + batch * maxTokenSize;
+        int64_t* positionRow = (int64_t*)position.data + batch * maxTokenSize;
+        for (size_t j = 0; j < idsLength; j++) {
+            tokensRow[j] = batchIds[j];
+            attentionRow[j] = 1;
+            positionRow[j] = j;
         }
-    }
+        std::fill(tokensRow + idsLength, tokensRow + maxTokenSize, 0);
+        std::fill(attentionRow + idsLength, attentionRow + maxTokenSize, 0);
+        std::fill(positionRow + idsLength, positionRow + maxTokenSize, 0);
+    });
     auto end = std::chrono::steady_clock::now();
     DEBUG_MSG("execute() end; took " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.f << " ms");
     return 0;
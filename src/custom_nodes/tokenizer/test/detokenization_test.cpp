@@ -278,3 +278,24 @@ TEST_F(DetokenizerFixtureTest, execute) {
     ASSERT_EQ(outputs[0], "Hello world\"");
     ASSERT_EQ(outputs[1], "!");
 }
+
+TEST_F(DetokenizerFixtureTest, executeInParallel) {
+    const size_t batchSize = 100;
+    const size_t vocabularySize = 4;
+    std::vector<float> logits(batchSize * vocabularySize, 0.0);
+    std::vector<std::vector<int64_t>> previousTokens;
+    for (size_t i = 0; i < batchSize; i++) {
+        logits[i * vocabularySize + i % vocabularySize] = 1.0;
+        previousTokens.push_back(i % 2 ? std::vector<int64_t>{18435} : std::vector<int64_t>{23294});
+    }
+    params[2].key = "threads";
+    params[2].value = "4";
+    std::vector<std::string> outputs;
+    run(logits, {batchSize, 1, vocabularySize}, previousTokens, outputs);
+    ASSERT_EQ(outputs.size(), batchSize);
+
+    BlingFireModel reference(TEST_MODEL_FILE_PATH);
+    for (size_t i = 0; i < batchSize; i++) {
+        EXPECT_EQ(outputs[i], reference.detokenize({previousTokens[i][0], static_cast<int64_t>(i % vocabularySize)}, 1024)) << "batch: " << i;
+    }
+}
@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "custom_node_interface.h"  // NOLINT
+
+#define TEST_MODEL_FILE_PATH "./gpt2.bin"
+#define INPUT_NAME_TEXTS "texts"
+
+// Measures tokenizer node execution time for a batch of sentences with different number of threads.
+// Usage: ./tokenization_benchmark [batch_size] [iterations]
+int main(int argc, char** argv) {
+    const size_t batchSize = argc > 1 ? std::stoul(argv[1]) : 1000;
+    const int iterations = argc > 2 ? std::stoi(argv[2]) : 20;
+
+    const std::vector<std::string> words = {"The", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog", "こんにちは", "OpenVINO", "serving", "model", "tokenization,"};
+    std::vector<std::string> sentences(batchSize);
+    size_t maxLength = 0;
+    for (size_t i = 0; i < batchSize; i++) {
+        const size_t wordsCount = 8 + (i * 7) % 56;
+        for (size_t j = 0; j < wordsCount; j++) {
+            sentences[i] += words[(i + j * 3) % words.size()] + " ";
+        }
+        maxLength = std::max(maxLength, sentences[i].size());
+    }
+    const size_t width = maxLength + 1;
+    std::vector<uint8_t> data(batchSize * width, 0);
+    for (size_t i = 0; i < batchSize; i++) {
+        std::memcpy(data.data() + i * width, sentences[i].data(), sentences[i].size());
+    }
+    uint64_t dims[] = {batchSize, width};
+    struct CustomNodeTensor input;
+    input.name = INPUT_NAME_TEXTS;
+    input.data = data.data();
+    input.dataBytes = data.size();
+    input.dims = dims;
+    input.dimsCount = 2;
+    input.precision = U8;
+
+    struct CustomNodeParam initParams[1];
+    initParams[0].key = "model_path";
+    initParams[0].value = TEST_MODEL_FILE_PATH;
+    void* model = nullptr;
+    if (initialize(&model, initParams, 1) != 0) {
+        std::cerr << "Cannot load model: " << TEST_MODEL_FILE_PATH << std::endl;
+        return 1;
+    }
+
+    std::vector<unsigned int> threadsCounts = {1, 2, 4};
+    if (std::thread::hardware_concurrency() > 4) {
+        threadsCounts.push_back(std::thread::hardware_concurrency());
+    }
+    std::cout << "Batch size: " << batchSize << "; iterations: " << iterations << std::endl;
+    for (unsigned int threads : threadsCounts) {
+        const std::string threadsValue = std::to_string(threads);
+        struct CustomNodeParam params[1];
+        params[0].key = "threads";
+        params[0].value = threadsValue.c_str();
+
+        double totalMs = 0;
+        for (int i = 0; i < iterations + 1; i++) {
+            struct CustomNodeTensor* outputs = nullptr;
+            int outputsCount = 0;
+            auto start = std::chrono::steady_clock::now();
+            int ret = execute(&input, 1, &outputs, &outputsCount, params, 1, model);
+            auto end = std::chrono::steady_clock::now();
+            if (ret != 0) {
+                std::cerr << "execute() failed" << std::endl;
+                deinitialize(model);
+                return 1;
+            }
+            // First iteration is a warm-up
+            if (i > 0) {
+                totalMs += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+            }
+            for (int j = 0; j < outputsCount; j++) {
+                release(outputs[j].data, model);
+                release(outputs[j].dims, model);
+            }
+            release(outputs, model);
+        }
+        std::cout << "threads: " << threads << "; avg execute time: " << totalMs / iterations << " ms; sentences/s: " << batchSize * iterations / (totalMs / 1000) << std::endl;
+    }
+    deinitialize(model);
+    return 0;
+}
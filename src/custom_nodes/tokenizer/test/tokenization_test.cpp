@@ -244,3 +244,27 @@ TEST_F(TokenizerFixtureTest, execute) {
     ASSERT_EQ(std::memcmp(outputs[2].tokens.data(), std::vector<int64_t>{23294, 241, 22174, 28618, 2515, 94, 31676}.data(), 7 * sizeof(int64_t)), 0);
     ASSERT_EQ(std::memcmp(outputs[2].attention.data(), std::vector<int64_t>{1, 1, 1, 1, 1, 1, 1}.data(), 7 * sizeof(int64_t)), 0);
 }
+
+TEST_F(TokenizerFixtureTest, executeInParallel) {
+    std::vector<std::string> texts;
+    for (int i = 0; i < 100; i++) {
+        texts.emplace_back(i % 10 == 0 ? "" : "Hello world " + std::string(i % 7, '!') + std::to_string(i));
+    }
+    params[2].key = "threads";
+    params[2].value = "4";
+    std::vector<output> outputs;
+    run(texts, outputs);
+    ASSERT_EQ(outputs.size(), texts.size());
+
+    BlingFireModel reference(TEST_MODEL_FILE_PATH);
+    for (size_t i = 0; i < texts.size(); i++) {
+        auto expected = reference.tokenize(texts[i], 1024);
+        ASSERT_GE(outputs[i].tokens.size(), expected.size());
+        for (size_t j = 0; j < outputs[i].tokens.size(); j++) {
+            bool padding = j >= expected.size();
+            EXPECT_EQ(outputs[i].tokens[j], padding ? 0 : expected[j]) << "text: " << i << " token: " << j;
+            EXPECT_EQ(outputs[i].attention[j], padding ? 0 : 1) << "text: " << i << " token: " << j;
+            EXPECT_EQ(outputs[i].position[j], padding ? 0 : j) << "text: " << i << " token: " << j;
+        }
+    }
+}
@@ -15,7 +15,9 @@
 //*****************************************************************************
 #include "custom_node.hpp"
 
+#include <functional>
 #include <utility>
+#include <vector>
 
 #include "../custom_node_interface.h"  // NOLINT
 #include "../logging.hpp"
@@ -35,19 +37,71 @@ CustomNode::CustomNode(
     const std::unordered_map<std::string, std::string>& nodeOutputNameAlias,
     std::optional<int32_t> demultiplyCount,
     std::set<std::string> gatherFromNode,
-    std::shared_ptr<CNLIMWrapper> customNodeLibraryInternalManager) :
+    std::shared_ptr<CNLIMWrapper> customNodeLibraryInternalManager,
+    std::shared_ptr<const tensor_map_t> outputsInfo) :
     Node(nodeName, demultiplyCount, std::move(gatherFromNode)),
     library(library),
     parameters(parameters),
     nodeOutputNameAlias(nodeOutputNameAlias),
     libraryParameters(createCustomNodeParamArray(this->parameters)),
-    customNodeLibraryInternalManager(std::move(customNodeLibraryInternalManager)) {
+    customNodeLibraryInternalManager(std::move(customNodeLibraryInternalManager)),
+    outputsInfo(std::move(outputsInfo)) {
+}
+
+Status CustomNode::prepareOutputsInfo() {
+    if (this->outputsInfo || !this->library.hasServerAllocatedOutputs()) {
+        return StatusCode::OK;
+    }
+    struct CustomNodeTensorInfo* info = nullptr;
+    int infoCount = 0;
+    int result = this->library.getOutputsInfo(&info, &infoCount, this->libraryParameters.get(), this->parameters.size(), getCNLIMWrapperPtr(customNodeLibraryInternalManager));
+    if (result != 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {}; outputs metadata call failed with return code: {}", getName(), result);
+        return StatusCode::NODE_LIBRARY_METADATA_FAILED;
+    }
+    auto libraryOutputsInfo = std::make_shared<tensor_map_t>();
+    auto status = createTensorInfoMap(info, infoCount, *libraryOutputsInfo, this->library.release, getCNLIMWrapperPtr(customNodeLibraryInternalManager));
+    if (!status.ok()) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {}; has corrupted outputs metadata", getName());
+        return status;
+    }
+    this->outputsInfo = std::move(libraryOutputsInfo);
+    return StatusCode::OK;
 }
 
 Status CustomNode::execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
     auto& nodeSession = getNodeSession(sessionKey);
     auto& customNodeSession = static_cast<CustomNodeSession&>(nodeSession);
-    return customNodeSession.execute(notifyEndQueue, *this, this->library, this->libraryParameters, this->parameters.size(), getCNLIMWrapperPtr(customNodeLibraryInternalManager));
+    auto status = prepareOutputsInfo();
+    if (!status.ok()) {
+        notifyEndQueue.push({*this, sessionKey});
+        return status;
+    }
+    static const tensor_map_t emptyOutputsInfo;
+    return customNodeSession.execute(notifyEndQueue, *this, this->library, this->libraryParameters, this->parameters.size(), getCNLIMWrapperPtr(customNodeLibraryInternalManager),
+        this->outputsInfo ? *this->outputsInfo : emptyOutputsInfo);
+}
+
+bool CustomNode::isBatchExecutionSupported() const {
+    return this->library.hasBatchExecution();
+}
+
+Status CustomNode::executeBatch(const std::vector<session_key_t>& sessionKeys, PipelineEventQueue& notifyEndQueue) {
+    std::vector<std::reference_wrapper<CustomNodeSession>> sessions;
+    sessions.reserve(sessionKeys.size());
+    for (const auto& sessionKey : sessionKeys) {
+        sessions.emplace_back(static_cast<CustomNodeSession&>(getNodeSession(sessionKey)));
+    }
+    auto status = prepareOutputsInfo();
+    if (!status.ok()) {
+        for (const auto& sessionKey : sessionKeys) {
+            notifyEndQueue.push({*this, sessionKey});
+        }
+        return status;
+    }
+    static const tensor_map_t emptyOutputsInfo;
+    return CustomNodeSession::executeBatch(sessions, notifyEndQueue, *this, this->library, this->libraryParameters, this->parameters.size(), getCNLIMWrapperPtr(customNodeLibraryInternalManager),
+        this->outputsInfo ? *this->outputsInfo : emptyOutputsInfo);
 }
 
 Status CustomNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) {
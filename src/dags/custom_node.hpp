@@ -19,7 +19,9 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "../tensorinfo.hpp"
 #include "node.hpp"
 #include "node_library.hpp"
 #include "nodeinfo.hpp"
@@ -40,6 +42,11 @@ class CustomNode : public Node {
 
     std::shared_ptr<CNLIMWrapper> customNodeLibraryInternalManager;
 
+    // Static outputs metadata of library, used to verify outputs reported for given inputs
+    std::shared_ptr<const tensor_map_t> outputsInfo;
+
+    Status prepareOutputsInfo();
+
 public:
     CustomNode(
         const std::string& nodeName,
@@ -48,9 +55,12 @@ public:
         const std::unordered_map<std::string, std::string>& nodeOutputNameAlias = {},
         std::optional<int32_t> demultiplyCount = std::nullopt,
         std::set<std::string> gatherFromNode = {},
-        std::shared_ptr<CNLIMWrapper> customNodeLibraryInternalManager = nullptr);
+        std::shared_ptr<CNLIMWrapper> customNodeLibraryInternalManager = nullptr,
+        std::shared_ptr<const tensor_map_t> outputsInfo = nullptr);
 
     Status execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) override;
+    bool isBatchExecutionSupported() const override;
+    Status executeBatch(const std::vector<session_key_t>& sessionKeys, PipelineEventQueue& notifyEndQueue) override;
 
     Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override;
     Status fetchResults(TensorWithSourceMap& outputs, session_key_t sessionKey);
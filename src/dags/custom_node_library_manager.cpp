@@ -99,6 +99,24 @@ Status CustomNodeLibraryManager::loadLibrary(const std::string& name, const std:
         return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
     }
 
+    // Optional server allocated outputs interface, library has to export either both functions or none
+    outputs_info_for_inputs_fn getOutputsInfoForInputs = reinterpret_cast<outputs_info_for_inputs_fn>(dlsym(handle, "getOutputsInfoForInputs"));
+    dlerror();
+    execute_with_outputs_fn executeWithOutputs = reinterpret_cast<execute_with_outputs_fn>(dlsym(handle, "executeWithOutputs"));
+    dlerror();
+    if ((getOutputsInfoForInputs == nullptr) != (executeWithOutputs == nullptr)) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to load library name: {}; library has to export both getOutputsInfoForInputs and executeWithOutputs or none of them", name);
+        dlclose(handle);
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
+    }
+    execute_batch_fn executeBatch = reinterpret_cast<execute_batch_fn>(dlsym(handle, "executeBatch"));
+    dlerror();
+    if (executeBatch != nullptr && executeWithOutputs == nullptr) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to load library name: {}; executeBatch requires getOutputsInfoForInputs and executeWithOutputs to be exported", name);
+        dlclose(handle);
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
+    }
+
     libraries[name] = NodeLibrary{
         initialize,
         deinitialize,
@@ -106,7 +124,16 @@ Status CustomNodeLibraryManager::loadLibrary(const std::string& name, const std:
         getInputsInfo,
         getOutputsInfo,
         release,
+        getOutputsInfoForInputs,
+        executeWithOutputs,
+        executeBatch,
         basePath};
+    if (getOutputsInfoForInputs != nullptr) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Custom node library name: {} uses outputs allocated by the server", name);
+    }
+    if (executeBatch != nullptr) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Custom node library name: {} supports batched execution", name);
+    }
 
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Successfully loaded custom node library name: {}; base_path: {}", name, basePath);
     return StatusCode::OK;
@@ -19,11 +19,14 @@
 #include <functional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "../custom_node_interface.h"  // NOLINT
 #include "../logging.hpp"
+#include "../ov_utils.hpp"
 #include "../profiler.hpp"
 #include "../status.hpp"
+#include "../tensorinfo.hpp"
 #include "../timer.hpp"
 #include "custom_node_output_allocator.hpp"
 #include "node.hpp"
@@ -31,6 +34,7 @@
 #include "node_library_utils.hpp"
 #include "nodeinputhandler.hpp"
 #include "pipelineeventqueue.hpp"
+#include "tensor_pool.hpp"
 
 namespace ovms {
 
@@ -51,8 +55,11 @@ static std::unordered_map<std::string, shape_t> createOwnedShapesCopy(const Tens
     return tensorsDims;
 }
 
-Status CustomNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node, const NodeLibrary& library, std::unique_ptr<struct CustomNodeParam[]>& parameters, int parametersCount, void* customNodeLibraryInternalManager) {
+Status CustomNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node, const NodeLibrary& library, std::unique_ptr<struct CustomNodeParam[]>& parameters, int parametersCount, void* customNodeLibraryInternalManager, const tensor_map_t& outputsInfo) {
     OVMS_PROFILE_FUNCTION();
+    if (library.hasServerAllocatedOutputs()) {
+        return executeWithServerAllocatedOutputs(notifyEndQueue, node, library, parameters, parametersCount, customNodeLibraryInternalManager, outputsInfo);
+    }
     const auto& tensorMap = this->inputHandler->getInputs();
     auto inputTensorsCount = tensorMap.size();
     // this is a hack to overcome OV 1.0 -> 2.0 API change where we do not get reference to
@@ -126,6 +133,192 @@ Status CustomNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node
     return status;
 }
 
+static bool isCustomNodeTensorPrecision(Precision precision) {
+    switch (precision) {
+    case Precision::FP32:
+    case Precision::FP64:
+    case Precision::FP16:
+    case Precision::I64:
+    case Precision::I32:
+    case Precision::I16:
+    case Precision::I8:
+    case Precision::U16:
+    case Precision::U8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Status CustomNodeSession::prepareOutputTensors(const struct CustomNodeTensor* inputTensors, int inputTensorsCount, TensorMap& outputs, const NodeLibrary& library, std::unique_ptr<struct CustomNodeParam[]>& parameters, int parametersCount, void* customNodeLibraryInternalManager, const tensor_map_t& outputsInfo) {
+    OVMS_PROFILE_FUNCTION();
+    struct CustomNodeTensorInfo* info = nullptr;
+    int infoCount = 0;
+    int result = library.getOutputsInfoForInputs(
+        &info,
+        &infoCount,
+        inputTensors,
+        inputTensorsCount,
+        parameters.get(),
+        parametersCount,
+        customNodeLibraryInternalManager);
+    if (result != 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; outputs metadata call for given inputs failed with return code: {}", getName(), getSessionKey(), result);
+        return StatusCode::NODE_LIBRARY_METADATA_FAILED;
+    }
+    tensor_map_t requestOutputsInfo;
+    auto status = createTensorInfoMap(info, infoCount, requestOutputsInfo, library.release, customNodeLibraryInternalManager);
+    if (!status.ok()) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has corrupted outputs metadata for given inputs", getName(), getSessionKey());
+        return status;
+    }
+    for (const auto& [name, outputInfo] : requestOutputsInfo) {
+        if (!isCustomNodeTensorPrecision(outputInfo->getPrecision())) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; Unsupported output precision: {} for output: {}",
+                getName(), getSessionKey(), toString(outputInfo->getPrecision()), name);
+            return StatusCode::NODE_LIBRARY_INVALID_PRECISION;
+        }
+        // Outputs are allocated by server, so library cannot report anything it has not declared in its static metadata
+        auto it = outputsInfo.find(name);
+        if (it == outputsInfo.end()) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; output: {} for given inputs is not declared in outputs metadata",
+                getName(), getSessionKey(), name);
+            return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED;
+        }
+        if (it->second->getPrecision() != outputInfo->getPrecision()) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; output: {} precision for given inputs: {} does not match outputs metadata precision: {}",
+                getName(), getSessionKey(), name, toString(outputInfo->getPrecision()), toString(it->second->getPrecision()));
+            return StatusCode::NODE_LIBRARY_INVALID_PRECISION;
+        }
+        if (outputInfo->getShape().isDynamic()) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; output: {} shape: {} is not known for given inputs",
+                getName(), getSessionKey(), name, outputInfo->getShape().toString());
+            return StatusCode::NODE_LIBRARY_INVALID_SHAPE;
+        }
+        ov::Tensor tensor;
+        const auto shape = outputInfo->getShape().createPartialShape().get_shape();
+        status = this->tensorPool ? this->tensorPool->createTensor(tensor, outputInfo->getOvPrecision(), shape) : createSharedTensor(tensor, outputInfo->getOvPrecision(), shape);
+        if (!status.ok()) {
+            return status;
+        }
+        outputs.emplace(name, std::move(tensor));
+    }
+    return StatusCode::OK;
+}
+
+Status CustomNodeSession::executeWithServerAllocatedOutputs(PipelineEventQueue& notifyEndQueue, Node& node, const NodeLibrary& library, std::unique_ptr<struct CustomNodeParam[]>& parameters, int parametersCount, void* customNodeLibraryInternalManager, const tensor_map_t& outputsInfo) {
+    OVMS_PROFILE_FUNCTION();
+    const auto& tensorMap = this->inputHandler->getInputs();
+    auto inputTensorsCount = tensorMap.size();
+    auto tensorsDims = createOwnedShapesCopy(tensorMap);
+    auto inputTensors = createCustomNodeTensorArray(tensorMap, tensorsDims);
+    TensorMap outputs;
+    auto status = prepareOutputTensors(inputTensors.get(), inputTensorsCount, outputs, library, parameters, parametersCount, customNodeLibraryInternalManager, outputsInfo);
+    if (!status.ok()) {
+        notifyEndQueue.push({node, getSessionKey()});
+        return status;
+    }
+    auto outputsDims = createOwnedShapesCopy(outputs);
+    auto outputTensors = createCustomNodeTensorArray(outputs, outputsDims);
+    this->timer->start(EXECUTE);
+    OVMS_PROFILE_SYNC_BEGIN("Custom Node Library executeWithOutputs()");
+    int result = library.executeWithOutputs(
+        inputTensors.get(),
+        inputTensorsCount,
+        outputTensors.get(),
+        outputs.size(),
+        parameters.get(),
+        parametersCount,
+        customNodeLibraryInternalManager);
+    OVMS_PROFILE_SYNC_END("Custom Node Library executeWithOutputs()");
+    this->timer->stop(EXECUTE);
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Custom node execution processing time for node {}; session: {} - {} ms",
+        this->getName(),
+        this->getSessionKey(),
+        this->timer->elapsed<std::chrono::microseconds>(EXECUTE) / 1000);
+    if (result != 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has failed custom node execution with return code: {}", getName(), getSessionKey(), result);
+        notifyEndQueue.push({node, getSessionKey()});
+        return StatusCode::NODE_LIBRARY_EXECUTION_FAILED;
+    }
+    this->resultTensors = std::move(outputs);
+    notifyEndQueue.push({node, getSessionKey()});
+    return StatusCode::OK;
+}
+
+Status CustomNodeSession::executeBatch(const std::vector<std::reference_wrapper<CustomNodeSession>>& sessions, PipelineEventQueue& notifyEndQueue, Node& node, const NodeLibrary& library, std::unique_ptr<struct CustomNodeParam[]>& parameters, int parametersCount, void* customNodeLibraryInternalManager, const tensor_map_t& outputsInfo) {
+    OVMS_PROFILE_FUNCTION();
+    auto notifyEnd = [&sessions, &notifyEndQueue, &node]() {
+        for (auto& session : sessions) {
+            notifyEndQueue.push({node, session.get().getSessionKey()});
+        }
+    };
+    const size_t batchSize = sessions.size();
+    // Dims and outputs are referenced by library tensors so they have to be kept until execution ends
+    std::vector<std::unordered_map<std::string, shape_t>> inputsDims(batchSize);
+    std::vector<std::unordered_map<std::string, shape_t>> outputsDims(batchSize);
+    std::vector<TensorMap> outputs(batchSize);
+    std::vector<struct CustomNodeTensor> inputTensors;
+    std::vector<struct CustomNodeTensor> outputTensors;
+    size_t inputTensorsCount = 0;
+    size_t outputTensorsCount = 0;
+    for (size_t i = 0; i < batchSize; ++i) {
+        auto& session = sessions[i].get();
+        const auto& tensorMap = session.inputHandler->getInputs();
+        inputsDims[i] = createOwnedShapesCopy(tensorMap);
+        auto itemInputTensors = createCustomNodeTensorArray(tensorMap, inputsDims[i]);
+        auto status = session.prepareOutputTensors(itemInputTensors.get(), tensorMap.size(), outputs[i], library, parameters, parametersCount, customNodeLibraryInternalManager, outputsInfo);
+        if (!status.ok()) {
+            notifyEnd();
+            return status;
+        }
+        if (i == 0) {
+            inputTensorsCount = tensorMap.size();
+            outputTensorsCount = outputs[i].size();
+        } else if (tensorMap.size() != inputTensorsCount || outputs[i].size() != outputTensorsCount) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has different number of inputs or outputs than other sessions in batch",
+                session.getName(), session.getSessionKey());
+            notifyEnd();
+            return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED_COUNT;
+        }
+        outputsDims[i] = createOwnedShapesCopy(outputs[i]);
+        auto itemOutputTensors = createCustomNodeTensorArray(outputs[i], outputsDims[i]);
+        inputTensors.insert(inputTensors.end(), itemInputTensors.get(), itemInputTensors.get() + inputTensorsCount);
+        outputTensors.insert(outputTensors.end(), itemOutputTensors.get(), itemOutputTensors.get() + outputTensorsCount);
+    }
+    for (auto& session : sessions) {
+        session.get().timer->start(EXECUTE);
+    }
+    OVMS_PROFILE_SYNC_BEGIN("Custom Node Library executeBatch()");
+    int result = library.executeBatch(
+        inputTensors.data(),
+        inputTensorsCount,
+        outputTensors.data(),
+        outputTensorsCount,
+        batchSize,
+        parameters.get(),
+        parametersCount,
+        customNodeLibraryInternalManager);
+    OVMS_PROFILE_SYNC_END("Custom Node Library executeBatch()");
+    for (auto& session : sessions) {
+        session.get().timer->stop(EXECUTE);
+    }
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Custom node batched execution processing time for node {}; batch size: {} - {} ms",
+        node.getName(),
+        batchSize,
+        sessions[0].get().timer->elapsed<std::chrono::microseconds>(EXECUTE) / 1000);
+    if (result != 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; batch size: {}; has failed custom node batched execution with return code: {}", node.getName(), batchSize, result);
+        notifyEnd();
+        return StatusCode::NODE_LIBRARY_EXECUTION_FAILED;
+    }
+    for (size_t i = 0; i < batchSize; ++i) {
+        sessions[i].get().resultTensors = std::move(outputs[i]);
+    }
+    notifyEnd();
+    return StatusCode::OK;
+}
+
 Status CustomNodeSession::fetchResult(const std::string& name, ov::Tensor& resultTensor) {
     auto it = resultTensors.find(name);
     if (it == resultTensors.end()) {
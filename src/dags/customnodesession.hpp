@@ -15,12 +15,15 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <openvino/openvino.hpp>
 
 #include "nodesession.hpp"
+#include "../tensorinfo.hpp"
 #include "pipelineeventqueue.hpp"
 #include "tensormap.hpp"
 
@@ -47,7 +50,21 @@ public:
         const NodeLibrary& library,
         std::unique_ptr<struct CustomNodeParam[]>& parameters,
         int parametersCount,
-        void* customNodeLibraryInternalManager);
+        void* customNodeLibraryInternalManager,
+        const tensor_map_t& outputsInfo);
+
+    /**
+     * @brief Executes multiple ready sessions of the same node with single library call
+     */
+    static Status executeBatch(
+        const std::vector<std::reference_wrapper<CustomNodeSession>>& sessions,
+        PipelineEventQueue& notifyEndQueue,
+        Node& node,
+        const NodeLibrary& library,
+        std::unique_ptr<struct CustomNodeParam[]>& parameters,
+        int parametersCount,
+        void* customNodeLibraryInternalManager,
+        const tensor_map_t& outputsInfo);
 
     Status fetchResult(const std::string& name, ov::Tensor& resultTensor);
 
@@ -55,6 +72,15 @@ public:
     void release() override;
 
 private:
+    Status executeWithServerAllocatedOutputs(
+        PipelineEventQueue& notifyEndQueue,
+        Node& node,
+        const NodeLibrary& library,
+        std::unique_ptr<struct CustomNodeParam[]>& parameters,
+        int parametersCount,
+        void* customNodeLibraryInternalManager,
+        const tensor_map_t& outputsInfo);
+    Status prepareOutputTensors(const struct CustomNodeTensor* inputTensors, int inputTensorsCount, TensorMap& outputs, const NodeLibrary& library, std::unique_ptr<struct CustomNodeParam[]>& parameters, int parametersCount, void* customNodeLibraryInternalManager, const tensor_map_t& outputsInfo);
     static void releaseTensorResources(const struct CustomNodeTensor* tensor, const NodeLibrary& library, void* customNodeLibraryInternalManager);
     Status createTensor(const struct CustomNodeTensor* tensor, ov::Tensor& resultTensor, const NodeLibrary& library, void* customNodeLibraryInternalManager);
 };
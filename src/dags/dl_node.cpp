@@ -27,9 +27,11 @@
 #include "../ov_utils.hpp"
 #include "../ovinferrequestsqueue.hpp"
 #include "../prediction_service_utils.hpp"
+#include "../shape.hpp"
 #include "../timer.hpp"
 #include "dlnodesession.hpp"
 #include "nodestreamidguard.hpp"
+#include "tensor_pool.hpp"
 
 namespace ovms {
 
@@ -51,12 +53,17 @@ DLNode::DLNode(const std::string& nodeName,
     std::optional<model_version_t> modelVersion,
     ModelManager& modelManager,
     std::unordered_map<std::string, std::string> nodeOutputNameAlias,
-    std::optional<int32_t> demultiplyCount, std::set<std::string> gatherFromNode) :
+    std::optional<int32_t> demultiplyCount, std::set<std::string> gatherFromNode,
+    std::optional<std::string> batchedShardsOf) :
     Node(nodeName, demultiplyCount, std::move(gatherFromNode)),
     modelName(modelName),
     modelVersion(modelVersion),
     modelManager(modelManager),
-    nodeOutputNameAlias(std::move(nodeOutputNameAlias)) {
+    nodeOutputNameAlias(std::move(nodeOutputNameAlias)),
+    batchedShardsOf(std::move(batchedShardsOf)) {
+    if (this->batchedShardsOf) {
+        this->demultiplexerName = this->batchedShardsOf.value();
+    }
 }
 
 Status DLNode::execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
@@ -108,7 +115,8 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
         sessionKey,
         ovInferTime / 1000);
 
-    static_cast<DLNodeSession&>(this->getNodeSession(sessionKey)).clearInputs();
+    auto& dlNodeSession = static_cast<DLNodeSession&>(this->getNodeSession(sessionKey));
+    dlNodeSession.clearInputs();
 
     // Fill outputs map with result tensors. Fetch only those that are required in following nodes.
     for (const auto& node : this->next) {
@@ -127,10 +135,16 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Getting tensor from model: {}, inferRequestStreamId: {}, tensorName: {}",
                     getName(), sessionKey, modelName, sessionKey, realModelOutputName);
                 const auto tensor = inferRequest.get_tensor(realModelOutputName);
+                if (dlNodeSession.isOutputPreallocated(realModelOutputName)) {
+                    // Tensor was set by the session before inference and is not reused by infer request after release
+                    outputs.emplace(std::make_pair(output_name, TensorWithSource(tensor)));
+                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared", getName(), sessionKey, output_name);
+                    continue;
+                }
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Creating copy of tensor from model: {}, tensorName: {}",
                     getName(), sessionKey, modelName, realModelOutputName);
                 ov::Tensor copiedTensor;
-                auto status = tensorClone(copiedTensor, tensor);
+                auto status = this->tensorPool ? this->tensorPool->cloneTensor(copiedTensor, tensor) : tensorClone(copiedTensor, tensor);
                 if (!status.ok()) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Could not clone result tensor; node: {}; session: {}; model name: {}; output: {}",
                         getName(),
@@ -138,6 +152,7 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
                         realModelOutputName);
                     return status;
                 }
+                this->bytesCopied += copiedTensor.get_byte_size();
                 outputs.emplace(std::make_pair(output_name, TensorWithSource(std::move(copiedTensor))));
             } catch (const ov::Exception& e) {
                 Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
@@ -147,6 +162,27 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared", getName(), sessionKey, output_name);
         }
     }
+    if (dlNodeSession.getBatchedShardsCount() > 0) {
+        return splitBatchIntoShards(outputs, dlNodeSession.getBatchedShardsCount());
+    }
+    return StatusCode::OK;
+}
+
+Status DLNode::splitBatchIntoShards(TensorWithSourceMap& outputs, size_t shardsCount) {
+    // Restore shards dimension so outputs can be demultiplied as if shards were inferred separately
+    for (auto& [name, tensorWithSource] : outputs) {
+        auto& tensor = tensorWithSource.getActualTensor();
+        auto shape = tensor.get_shape();
+        if (shape.empty() || shape[0] % shardsCount != 0) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} output: {} with shape: {} cannot be split into: {} shards",
+                getName(), name, shapeToString(shape), shardsCount);
+            return StatusCode::PIPELINE_WRONG_DIMENSION_SIZE_TO_DEMULTIPLY;
+        }
+        shape[0] /= shardsCount;
+        shape.insert(shape.begin(), shardsCount);
+        auto shardedTensor = createTensorWithNoDataOwnership(tensor.get_element_type(), shape, tensor.data());
+        tensorWithSource = TensorWithSource(shardedTensor, tensor);
+    }
     return StatusCode::OK;
 }
 
@@ -158,9 +194,21 @@ bool DLNode::tryDisarm(const session_key_t& sessionKey, const uint microseconds)
     return getNodeSession(sessionKey).tryDisarm(microseconds);
 }
 
+std::set<std::string> DLNode::getRequiredModelOutputs() {
+    std::set<std::string> modelOutputs;
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            auto it = nodeOutputNameAlias.find(pair.first);
+            modelOutputs.emplace(it != nodeOutputNameAlias.end() ? it->second : pair.first);
+        }
+    }
+    return modelOutputs;
+}
+
 std::unique_ptr<NodeSession> DLNode::createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails) {
     return std::make_unique<DLNodeSession>(metadata, getName(), previous.size(), collapsingDetails,
-        this->modelManager, this->modelName, this->modelVersion.value_or(0));
+        this->modelManager, this->modelName, this->modelVersion.value_or(0), getRequiredModelOutputs(),
+        this->batchedShardsOf ? this->demultiplexCount : std::nullopt);
 }
 
 }  // namespace ovms
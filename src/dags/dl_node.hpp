@@ -41,6 +41,8 @@ protected:
     std::optional<model_version_t> modelVersion;
     ModelManager& modelManager;
     const std::unordered_map<std::string, std::string> nodeOutputNameAlias;
+    // Demultiplexer dependency which shards are run by this node as single batched inference
+    const std::optional<std::string> batchedShardsOf;
 
     std::shared_ptr<ModelInstance> model;
     std::unique_ptr<NodeStreamIdGuard> nodeStreamIdGuard;
@@ -50,7 +52,8 @@ public:
     DLNode(const std::string& nodeName, const std::string& modelName, std::optional<model_version_t> modelVersion,
         ModelManager& modelManager,
         std::unordered_map<std::string, std::string> nodeOutputNameAlias = {},
-        std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {});
+        std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {},
+        std::optional<std::string> batchedShardsOf = std::nullopt);
 
     Status execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) override;
 
@@ -58,6 +61,8 @@ public:
 
 private:
     Status fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, session_key_t sessionKey);
+    std::set<std::string> getRequiredModelOutputs();
+    Status splitBatchIntoShards(TensorWithSourceMap& outputs, size_t shardsCount);
 
 public:
     void release(session_key_t sessionId) override;
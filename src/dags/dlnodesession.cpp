@@ -17,7 +17,9 @@
 #include "dlnodesession.hpp"
 
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 
 #include "../logging.hpp"
 #include "../modelinstance.hpp"
@@ -32,32 +34,84 @@
 #include "nodeinputhandler.hpp"
 #include "nodeoutputhandler.hpp"
 #include "nodestreamidguard.hpp"
+#include "tensor_pool.hpp"
 
 namespace ovms {
-DLNodeSession::DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion) :
+DLNodeSession::DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> outputsToPreallocate, std::optional<int32_t> batchedShardsDemultiplyCount) :
     NodeSession(metadata, nodeName, inputsCount, collapsingDetails),
     modelManager(manager),
     modelName(modelName),
-    modelVersion(modelVersion) {}
+    modelVersion(modelVersion),
+    outputsToPreallocate(std::move(outputsToPreallocate)),
+    batchedShardsDemultiplyCount(batchedShardsDemultiplyCount) {}
 
-DLNodeSession::DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion) :
+DLNodeSession::DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> outputsToPreallocate, std::optional<int32_t> batchedShardsDemultiplyCount) :
     NodeSession(std::move(metadata), nodeName, inputsCount, collapsingDetails),
     modelManager(manager),
     modelName(modelName),
-    modelVersion(modelVersion) {}
+    modelVersion(modelVersion),
+    outputsToPreallocate(std::move(outputsToPreallocate)),
+    batchedShardsDemultiplyCount(batchedShardsDemultiplyCount) {}
 
 DLNodeSession::~DLNodeSession() = default;
 
 void DLNodeSession::clearInputs() {
+    this->batchedInputs.clear();
     this->inputHandler->clearInputs();
 }
 
+const TensorMap& DLNodeSession::getInputsForInference() {
+    if (this->batchedShardsDemultiplyCount) {
+        return this->batchedInputs;
+    }
+    return this->inputHandler->getInputs();
+}
+
+Status DLNodeSession::mergeShardsIntoBatch() {
+    OVMS_PROFILE_FUNCTION();
+    // Inputs are not demultiplied by dependency, so shards are consecutive in memory and
+    // merging first two dimensions gives the batch without copying
+    this->batchedInputs.clear();
+    this->batchedShardsCount = 0;
+    for (const auto& [name, tensor] : this->inputHandler->getInputs()) {
+        auto shape = tensor.get_shape();
+        if (tensor.get_element_type() == ov::element::Type_t::string) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "String demultiplication is unsupported");
+            return StatusCode::PIPELINE_STRING_DEMUILTIPLICATION_UNSUPPORTED;
+        }
+        if (shape.size() < 3) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Wrong number of dimensions: {} to demultiply. Must be at least 3", shape.size());
+            return StatusCode::PIPELINE_WRONG_NUMBER_OF_DIMENSIONS_TO_DEMULTIPLY;
+        }
+        if ((this->batchedShardsDemultiplyCount.value() != -1) &&
+            (shape[0] != static_cast<size_t>(this->batchedShardsDemultiplyCount.value()))) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Wrong dim[0] size: {} of tensor: {} expected: {} to demultiply",
+                shape[0], name, this->batchedShardsDemultiplyCount.value());
+            return StatusCode::PIPELINE_WRONG_DIMENSION_SIZE_TO_DEMULTIPLY;
+        }
+        if (shape[0] == 0) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} has no shards to batch. Dynamic demultiplexer with demultiply == 0 is not supported yet.", getName());
+            return StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS;
+        }
+        if (this->batchedShardsCount != 0 && this->batchedShardsCount != shape[0]) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} input: {} has: {} shards while other inputs have: {}", getName(), name, shape[0], this->batchedShardsCount);
+            return StatusCode::PIPELINE_INCONSISTENT_SHARD_DIMENSIONS;
+        }
+        this->batchedShardsCount = shape[0];
+        shape_t batchedShape(shape.begin() + 1, shape.end());
+        batchedShape[0] *= this->batchedShardsCount;
+        this->batchedInputs.emplace(name, createTensorWithNoDataOwnership(tensor.get_element_type(), batchedShape, tensor.data()));
+    }
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} will run: {} shards as single inference", getName(), getSessionKey(), this->batchedShardsCount);
+    return StatusCode::OK;
+}
+
 ModelInstance& DLNodeSession::getModelInstance() {
     return *this->model;
 }
 
 ov::InferRequest& DLNodeSession::getInferRequest(const uint microseconds) {
-    auto& inferRequestsQueue = this->model->getInferRequestsQueue();
+    auto& inferRequestsQueue = *this->modelSnapshot->inferRequestsQueue;
     auto streamIdOpt = this->nodeStreamIdGuard->tryGetId(microseconds);
     if (!streamIdOpt) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to get streamId on already executed node: {} model: {} session: {}", getName(), getModelName(), getSessionKey());
@@ -78,22 +132,33 @@ Status DLNodeSession::requestExecuteRequiredResources() {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Getting model: {} instance failed for node: {} session: {} with: {}", getModelName(), getName(), getSessionKey(), status.string());
         return status;
     }
+    this->modelSnapshot = this->modelUnloadGuard->getSnapshot();
+    if (!this->modelSnapshot) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Model: {} for node: {} session: {} is not loaded anymore", getModelName(), getName(), getSessionKey());
+        return StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE;
+    }
 
     status = prepareInputsAndModelForInference();
     if (!status.ok()) {
         return status;
     }
     this->timer->start(GET_INFER_REQUEST);
-    this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(model->getInferRequestsQueue(), model->getMetricReporter());
+    this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(*this->modelSnapshot->inferRequestsQueue, model->getMetricReporter());
     return status;
 }
 
 Status DLNodeSession::prepareInputsAndModelForInference() {
     OVMS_PROFILE_FUNCTION();
     // Validate each tensor against its OV tensor info
-    const auto& inputsInfo = this->model->getInputsInfo();
+    const auto& inputsInfo = this->modelSnapshot->inputsInfo;
     Status status;
-    for (const auto& kv : this->inputHandler->getInputs()) {
+    if (this->batchedShardsDemultiplyCount) {
+        status = mergeShardsIntoBatch();
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    for (const auto& kv : getInputsForInference()) {
         const auto& name = kv.first;
         auto& tensor = kv.second;
 
@@ -216,7 +281,7 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Could not acquire stream Id right away", getName());
         return StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET;
     }
-    auto& inferRequestsQueue = this->model->getInferRequestsQueue();
+    auto& inferRequestsQueue = *this->modelSnapshot->inferRequestsQueue;
     auto& inferRequest = inferRequestsQueue.getInferRequest(streamIdOpt.value());
     this->timer->stop(GET_INFER_REQUEST);
     double getInferRequestTime = this->timer->elapsed<std::chrono::microseconds>(GET_INFER_REQUEST);
@@ -226,6 +291,7 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
         notifyEndQueue.push({node, getSessionKey()});
         return status;
     }
+    setOutputsForInference(inferRequest);
     status = executeInference(notifyEndQueue, inferRequest, node);
     if (!status.ok()) {
         notifyEndQueue.push({node, getSessionKey()});
@@ -235,8 +301,9 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
 }
 
 Status DLNodeSession::getRealInputName(const std::string& alias, std::string* result) const {
-    auto it = this->model->getInputsInfo().find(alias);
-    if (it == this->model->getInputsInfo().end()) {
+    const auto& inputsInfo = this->modelSnapshot->inputsInfo;
+    auto it = inputsInfo.find(alias);
+    if (it == inputsInfo.end()) {
         return StatusCode::INVALID_MISSING_INPUT;
     }
     *result = it->second->getName();
@@ -248,7 +315,7 @@ Status DLNodeSession::setInputsForInference(ov::InferRequest& inferRequest) {
     Status status = StatusCode::OK;
     try {
         // Prepare inference request, fill with input tensors
-        for (const auto& [name, tensor] : this->inputHandler->getInputs()) {
+        for (const auto& [name, tensor] : getInputsForInference()) {
             std::string realModelInputName;
             if (!getRealInputName(name, &realModelInputName).ok()) {
                 SPDLOG_LOGGER_WARN(dag_executor_logger, "DLNode::{} [Node name: {}]; cannot find real model:{} input name for alias: {}",
@@ -274,6 +341,57 @@ Status DLNodeSession::setInputsForInference(ov::InferRequest& inferRequest) {
     return status;
 }
 
+void DLNodeSession::setOutputsForInference(ov::InferRequest& inferRequest) {
+    OVMS_PROFILE_FUNCTION();
+    this->inferRequestWithReplacedOutputs = &inferRequest;
+    for (const auto& name : this->outputsToPreallocate) {
+        auto it = this->modelSnapshot->outputsInfo.find(name);
+        if (it == this->modelSnapshot->outputsInfo.end()) {
+            continue;
+        }
+        const auto& info = it->second;
+        // Outputs with shape known only after inference are copied in fetchResults
+        if (info->getShape().isDynamic() || info->getPrecision() == Precision::STRING) {
+            continue;
+        }
+        const auto& realName = info->getName();
+        try {
+            ov::Tensor tensor;
+            const auto shape = info->getShape().createPartialShape().get_shape();
+            auto status = this->tensorPool ? this->tensorPool->createTensor(tensor, info->getOvPrecision(), shape) : createSharedTensor(tensor, info->getOvPrecision(), shape);
+            if (!status.ok()) {
+                continue;
+            }
+            auto original = inferRequest.get_tensor(realName);
+            inferRequest.set_tensor(realName, tensor);
+            this->replacedOutputs.emplace(realName, std::move(original));
+        } catch (const std::exception& e) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Could not set output tensor: {} for model: {}, output will be copied; error: {}",
+                getName(), realName, getModelName(), e.what());
+        }
+    }
+}
+
+bool DLNodeSession::isOutputPreallocated(const std::string& realOutputName) const {
+    return this->replacedOutputs.find(realOutputName) != this->replacedOutputs.end();
+}
+
+void DLNodeSession::restoreReplacedOutputs() {
+    if (this->inferRequestWithReplacedOutputs == nullptr) {
+        return;
+    }
+    for (auto& [realName, original] : this->replacedOutputs) {
+        try {
+            this->inferRequestWithReplacedOutputs->set_tensor(realName, original);
+        } catch (const std::exception& e) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Could not restore output tensor: {} for model: {}; error: {}",
+                getName(), realName, getModelName(), e.what());
+        }
+    }
+    this->replacedOutputs.clear();
+    this->inferRequestWithReplacedOutputs = nullptr;
+}
+
 Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::InferRequest& inferRequest, Node& node) {
     OVMS_PROFILE_FUNCTION();
     try {
@@ -283,7 +401,7 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
             this->timer->stop(EXECUTE);
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Completion callback received for node name: {}", this->getName());
             // After inference is completed, input tensors are not needed anymore
-            this->inputHandler->clearInputs();
+            this->clearInputs();
             notifyEndQueue.push({node, getSessionKey()});
             inferRequest.set_callback([](std::exception_ptr exception_ptr) {});  // reset callback on infer request
         });
@@ -310,7 +428,10 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
 }
 
 void DLNodeSession::release() {
+    // Infer request must get back its own output tensors before stream id is returned
+    restoreReplacedOutputs();
     this->nodeStreamIdGuard.reset();
+    this->modelSnapshot.reset();
     this->model.reset();
     this->modelUnloadGuard.reset();
 }
@@ -17,7 +17,9 @@
 
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <openvino/openvino.hpp>
@@ -25,11 +27,13 @@
 #include "../modelversion.hpp"
 #include "nodesession.hpp"
 #include "pipelineeventqueue.hpp"
+#include "tensormap.hpp"
 
 namespace ovms {
 
 class ModelManager;
 class ModelInstance;
+struct ModelInstanceSnapshot;
 class Node;
 class NodeStreamIdGuard;
 class ModelInstanceUnloadGuard;
@@ -40,21 +44,39 @@ class DLNodeSession : public NodeSession {
     std::shared_ptr<ModelInstance> model;
     std::unique_ptr<NodeStreamIdGuard> nodeStreamIdGuard;
     std::unique_ptr<ModelInstanceUnloadGuard> modelUnloadGuard;
+    // Compiled model and infer requests pinned by modelUnloadGuard, used for whole node execution
+    std::shared_ptr<const ModelInstanceSnapshot> modelSnapshot;
 
     ModelManager& modelManager;
     const std::string& modelName;
     const model_version_t modelVersion;
 
+    // Model outputs required by following nodes, written directly into tensors owned by the session
+    const std::set<std::string> outputsToPreallocate;
+    // Tensors replaced in infer request, restored on release so the request can be reused by other requests
+    std::unordered_map<std::string, ov::Tensor> replacedOutputs;
+    ov::InferRequest* inferRequestWithReplacedOutputs = nullptr;
+
+    // Demultiply count of dependency when its shards are run as single batched inference
+    const std::optional<int32_t> batchedShardsDemultiplyCount;
+    // Input shards merged into batch, views of tensors held by input handler
+    TensorMap batchedInputs;
+    size_t batchedShardsCount = 0;
+
 public:
-    DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion);
-    DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion);
+    DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> outputsToPreallocate = {}, std::optional<int32_t> batchedShardsDemultiplyCount = std::nullopt);
+    DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> outputsToPreallocate = {}, std::optional<int32_t> batchedShardsDemultiplyCount = std::nullopt);
     virtual ~DLNodeSession();
 
     ov::InferRequest& getInferRequest(const uint microseconds);
     ModelInstance& getModelInstance();
+    size_t getBatchedShardsCount() const { return batchedShardsCount; }
 
 private:
     Status requestExecuteRequiredResources();
+    void restoreReplacedOutputs();
+    Status mergeShardsIntoBatch();
+    const TensorMap& getInputsForInference();
 
 public:
     Status prepareInputsAndModelForInference();
@@ -62,6 +84,8 @@ public:
     Status execute(PipelineEventQueue& notifyEndQueue, uint waitForStreamIdTimeoutMicroseconds, Node& node);
     Status executeInference(PipelineEventQueue& notifyEndQueue, ov::InferRequest&, Node& node);
     Status setInputsForInference(ov::InferRequest& inferRequest);
+    void setOutputsForInference(ov::InferRequest& inferRequest);
+    bool isOutputPreallocated(const std::string& realOutputName) const;
     Status getRealInputName(const std::string& alias, std::string* result) const;
     void release() override;
 
@@ -114,6 +114,14 @@ Status EntryNode<RequestType>::createShardedTensor(ov::Tensor& dividedTensor, Pr
 template <typename RequestType>
 const Status EntryNode<RequestType>::validate() {
     static const std::set<std::string> optionalInputNames = {};
+    if (validationPlan) {
+        return request_validation_utils::validate(
+            *request,
+            *validationPlan,
+            getRequestServableName(*request),
+            1,
+            optionalInputNames);  // Pipelines are not versioned and always reports version 1
+    }
     return request_validation_utils::validate(
         *request,
         inputsInfo,
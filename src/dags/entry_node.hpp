@@ -17,6 +17,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
 #include <openvino/openvino.hpp>
 
@@ -25,6 +26,9 @@
 #include "node.hpp"
 
 namespace ovms {
+namespace request_validation_utils {
+class ValidationPlan;
+}  // namespace request_validation_utils
 
 extern const std::string ENTRY_NODE_NAME;
 
@@ -32,14 +36,18 @@ template <typename RequestType>
 class EntryNode : public Node {
     const RequestType* request;
     const tensor_map_t inputsInfo;
+    // Validation plan cached by pipeline definition, nullptr if not available
+    const std::shared_ptr<const request_validation_utils::ValidationPlan> validationPlan;
 
 public:
     EntryNode(const RequestType* request,
         const tensor_map_t& inputsInfo,
-        std::optional<int32_t> demultiplyCount = std::nullopt) :
+        std::optional<int32_t> demultiplyCount = std::nullopt,
+        std::shared_ptr<const request_validation_utils::ValidationPlan> validationPlan = nullptr) :
         Node(ENTRY_NODE_NAME, demultiplyCount),
         request(request),
-        inputsInfo(inputsInfo) {}
+        inputsInfo(inputsInfo),
+        validationPlan(std::move(validationPlan)) {}
 
     Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override;
 
@@ -51,6 +51,9 @@ class GatherExitNodeInputHandler : public GatherNodeInputHandler {
         return StatusCode::OK;
     }
 
+    // shards have to be written into response buffer
+    bool isInPlaceGatheringAllowed() const override { return false; }
+
 public:
     GatherExitNodeInputHandler(uint32_t inputsMissingCount, const CollapseDetails& collapsingDetails, ResponseType* response) :
         GatherNodeInputHandler(inputsMissingCount, collapsingDetails),
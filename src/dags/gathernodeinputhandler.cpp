@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <numeric>
+#include <sstream>
 
 #include "../logging.hpp"
 #include "../ov_utils.hpp"
@@ -24,93 +26,148 @@
 #include "../status.hpp"
 #include "../tensorinfo.hpp"
 #include "nodesessionmetadata.hpp"
+#include "tensor_pool.hpp"
 
 namespace ovms {
 
 GatherNodeInputHandler::GatherNodeInputHandler(uint32_t inputsMissingCount, const CollapseDetails& collapsingDetails) :
     NodeInputHandler(inputsMissingCount),
     collapsingDetails(std::make_unique<CollapseDetails>(collapsingDetails)) {
-    remainingDependencies = std::accumulate(
+    shardsCount = std::accumulate(
         collapsingDetails.collapsedSessionSizes.begin(),
         collapsingDetails.collapsedSessionSizes.end(),
-        remainingDependencies,
-        std::multiplies<session_id_t>());
+        size_t(1),
+        std::multiplies<size_t>());
+    remainingDependencies *= shardsCount;
 }
 
 Status GatherNodeInputHandler::setInput(const std::string& inputName, TensorWithSource& tensor, session_id_t shardId) {
-    auto inputsShardsIt = shardsStorage.find(inputName);
-    if (inputsShardsIt == shardsStorage.end()) {
-        shard_map_t shardMap{{shardId, tensor.getActualTensor()}};
-        auto itDidInsertPair = shardsStorage.emplace(inputName, std::move(shardMap));
-        if (!itDidInsertPair.second) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to insert the same input: {} twice with the same shardId: {}", inputName, shardId);
-            return StatusCode::INTERNAL_ERROR;
-        }
-    } else {
-        auto itDidEmplacePair = inputsShardsIt->second.emplace(shardId, tensor.getActualTensor());
-        if (!itDidEmplacePair.second) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to put the same input: {} shard: {} twice", inputName, shardId);
-            return StatusCode::INTERNAL_ERROR;
+    auto& input = gatheredInputs[inputName];
+    if (!input.receivedShards.insert(shardId).second) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to put the same input: {} shard: {} twice", inputName, shardId);
+        return StatusCode::INTERNAL_ERROR;
+    }
+    input.pendingShards.emplace_back(shardId, tensor);
+    return StatusCode::OK;
+}
+
+static bool isShardInSlice(TensorWithSource& shard, const ov::Tensor& consolidatedTensor, session_id_t shardId) {
+    if (!shard.hasSource()) {
+        return false;
+    }
+    auto& source = shard.getSourceTensor();
+    auto& tensor = shard.getActualTensor();
+    return (source.data() == consolidatedTensor.data()) &&
+           (source.get_byte_size() == consolidatedTensor.get_byte_size()) &&
+           ((char*)tensor.data() == (char*)consolidatedTensor.data() + shardId * tensor.get_byte_size());
+}
+
+Status GatherNodeInputHandler::prepareGatheredInput(const std::string& inputName, GatheredInput& input, TensorWithSource& firstShard, session_id_t shardId) {
+    auto& tensor = firstShard.getActualTensor();
+    input.precision = tensor.get_element_type();
+    input.shardShape = tensor.get_shape();
+    auto newDims = input.shardShape;
+    newDims.insert(newDims.begin(),
+        collapsingDetails->collapsedSessionSizes.begin(),
+        collapsingDetails->collapsedSessionSizes.end());
+    if (isInPlaceGatheringAllowed() && firstShard.hasSource() &&
+        (firstShard.getSourceTensor().get_byte_size() == tensor.get_byte_size() * shardsCount)) {
+        auto& source = firstShard.getSourceTensor();
+        input.consolidatedTensor = createTensorWithNoDataOwnership(input.precision, newDims, source.data());
+        if (isShardInSlice(firstShard, input.consolidatedTensor, shardId)) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Gathering input: {} in place of upstream tensor", inputName);
+            input.isGatheredInPlace = true;
+            sourceTensorRefs.push_back(source);
+            return StatusCode::OK;
         }
     }
-    if (tensor.hasSource()) {
-        sourceTensorRefs.push_back(tensor.getSourceTensor());
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Preparing consolidated tensor for: {} shards of input: {}", shardsCount, inputName);
+    return prepareConsolidatedTensor(input.consolidatedTensor, inputName, input.precision, newDims);
+}
+
+Status GatherNodeInputHandler::detachFromSourceTensor(const std::string& inputName, GatheredInput& input) {
+    OVMS_PROFILE_FUNCTION();
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Shards of input: {} are not laid out in single upstream tensor, copying already gathered shards", inputName);
+    ov::Tensor consolidatedTensor;
+    auto status = prepareConsolidatedTensor(consolidatedTensor, inputName, input.precision, input.consolidatedTensor.get_shape());
+    if (!status.ok()) {
+        return status;
     }
+    memcpy(consolidatedTensor.data(), input.consolidatedTensor.data(), consolidatedTensor.get_byte_size());
+    input.consolidatedTensor = consolidatedTensor;
+    input.isGatheredInPlace = false;
+    return StatusCode::OK;
+}
+
+Status GatherNodeInputHandler::gatherPendingShards(const std::string& inputName, GatheredInput& input) {
+    OVMS_PROFILE_FUNCTION();
+    for (auto& [shardId, shard] : input.pendingShards) {
+        auto& tensor = shard.getActualTensor();
+        if (!input.consolidatedTensor) {
+            auto status = prepareGatheredInput(inputName, input, shard, shardId);
+            if (!status.ok()) {
+                return status;
+            }
+        } else if ((tensor.get_element_type() != input.precision) ||
+                   (tensor.get_shape() != input.shardShape)) {
+            std::stringstream firstShardShapeStream;
+            firstShardShapeStream << input.shardShape;
+            auto currentShardShape = tensor.get_shape();
+            std::stringstream currentShardShapeStream;
+            currentShardShapeStream << currentShardShape;
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to consolidate tensor: {}; shards in gather node. First shard has different tensor precision: {}; or shape: {}; than current shard precision: {}; shape: {};",
+                inputName,
+                toString(ovElementTypeToOvmsPrecision(input.precision)),
+                firstShardShapeStream.str(),
+                toString(ovElementTypeToOvmsPrecision(tensor.get_element_type())),
+                currentShardShapeStream.str());
+            return StatusCode::PIPELINE_INCONSISTENT_SHARD_DIMENSIONS;
+        }
+        if (input.isGatheredInPlace) {
+            if (isShardInSlice(shard, input.consolidatedTensor, shardId)) {
+                continue;
+            }
+            auto status = detachFromSourceTensor(inputName, input);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        OVMS_PROFILE_SCOPE("Copy Shard");
+        const auto memstep = tensor.get_byte_size();
+        size_t offset = shardId * memstep;
+        memcpy((char*)input.consolidatedTensor.data() + offset,
+            tensor.data(),
+            memstep);
+    }
+    // shards are copied or kept alive by consolidated tensor source so upstream tensors can be released
+    input.pendingShards.clear();
     return StatusCode::OK;
 }
 
 Status GatherNodeInputHandler::notifyFinishedDependency() {
     OVMS_PROFILE_FUNCTION();
     NodeInputHandler::notifyFinishedDependency();
-    if (remainingDependencies > 0) {
-        return StatusCode::OK;
-    }
-    for (auto& [inputName, shardMap] : shardsStorage) {
+    for (auto& [inputName, input] : gatheredInputs) {
         OVMS_PROFILE_SCOPE("Gather Tensor");
-        const auto shardsCount = shardMap.size();
-        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Consolidating: {} shards for input: {}", shardsCount, inputName);
-        session_id_t firstShardId = 0;
-        auto firstShard = shardMap.at(firstShardId);
-        auto firstShardDims = firstShard.get_shape();
-        auto precision = firstShard.get_element_type();
-        auto newDims = firstShardDims;
-        newDims.insert(newDims.begin(),
-            collapsingDetails->collapsedSessionSizes.begin(),
-            collapsingDetails->collapsedSessionSizes.end());
-        ov::Tensor consolidatedTensor;
-        auto status = prepareConsolidatedTensor(consolidatedTensor, inputName, precision, newDims);
+        auto status = gatherPendingShards(inputName, input);
         if (!status.ok()) {
             return status;
         }
-        for (auto& [shardId, tensor] : shardMap) {
-            OVMS_PROFILE_SCOPE("Copy Shard");
-            if ((tensor.get_element_type() != precision) ||
-                (tensor.get_shape() != firstShardDims)) {
-                std::stringstream firstShardShapeStream;
-                firstShardShapeStream << firstShardDims;
-                auto currentShardShape = tensor.get_shape();
-                std::stringstream currentShardShapeStream;
-                currentShardShapeStream << currentShardShape;
-                SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to consolidate tensor: {}; shards in gather node. First shard has different tensor precision: {}; or shape: {}; than current shard precision: {}; shape: {};",
-                    inputName,
-                    toString(ovElementTypeToOvmsPrecision(precision)),
-                    firstShardShapeStream.str(),
-                    toString(ovElementTypeToOvmsPrecision(tensor.get_element_type())),
-                    currentShardShapeStream.str());
-                return StatusCode::PIPELINE_INCONSISTENT_SHARD_DIMENSIONS;
-            }
-            const auto memstep = tensor.get_byte_size();
-            size_t offset = shardId * memstep;
-            memcpy((char*)consolidatedTensor.data() + offset,
-                tensor.data(),
-                memstep);
-        }
-        inputTensors.insert({inputName, consolidatedTensor});
+    }
+    if (remainingDependencies > 0) {
+        return StatusCode::OK;
+    }
+    for (auto& [inputName, input] : gatheredInputs) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Consolidated: {} shards for input: {}", input.receivedShards.size(), inputName);
+        inputTensors.insert({inputName, input.consolidatedTensor});
     }
     return StatusCode::OK;
 }
 
 Status GatherNodeInputHandler::prepareConsolidatedTensor(ov::Tensor& tensorOut, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape) const {
+    if (tensorPool) {
+        return tensorPool->createTensor(tensorOut, precision, shape);
+    }
     return createSharedTensor(tensorOut, precision, shape);
 }
 
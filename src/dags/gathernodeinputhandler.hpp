@@ -18,24 +18,42 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <openvino/openvino.hpp>
 
 #include "../precision.hpp"
 #include "../shape.hpp"
+#include "../tensor_utils.hpp"
 #include "nodeinputhandler.hpp"
 #include "session_id.hpp"
 
 namespace ovms {
 
-using shard_map_t = std::unordered_map<session_id_t, ov::Tensor>;
-
 class CollapseDetails;
 
 class GatherNodeInputHandler : public NodeInputHandler {
-    std::unordered_map<std::string, shard_map_t> shardsStorage;
+    /**
+     * @brief Consolidated tensor of single input with shards received since last dependency notification
+     */
+    struct GatheredInput {
+        ov::Tensor consolidatedTensor;
+        ov::element::Type_t precision;
+        ov::Shape shardShape;
+        // consolidated tensor is a view over upstream tensor already holding shards in their slices
+        bool isGatheredInPlace = false;
+        std::unordered_set<session_id_t> receivedShards;
+        std::vector<std::pair<session_id_t, TensorWithSource>> pendingShards;
+    };
+    std::unordered_map<std::string, GatheredInput> gatheredInputs;
     std::unique_ptr<CollapseDetails> collapsingDetails;
+    size_t shardsCount;
+
+    Status gatherPendingShards(const std::string& inputName, GatheredInput& input);
+    Status prepareGatheredInput(const std::string& inputName, GatheredInput& input, TensorWithSource& firstShard, session_id_t shardId);
+    Status detachFromSourceTensor(const std::string& inputName, GatheredInput& input);
 
 public:
     GatherNodeInputHandler(uint32_t inputsMissingCount, const CollapseDetails& collapsingDetails);
@@ -44,5 +62,9 @@ public:
 
 protected:
     virtual Status prepareConsolidatedTensor(ov::Tensor& tensorOut, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape) const;
+    /**
+     * @brief Whether consolidated tensor may reuse upstream tensor memory when all shards already lay in their slices
+     */
+    virtual bool isInPlaceGatheringAllowed() const { return true; }
 };
 }  // namespace ovms
@@ -46,7 +46,8 @@ static std::string demultiplyCountSettingToString(std::optional<int32_t> demulti
 Node::Node(const std::string& nodeName, std::optional<int32_t> demultiplyCount, std::set<std::string> gatherFromNode) :
     nodeName(nodeName),
     demultiplexCount(demultiplyCount),
-    gatherFrom(!gatherFromNode.empty() ? std::optional<std::set<std::string>>(gatherFromNode) : std::nullopt) {
+    gatherFrom(!gatherFromNode.empty() ? std::optional<std::set<std::string>>(gatherFromNode) : std::nullopt),
+    demultiplexerName(nodeName) {
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will create node: {} with demultiply: {}, gatherFrom: {}.",
         getName(),
         demultiplyCountSettingToString(demultiplexCount),
@@ -182,6 +183,7 @@ NodeSession* Node::getNodeSession(const NodeSessionMetadata& metadata) {
         }
     }
     std::unique_ptr<NodeSession> nodeSession = createNodeSession(newSessionMetadata, collapsingDetails);
+    nodeSession->setTensorPool(this->tensorPool);
     auto emplacePair = nodeSessions.emplace(sessionKey, std::move(nodeSession));
     return emplacePair.first->second.get();
 }
@@ -190,6 +192,11 @@ std::unique_ptr<NodeSession> Node::createNodeSession(const NodeSessionMetadata&
     return std::make_unique<NodeSession>(metadata, getName(), previous.size(), collapsingDetails);
 }
 
+Status Node::executeBatch(const std::vector<session_key_t>& sessionKeys, PipelineEventQueue& notifyEndQueue) {
+    SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} does not support batch execution", getName());
+    return StatusCode::NOT_IMPLEMENTED;
+}
+
 std::vector<session_key_t> Node::getReadySessions() const {
     std::vector<session_key_t> readySessions;
     for (auto& [sessionKey, nodeSession] : nodeSessions) {
@@ -218,20 +225,23 @@ Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will demultiply node: {} outputs to: {} shards", getName(), resultsDemultiplyCount);
     std::vector<NodeSessionMetadata> newSessionMetadatas;
     try {
-        newSessionMetadatas = std::move(metadata.generateSubsessions(getName(), resultsDemultiplyCount));
+        newSessionMetadatas = std::move(metadata.generateSubsessions(this->demultiplexerName, resultsDemultiplyCount));
     } catch (std::exception& e) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} failed to generate subsessions due to error: {}", getName(), e.what());
         return StatusCode::INTERNAL_ERROR;
     }
     for (auto& [tensorName, tensorWithSource] : tensorMap) {
         auto& tensor = tensorWithSource.getActualTensor();
+        // Shards must keep alive the tensor owning the data
+        auto& ownerTensor = tensorWithSource.hasSource() ? tensorWithSource.getSourceTensor() : tensor;
         OVMS_PROFILE_SCOPE("Demultiply Tensor");
         if (tensor.get_element_type() == ov::element::Type_t::string) {
             SPDLOG_LOGGER_ERROR(dag_executor_logger, "String demultiplication is unsupported");
             return StatusCode::PIPELINE_STRING_DEMUILTIPLICATION_UNSUPPORTED;
         }
         auto newDims = tensor.get_shape();
-        if (newDims.size() < 3) {
+        // Outputs of node batching shards already got shards dimension restored
+        if (newDims.size() < 3 && this->demultiplexerName == getName()) {
             SPDLOG_LOGGER_ERROR(dag_executor_logger, "Wrong number of dimensions: {} to demultiply. Must be at least 3", newDims.size());
             return StatusCode::PIPELINE_WRONG_NUMBER_OF_DIMENSIONS_TO_DEMULTIPLY;
         }
@@ -262,9 +272,9 @@ Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
             auto sessionKey = newSessionMetadatas[i].getSessionKey();
             auto it = nodeSessionOutputs.find(sessionKey);
             if (it == nodeSessionOutputs.end()) {
-                nodeSessionOutputs.emplace(sessionKey, SessionResult{newSessionMetadatas[i], TensorWithSourceMap{{tensorName, TensorWithSource{dividedTensor, tensor}}}});
+                nodeSessionOutputs.emplace(sessionKey, SessionResult{newSessionMetadatas[i], TensorWithSourceMap{{tensorName, TensorWithSource{dividedTensor, ownerTensor}}}});
             } else {
-                it->second.second.emplace(tensorName, TensorWithSource{dividedTensor, tensor});
+                it->second.second.emplace(tensorName, TensorWithSource{dividedTensor, ownerTensor});
             }
         }
     }
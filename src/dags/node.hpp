@@ -39,6 +39,7 @@ using session_key_t = std::string;
 class NodeSession;
 class NodeSessionMetadata;
 class Status;
+class TensorPool;
 
 class Node {
 protected:
@@ -55,6 +56,14 @@ protected:
 
     const std::optional<int32_t> demultiplexCount;
     const std::optional<std::set<std::string>> gatherFrom;
+    // Name of node which demultiplied sessions are generated for, differs from node name when shards are batched
+    std::string demultiplexerName;
+
+    // Bytes of output tensors copied when passing results to following nodes
+    size_t bytesCopied = 0;
+
+    // Pipeline definition pool for intermediate tensors, not set when pooling is disabled
+    std::shared_ptr<TensorPool> tensorPool;
 
 public:
     Node(const std::string& nodeName, std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {});
@@ -62,8 +71,13 @@ public:
     virtual ~Node();
 
     const std::string& getName() const { return this->nodeName; }
+    size_t getBytesCopied() const { return this->bytesCopied; }
+    void setTensorPool(const std::shared_ptr<TensorPool>& tensorPool) { this->tensorPool = tensorPool; }
 
     virtual Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) = 0;
+    // Nodes supporting batch execution are executed once for all sessions ready at the same time
+    virtual bool isBatchExecutionSupported() const { return false; }
+    virtual Status executeBatch(const std::vector<session_key_t>& sessionKeys, PipelineEventQueue& notifyEndQueue);
     Status fetchResults(session_key_t sessionId, SessionResults& nodeSessionOutputs);
 
 protected:
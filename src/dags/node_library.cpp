@@ -26,4 +26,14 @@ bool NodeLibrary::isValid() const {
            deinitialize != nullptr;
 }
 
+bool NodeLibrary::hasServerAllocatedOutputs() const {
+    return getOutputsInfoForInputs != nullptr &&
+           executeWithOutputs != nullptr;
+}
+
+bool NodeLibrary::hasBatchExecution() const {
+    return hasServerAllocatedOutputs() &&
+           executeBatch != nullptr;
+}
+
 }  // namespace ovms
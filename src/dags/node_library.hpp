@@ -26,6 +26,9 @@ typedef int (*deinitialize_fn)(void*);
 typedef int (*execute_fn)(const struct CustomNodeTensor*, int, struct CustomNodeTensor**, int*, const struct CustomNodeParam*, int, void*);
 typedef int (*metadata_fn)(struct CustomNodeTensorInfo**, int*, const struct CustomNodeParam*, int, void*);
 typedef int (*release_fn)(void*, void*);
+typedef int (*outputs_info_for_inputs_fn)(struct CustomNodeTensorInfo**, int*, const struct CustomNodeTensor*, int, const struct CustomNodeParam*, int, void*);
+typedef int (*execute_with_outputs_fn)(const struct CustomNodeTensor*, int, struct CustomNodeTensor*, int, const struct CustomNodeParam*, int, void*);
+typedef int (*execute_batch_fn)(const struct CustomNodeTensor*, int, struct CustomNodeTensor*, int, int, const struct CustomNodeParam*, int, void*);
 
 struct NodeLibrary {
     initialize_fn initialize = nullptr;
@@ -34,10 +37,17 @@ struct NodeLibrary {
     metadata_fn getInputsInfo = nullptr;
     metadata_fn getOutputsInfo = nullptr;
     release_fn release = nullptr;
+    // optional, both are required for outputs allocated by the server
+    outputs_info_for_inputs_fn getOutputsInfoForInputs = nullptr;
+    execute_with_outputs_fn executeWithOutputs = nullptr;
+    // optional, executes multiple ready sessions of a node in a single call
+    execute_batch_fn executeBatch = nullptr;
 
     std::string basePath = "";
 
     bool isValid() const;
+    bool hasServerAllocatedOutputs() const;
+    bool hasBatchExecution() const;
     bool operator==(const NodeLibrary& other) const {
         return (initialize == other.initialize) &&
                (deinitialize == other.deinitialize) &&
@@ -45,6 +55,9 @@ struct NodeLibrary {
                (getInputsInfo == other.getInputsInfo) &&
                (getOutputsInfo == other.getOutputsInfo) &&
                (release == other.release) &&
+               (getOutputsInfoForInputs == other.getOutputsInfoForInputs) &&
+               (executeWithOutputs == other.executeWithOutputs) &&
+               (executeBatch == other.executeBatch) &&
                (basePath == other.basePath);
     }
 };
@@ -67,6 +67,8 @@ struct NodeInfo {
     std::set<std::string> gatherFromNode;
     NodeLibrary library;
     parameters_t parameters;
+    // Run all shards produced by demultiplexer dependency as single batched inference
+    bool batchShards;
 
     NodeInfo(NodeKind kind,
         const std::string& nodeName,
@@ -76,7 +78,8 @@ struct NodeInfo {
         std::optional<size_t> demultiplyCount = std::nullopt,
         const std::set<std::string>& gatherFromNode = {},
         const NodeLibrary& library = {},
-        const parameters_t& parameters = {}) :
+        const parameters_t& parameters = {},
+        bool batchShards = false) :
         kind(kind),
         nodeName(nodeName),
         modelName(modelName),
@@ -85,6 +88,7 @@ struct NodeInfo {
         demultiplyCount(demultiplyCount),
         gatherFromNode(gatherFromNode),
         library(library),
-        parameters(parameters) {}
+        parameters(parameters),
+        batchShards(batchShards) {}
 };
 }  // namespace ovms
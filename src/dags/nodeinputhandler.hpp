@@ -27,6 +27,7 @@
 
 namespace ovms {
 class Status;
+class TensorPool;
 class TensorWithSource;
 
 // This class encapsulates input tensor gathering and preprocessing before node execution.
@@ -38,6 +39,7 @@ protected:
     TensorVector sourceTensorRefs;
     uint32_t remainingDependencies;
     bool isUsed = false;
+    std::shared_ptr<TensorPool> tensorPool;
 
 public:
     NodeInputHandler(uint32_t inputsMissingCount);
@@ -47,6 +49,7 @@ public:
         return inputTensors;
     }
     void clearInputs();
+    void setTensorPool(const std::shared_ptr<TensorPool>& tensorPool) { this->tensorPool = tensorPool; }
     bool isReady();
     virtual Status notifyFinishedDependency();
     virtual ~NodeInputHandler() = default;
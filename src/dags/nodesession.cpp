@@ -64,6 +64,11 @@ Timer<TIMER_END>& NodeSession::getTimer() const {
     return *this->timer;
 }
 
+void NodeSession::setTensorPool(const std::shared_ptr<TensorPool>& tensorPool) {
+    this->tensorPool = tensorPool;
+    this->inputHandler->setTensorPool(tensorPool);
+}
+
 ReleaseSessionGuard::ReleaseSessionGuard(NodeSession& nodeSession) :
     nodeSession(nodeSession) {}
 
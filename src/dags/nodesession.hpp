@@ -25,6 +25,7 @@ namespace ovms {
 struct NodeInputHandler;
 struct NodeOutputHandler;
 class Status;
+class TensorPool;
 class TensorWithSource;
 template <unsigned int N>
 class Timer;
@@ -44,6 +45,7 @@ protected:
     std::unique_ptr<Timer<TIMER_END>> timer;
     std::unique_ptr<NodeInputHandler> inputHandler;
     std::unique_ptr<NodeOutputHandler> outputHandler;
+    std::shared_ptr<TensorPool> tensorPool;
 
 public:
     NodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails);
@@ -57,6 +59,7 @@ public:
     virtual bool tryDisarm(uint microseconds) { return true; }
     Status notifyFinishedDependency();
     Timer<TIMER_END>& getTimer() const;
+    void setTensorPool(const std::shared_ptr<TensorPool>& tensorPool);
 };
 
 class ReleaseSessionGuard {
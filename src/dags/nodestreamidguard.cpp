@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "nodestreamidguard.hpp"
 
+#include <chrono>
 #include <future>
 #include <optional>
 
@@ -30,6 +31,17 @@ NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, M
     futureStreamId(inferRequestsQueue_.getIdleStream()),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
+    if (this->futureStreamId.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        this->waiting = true;
+        INCREMENT_IF_ENABLED(this->reporter.inferReqWaiting);
+    }
+}
+
+void NodeStreamIdGuard::stopWaiting() {
+    if (this->waiting) {
+        this->waiting = false;
+        DECREMENT_IF_ENABLED(this->reporter.inferReqWaiting);
+    }
 }
 
 NodeStreamIdGuard::~NodeStreamIdGuard() {
@@ -37,6 +49,7 @@ NodeStreamIdGuard::~NodeStreamIdGuard() {
         if (!this->streamId) {
             SPDLOG_DEBUG("Trying to disarm stream Id that is not needed anymore...");
             this->streamId = this->futureStreamId.get();
+            this->stopWaiting();
             INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
         }
         SPDLOG_DEBUG("Returning streamId: {}", this->streamId.value());
@@ -51,7 +64,9 @@ std::optional<int> NodeStreamIdGuard::tryGetId(const uint microseconds) {
     if (!this->streamId) {
         if (std::future_status::ready == this->futureStreamId.wait_for(std::chrono::microseconds(microseconds))) {
             this->streamId = this->futureStreamId.get();
+            this->stopWaiting();
             INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+            OBSERVE_IF_ENABLED(this->reporter.inferReqUtilization, static_cast<double>(this->inferRequestsQueue_.getStreamsInUse()) / this->inferRequestsQueue_.getSize());
         }
     }
     return this->streamId;
@@ -60,6 +75,7 @@ std::optional<int> NodeStreamIdGuard::tryGetId(const uint microseconds) {
 bool NodeStreamIdGuard::tryDisarm(const uint microseconds) {
     if (std::future_status::ready == this->futureStreamId.wait_for(std::chrono::microseconds(microseconds))) {
         this->streamId = this->futureStreamId.get();
+        this->stopWaiting();
         SPDLOG_DEBUG("Returning streamId:", this->streamId.value());
         this->inferRequestsQueue_.returnStream(this->streamId.value());
         DECREMENT_IF_ENABLED(this->reporter.currentRequests);
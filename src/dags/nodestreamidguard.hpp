@@ -32,10 +32,13 @@ struct NodeStreamIdGuard {
     bool tryDisarm(const uint microseconds = 1);
 
 private:
+    void stopWaiting();
+
     OVInferRequestsQueue& inferRequestsQueue_;
     std::future<int> futureStreamId;
     std::optional<int> streamId = std::nullopt;
     bool disarmed = false;
+    bool waiting = false;
     ModelMetricReporter& reporter;
 };
 }  // namespace ovms
@@ -23,11 +23,15 @@
 
 #include "../execution_context.hpp"
 #include "../logging.hpp"
+#include "../metric.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../profiler.hpp"
+#include "../request_tracer.hpp"
 #include "../status.hpp"
 #include "node.hpp"
 #include "nodesession.hpp"
 #include "pipelineeventqueue.hpp"
+#include "tensor_pool.hpp"
 
 namespace ovms {
 
@@ -35,13 +39,15 @@ using DeferredNodeSessions = std::vector<std::pair<std::reference_wrapper<Node>,
 
 Pipeline::~Pipeline() = default;
 
-Pipeline::Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name) :
+Pipeline::Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name, std::shared_ptr<TensorPool> tensorPool) :
     name(name),
     entry(entry),
     exit(exit),
-    reporter(reporter) {}
+    reporter(reporter),
+    tensorPool(std::move(tensorPool)) {}
 
 void Pipeline::push(std::unique_ptr<Node> node) {
+    node->setTensorPool(this->tensorPool);
     nodes.emplace_back(std::move(node));
 }
 void Pipeline::connect(Node& from, Node& to, const Aliases& tensorNamesMapping) {
@@ -98,6 +104,15 @@ Status Pipeline::execute(ExecutionContext context) {
     ovms::Status firstErrorStatus{ovms::StatusCode::OK};
     std::set<std::string> startedSessions;
     std::set<std::string> finishedSessions;
+    // Start times are tracked only when node time metric is enabled or request is traced
+    const bool trackSessionTimes = this->reporter.isPipelineNodeTimeEnabled() || RequestTracer::isTracing();
+    std::map<std::string, uint64_t> sessionStartTimes;
+    auto markSessionStarted = [&startedSessions, &sessionStartTimes, trackSessionTimes](const std::string& nodeSessionName) {
+        startedSessions.emplace(nodeSessionName);
+        if (trackSessionTimes) {
+            sessionStartTimes.emplace(nodeSessionName, RequestTracer::nowNs());
+        }
+    };
     NodeSessionMetadata meta(context);
     auto* entryNodeSession = entry.getNodeSession(meta);
     if (!entryNodeSession) {
@@ -105,7 +120,7 @@ Status Pipeline::execute(ExecutionContext context) {
         return StatusCode::INTERNAL_ERROR;
     }
     auto entrySessionKey = meta.getSessionKey();
-    startedSessions.emplace(entry.getName() + entrySessionKey);
+    markSessionStarted(entry.getName() + entrySessionKey);
     ovms::Status status = entry.execute(entrySessionKey, finishedNodeQueue);  // first node will triger first message
     if (!status.ok()) {
         SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} failed with: {}",
@@ -131,6 +146,15 @@ Status Pipeline::execute(ExecutionContext context) {
             Node& finishedNode = finishedNodeRef.get();
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got message that node: {} session: {} finished.", getName(), finishedNode.getName(), sessionKey);
             finishedSessions.emplace(finishedNode.getName() + sessionKey);
+            if (trackSessionTimes) {
+                auto startIt = sessionStartTimes.find(finishedNode.getName() + sessionKey);
+                if (startIt != sessionStartTimes.end()) {
+                    const uint64_t finishNs = RequestTracer::nowNs();
+                    this->reporter.observePipelineNodeTime(finishedNode.getName(), (finishNs - startIt->second) / 1000.0);
+                    RequestTracer::recordSpan(finishedNode.getName(), startIt->second, finishNs);
+                    sessionStartTimes.erase(startIt);
+                }
+            }
             if (!firstErrorStatus.ok()) {
                 finishedNode.release(sessionKey);
             }
@@ -164,9 +188,21 @@ Status Pipeline::execute(ExecutionContext context) {
             DeferredNodeSessions tmpDeferredNodeSessions;
             for (auto& nextNode : nextNodesFromFinished) {
                 auto readySessions = nextNode.get().getReadySessions();
+                if (readySessions.size() > 1 && nextNode.get().isBatchExecutionSupported()) {
+                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started batched execution of pipeline: {} node: {} sessions count: {}", getName(), nextNode.get().getName(), readySessions.size());
+                    for (auto& readySessionKey : readySessions) {
+                        markSessionStarted(nextNode.get().getName() + readySessionKey);
+                    }
+                    status = nextNode.get().executeBatch(readySessions, finishedNodeQueue);
+                    CHECK_AND_LOG_ERROR(nextNode.get())
+                    if (!firstErrorStatus.ok()) {
+                        break;
+                    }
+                    continue;
+                }
                 for (auto& sessionKey : readySessions) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {} session: {}", getName(), nextNode.get().getName(), sessionKey);
-                    startedSessions.emplace(nextNode.get().getName() + sessionKey);
+                    markSessionStarted(nextNode.get().getName() + sessionKey);
                     status = nextNode.get().execute(sessionKey, finishedNodeQueue);
                     if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
                         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} not ready for execution yet", nextNode.get().getName(), sessionKey);
@@ -277,6 +313,30 @@ Status Pipeline::execute(ExecutionContext context) {
             OVMS_PROFILE_SYNC_END("Try deferred nodes");
         }
     }
+    reportMetrics();
     return firstErrorStatus;
 }
+
+void Pipeline::reportMetrics() const {
+    size_t bytesCopied = 0;
+    for (const auto& node : nodes) {
+        bytesCopied += node->getBytesCopied();
+    }
+    if (this->reporter.pipelineBytesCopied && bytesCopied > 0) {
+        this->reporter.pipelineBytesCopied->increment(bytesCopied);
+    }
+    if (!this->tensorPool) {
+        return;
+    }
+    auto [hits, misses] = this->tensorPool->collectStatistics();
+    if (this->reporter.pipelineTensorPoolHits && hits > 0) {
+        this->reporter.pipelineTensorPoolHits->increment(hits);
+    }
+    if (this->reporter.pipelineTensorPoolMisses && misses > 0) {
+        this->reporter.pipelineTensorPoolMisses->increment(misses);
+    }
+    if (this->reporter.pipelineTensorPoolHeldBytes) {
+        this->reporter.pipelineTensorPoolHeldBytes->set(this->tensorPool->getHeldBytes());
+    }
+}
 }  // namespace ovms
@@ -31,6 +31,7 @@ class Node;
 
 class Node;
 class Status;
+class TensorPool;
 
 void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs);
 
@@ -40,9 +41,10 @@ class Pipeline {
     Node& entry;
     Node& exit;
     ServableMetricReporter& reporter;
+    std::shared_ptr<TensorPool> tensorPool;
 
 public:
-    Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name = "default_name");
+    Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name = "default_name", std::shared_ptr<TensorPool> tensorPool = nullptr);
 
     void push(std::unique_ptr<Node> node);
     ~Pipeline();
@@ -61,6 +63,7 @@ public:
 
 private:
     std::map<const std::string, bool> prepareStatusMap() const;
+    void reportMetrics() const;
 };
 
 }  // namespace ovms
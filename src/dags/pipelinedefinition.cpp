@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "pipelinedefinition.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <set>
 #include <thread>
@@ -25,6 +26,7 @@
 #include "../modelinstanceunloadguard.hpp"
 #include "../modelmanager.hpp"
 #include "../ov_utils.hpp"
+#include "../predict_request_validation_utils.hpp"
 #include "../prediction_service_utils.hpp"
 #include "../status.hpp"
 #include "custom_node.hpp"
@@ -37,6 +39,7 @@
 #include "nodestreamidguard.hpp"
 #include "pipeline.hpp"
 #include "pipelinedefinitionunloadguard.hpp"
+#include "tensor_pool.hpp"
 
 namespace ovms {
 const std::string PipelineDefinition::SCHEDULER_CLASS_NAME{"Pipeline"};
@@ -58,11 +61,13 @@ PipelineDefinition::PipelineDefinition(const std::string& pipelineName,
     const std::vector<NodeInfo>& nodeInfos,
     const pipeline_connections_t& connections,
     MetricRegistry* registry,
-    const MetricConfig* metricConfig) :
+    const MetricConfig* metricConfig,
+    size_t tensorPoolSizeBytes) :
     pipelineName(pipelineName),
     nodeInfos(nodeInfos),
     connections(connections),
     reporter(std::make_unique<ServableMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
+    tensorPool(tensorPoolSizeBytes > 0 ? std::make_shared<TensorPool>(tensorPoolSizeBytes) : nullptr),
     status(SCHEDULER_CLASS_NAME, this->pipelineName) {}
 
 Status PipelineDefinition::validate(ModelManager& manager) {
@@ -94,11 +99,17 @@ Status PipelineDefinition::validate(ModelManager& manager) {
     if (!validationResult.ok()) {
         return validationResult;
     }
+    validationResult = initializeCustomNodesOutputsInfo();
+    if (!validationResult.ok()) {
+        return validationResult;
+    }
     std::unique_lock lock(metadataMtx);
     validationResult = updateInputsInfo(manager);
     if (!validationResult.ok()) {
+        inputsValidationPlan.reset();
         return validationResult;
     }
+    inputsValidationPlan = std::make_shared<const request_validation_utils::ValidationPlan>(inputsInfo, shapes_info_map_t());
     validationResult = updateOutputsInfo(manager);
     if (!validationResult.ok()) {
         return validationResult;
@@ -134,6 +145,23 @@ Status PipelineDefinition::initializeNodeResources(ModelManager& manager) {
     return StatusCode::OK;
 }
 
+Status PipelineDefinition::initializeCustomNodesOutputsInfo() {
+    customNodesOutputsInfo.clear();
+    for (const auto& nodeInfo : nodeInfos) {
+        if (nodeInfo.kind != NodeKind::CUSTOM || !nodeInfo.library.hasServerAllocatedOutputs()) {
+            continue;
+        }
+        auto info = std::make_shared<tensor_map_t>();
+        auto status = getCustomNodeMetadata(nodeInfo, *info, nodeInfo.library.getOutputsInfo, this->getName(),
+            getCNLIMWrapperPtr(nodeResources.at(nodeInfo.nodeName)));
+        if (!status.ok()) {
+            return status;
+        }
+        customNodesOutputsInfo.emplace(nodeInfo.nodeName, std::move(info));
+    }
+    return StatusCode::OK;
+}
+
 // returns NodeInfos that are in PipelineDefinition, but are not in nodeInfos(std::vector argument)
 std::vector<NodeInfo> PipelineDefinition::calculateNodeInfosDiff(const std::vector<NodeInfo>& nodeInfos) {
     std::vector<NodeInfo> diff;
@@ -170,6 +198,11 @@ Status PipelineDefinition::reload(ModelManager& manager, const std::vector<NodeI
     deinitializeNodeResources(calculateNodeInfosDiff(nodeInfos));
     this->nodeInfos = std::move(nodeInfos);
     this->connections = std::move(connections);
+    std::set<std::string> nodeNames;
+    for (const auto& nodeInfo : this->nodeInfos) {
+        nodeNames.emplace(nodeInfo.nodeName);
+    }
+    this->reporter->prunePipelineNodeTime(nodeNames);
     makeSubscriptions(manager);
 
     return validate(manager);
@@ -184,6 +217,7 @@ void PipelineDefinition::retire(ModelManager& manager) {
     // deinitalize all resources
     deinitializeNodeResources(this->nodeInfos);
     this->nodeResources.clear();
+    this->customNodesOutputsInfo.clear();
     this->nodeInfos.clear();
     this->connections.clear();
 }
@@ -249,35 +283,68 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
     EntryNode<RequestType>* entry = nullptr;
     ExitNode<ResponseType>* exit = nullptr;
 
+    // Node batching shards -> its demultiplexer dependency, which leaves demultiplication to batching node
+    std::unordered_map<std::string, const NodeInfo*> batchedDemultiplexers;
+    for (const auto& info : nodeInfos) {
+        if (info.batchShards) {
+            const auto& demultiplexerName = connections.at(info.nodeName).begin()->first;
+            auto it = std::find_if(nodeInfos.begin(), nodeInfos.end(), [&demultiplexerName](const NodeInfo& nodeInfo) { return nodeInfo.nodeName == demultiplexerName; });
+            batchedDemultiplexers.emplace(info.nodeName, &(*it));
+        }
+    }
+    auto getDemultiplyCount = [&batchedDemultiplexers](const NodeInfo& info) -> std::optional<int32_t> {
+        for (const auto& [_, demultiplexerInfo] : batchedDemultiplexers) {
+            if (demultiplexerInfo->nodeName == info.nodeName) {
+                return std::nullopt;
+            }
+        }
+        return info.demultiplyCount;
+    };
+
     for (const auto& info : nodeInfos) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Creating pipeline: {}. Adding nodeName: {}, modelName: {}",
             getName(), info.nodeName, info.modelName);
         switch (info.kind) {
         case NodeKind::ENTRY: {
-            auto node = std::make_unique<EntryNode<RequestType>>(request, getInputsInfo(), info.demultiplyCount);
+            auto node = std::make_unique<EntryNode<RequestType>>(request, getInputsInfo(), getDemultiplyCount(info), getInputsValidationPlan());
             entry = node.get();
             nodes.emplace(info.nodeName, std::move(node));
             break;
         }
-        case NodeKind::DL:
+        case NodeKind::DL: {
+            auto it = batchedDemultiplexers.find(info.nodeName);
+            if (it != batchedDemultiplexers.end()) {
+                nodes.emplace(info.nodeName, std::make_unique<DLNode>(
+                                                 info.nodeName,
+                                                 info.modelName,
+                                                 info.modelVersion,
+                                                 manager,
+                                                 info.outputNameAliases,
+                                                 it->second->demultiplyCount,
+                                                 info.gatherFromNode,
+                                                 it->second->nodeName));
+                break;
+            }
             nodes.emplace(info.nodeName, std::make_unique<DLNode>(
                                              info.nodeName,
                                              info.modelName,
                                              info.modelVersion,
                                              manager,
                                              info.outputNameAliases,
-                                             info.demultiplyCount,
+                                             getDemultiplyCount(info),
                                              info.gatherFromNode));
             break;
+        }
         case NodeKind::CUSTOM:
             nodes.emplace(info.nodeName, std::make_unique<CustomNode>(
                                              info.nodeName,
                                              info.library,
                                              info.parameters,
                                              info.outputNameAliases,
-                                             info.demultiplyCount,
+                                             getDemultiplyCount(info),
                                              info.gatherFromNode,
-                                             nodeResources.at(info.nodeName)));
+                                             nodeResources.at(info.nodeName),
+                                             customNodesOutputsInfo.count(info.nodeName) > 0 ? customNodesOutputsInfo.at(info.nodeName) : nullptr));
             break;
         case NodeKind::EXIT: {
             auto node = std::make_unique<ExitNode<ResponseType>>(response, getOutputsInfo(), info.gatherFromNode, useSharedOutputContentFn(request), getName());
@@ -298,7 +365,7 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
             Pipeline::connect(*dependencyNode, *dependantNode, pair.second);
         }
     }
-    pipeline = std::make_unique<Pipeline>(*entry, *exit, *this->reporter, pipelineName);
+    pipeline = std::make_unique<Pipeline>(*entry, *exit, *this->reporter, pipelineName, this->tensorPool);
     for (auto& kv : nodes) {
         pipeline->push(std::move(kv.second));
     }
@@ -458,6 +525,58 @@ public:
         return StatusCode::OK;
     }
 
+    Status checkShardBatching() {
+        if (!dependantNodeInfo.batchShards) {
+            return StatusCode::OK;
+        }
+        auto it = connections.find(dependantNodeInfo.nodeName);
+        if (dependantNodeInfo.kind != NodeKind::DL ||
+            dependantNodeInfo.demultiplyCount ||
+            !dependantNodeInfo.gatherFromNode.empty() ||
+            it == connections.end() ||
+            it->second.size() != 1) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline: {} definition failed. Node: {} with batch_shards must be DL model node without demultiply_count and gather_from_node, connected to single dependency node",
+                pipelineName,
+                dependantNodeInfo.nodeName);
+            return StatusCode::PIPELINE_BATCH_SHARDS_INVALID_DEPENDENCY;
+        }
+        const auto& demultiplexerName = it->second.begin()->first;
+        std::vector<NodeInfo>::const_iterator demultiplexerNodeInfo;
+        auto result = getDependencyNodeInfo(demultiplexerName, demultiplexerNodeInfo);
+        if (!result.ok()) {
+            return result;
+        }
+        if (!demultiplexerNodeInfo->demultiplyCount) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline: {} definition failed. Node: {} with batch_shards is connected to node: {} which is not a demultiplexer",
+                pipelineName,
+                dependantNodeInfo.nodeName,
+                demultiplexerName);
+            return StatusCode::PIPELINE_BATCH_SHARDS_INVALID_DEPENDENCY;
+        }
+        auto dependantsCount = std::count_if(connections.begin(), connections.end(), [&demultiplexerName](const auto& connection) {
+            return connection.second.count(demultiplexerName) > 0;
+        });
+        if (dependantsCount != 1) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline: {} definition failed. Demultiplexer node: {} with shards batched by node: {} cannot be connected to other nodes",
+                pipelineName,
+                demultiplexerName,
+                dependantNodeInfo.nodeName);
+            return StatusCode::PIPELINE_BATCH_SHARDS_INVALID_DEPENDENCY;
+        }
+        for (const auto& [name, inputInfo] : this->inputsInfo) {
+            const auto& shape = inputInfo->getShape();
+            if (shape.size() > 0 && shape[0].isStatic()) {
+                SPDLOG_LOGGER_WARN(modelmanager_logger, "Pipeline: {}; Node: {} batches shards of node: {} while first dimension of input: {} is static: {}. This pipeline may fail at execution stage.",
+                    pipelineName,
+                    dependantNodeInfo.nodeName,
+                    demultiplexerName,
+                    name,
+                    shape.toString());
+            }
+        }
+        return StatusCode::OK;
+    }
+
     Status validateGatherNode(const NodeInfo& dependantNodeInfo) const {
         for (const auto& gather : dependantNodeInfo.gatherFromNode) {
             auto it = std::find_if(nodeInfos.begin(), nodeInfos.end(), [gather](const NodeInfo& nodeInfo) { return nodeInfo.nodeName == gather; });
@@ -842,6 +961,11 @@ public:
             prepareRemainingUnconnectedDependantInputsSet();
         }
 
+        auto shardBatchingResult = checkShardBatching();
+        if (!shardBatchingResult.ok()) {
+            return shardBatchingResult;
+        }
+
         if (dependantNodeInfo.kind == NodeKind::DL || dependantNodeInfo.kind == NodeKind::CUSTOM) {
             for (const auto& [name, tensorOutput] : outputsInfo) {
                 auto result = validateShapeWithDemultiplexer(tensorOutput->getShape(), dependantNodeInfo);
@@ -1096,6 +1220,11 @@ const tensor_map_t PipelineDefinition::getInputsInfo() const {
     return copy;
 }
 
+std::shared_ptr<const request_validation_utils::ValidationPlan> PipelineDefinition::getInputsValidationPlan() const {
+    std::shared_lock lock(metadataMtx);
+    return inputsValidationPlan;
+}
+
 const tensor_map_t PipelineDefinition::getOutputsInfo() const {
     std::shared_lock lock(metadataMtx);
     tensor_map_t copy = outputsInfo;
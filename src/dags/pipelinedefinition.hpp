@@ -47,6 +47,10 @@ class NodeValidator;
 class Pipeline;
 class PipelineDefinitionUnloadGuard;
 class Status;
+class TensorPool;
+namespace request_validation_utils {
+class ValidationPlan;
+}  // namespace request_validation_utils
 
 class PipelineDefinition {
     friend NodeValidator;
@@ -73,6 +77,8 @@ class PipelineDefinition {
     const std::string pipelineName;
     std::vector<NodeInfo> nodeInfos;
     std::map<std::string, std::shared_ptr<CNLIMWrapper>> nodeResources = {};
+    // Static outputs metadata of custom nodes with server allocated outputs, shared with nodes created per request
+    std::map<std::string, std::shared_ptr<const tensor_map_t>> customNodesOutputsInfo = {};
     pipeline_connections_t connections;
 
 protected:
@@ -80,6 +86,8 @@ protected:
     tensor_map_t outputsInfo;
 
 private:
+    // Built together with inputsInfo, so entry node does not derive it for every request
+    std::shared_ptr<const request_validation_utils::ValidationPlan> inputsValidationPlan;
     mutable std::shared_mutex metadataMtx;
     std::atomic<uint64_t> requestsHandlesCounter = 0;
     std::condition_variable loadedNotify;
@@ -89,6 +97,9 @@ private:
 
     std::unique_ptr<ServableMetricReporter> reporter;
 
+    // Recycles intermediate tensor buffers across requests, not set when pooling is disabled
+    std::shared_ptr<TensorPool> tensorPool;
+
 protected:
     PipelineDefinitionStatus status;
 
@@ -106,7 +117,8 @@ public:
         const std::vector<NodeInfo>& nodeInfos,
         const pipeline_connections_t& connections,
         MetricRegistry* registry = nullptr,
-        const MetricConfig* metricConfig = nullptr);
+        const MetricConfig* metricConfig = nullptr,
+        size_t tensorPoolSizeBytes = 0);
     template <typename RequestType, typename ResponseType>
     Status create(std::unique_ptr<Pipeline>& pipeline,
         const RequestType* request,
@@ -130,6 +142,7 @@ public:
     Status initializeNodeResources(ModelManager& manager);
     std::vector<NodeInfo> calculateNodeInfosDiff(const std::vector<NodeInfo>& nodeInfos);
     void deinitializeNodeResources(const std::vector<NodeInfo>& nodeInfosDiff);
+    Status initializeCustomNodesOutputsInfo();
 
     const std::string& getName() const { return pipelineName; }
     const PipelineDefinitionStateCode getStateCode() const { return status.getStateCode(); }
@@ -151,6 +164,7 @@ public:
     void resetSubscriptions(ModelManager& manager);
 
     ServableMetricReporter& getMetricReporter() const { return *this->reporter; }
+    const std::shared_ptr<TensorPool>& getTensorPool() const { return this->tensorPool; }
 
 protected:
     Status updateInputsInfo(const ModelManager& manager);
@@ -158,6 +172,7 @@ protected:
 
 public:
     const tensor_map_t getInputsInfo() const;
+    std::shared_ptr<const request_validation_utils::ValidationPlan> getInputsValidationPlan() const;
     const tensor_map_t getOutputsInfo() const;
 
 private:
@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tensor_pool.hpp"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "../logging.hpp"
+#include "../ov_utils.hpp"
+#include "../profiler.hpp"
+#include "../status.hpp"
+
+namespace ovms {
+
+TensorPool::TensorPool(size_t maxHeldBytes) :
+    maxHeldBytes(maxHeldBytes) {}
+
+TensorPool::~TensorPool() {
+    for (auto& buffer : idleBuffers) {
+        ::operator delete(buffer.data, std::align_val_t(ALIGNMENT));
+    }
+}
+
+Status TensorPool::createTensor(ov::Tensor& tensorOut, ov::element::Type_t precision, const ov::Shape& shape) {
+    OVMS_PROFILE_FUNCTION();
+    if (precision == ov::element::Type_t::string || ov::shape_size(shape) == 0) {
+        return createSharedTensor(tensorOut, precision, shape);
+    }
+    OV_LOGGER("ov::Tensor(precision, shape, allocator)");
+    tensorOut = ov::Tensor(precision, shape, PooledTensorAllocator(shared_from_this(), tensor_key_t{precision, shape}));
+    return StatusCode::OK;
+}
+
+Status TensorPool::cloneTensor(ov::Tensor& destinationTensor, const ov::Tensor& sourceTensor) {
+    OVMS_PROFILE_FUNCTION();
+    if (sourceTensor.get_element_type() == ov::element::Type_t::string) {
+        return tensorClone(destinationTensor, sourceTensor);
+    }
+    auto status = createTensor(destinationTensor, sourceTensor.get_element_type(), sourceTensor.get_shape());
+    if (!status.ok()) {
+        return status;
+    }
+    return tensorCopyData(destinationTensor, sourceTensor);
+}
+
+void* TensorPool::acquire(const tensor_key_t& key, size_t bytes, size_t alignment) {
+    if (alignment > ALIGNMENT) {
+        throw std::invalid_argument("requested tensor alignment is not supported by tensor pool");
+    }
+    {
+        std::unique_lock lock(mtx);
+        auto it = idleBuffersByKey.find(key);
+        if (it != idleBuffersByKey.end()) {
+            auto bufferIt = it->second.back();
+            void* data = bufferIt->data;
+            heldBytes -= bufferIt->bytes;
+            idleBuffers.erase(bufferIt);
+            it->second.pop_back();
+            if (it->second.empty()) {
+                idleBuffersByKey.erase(it);
+            }
+            ++hits;
+            return data;
+        }
+    }
+    ++misses;
+    return ::operator new(bytes, std::align_val_t(ALIGNMENT));
+}
+
+void TensorPool::release(const tensor_key_t& key, void* buffer, size_t bytes) {
+    std::unique_lock lock(mtx);
+    if (bytes > maxHeldBytes) {
+        lock.unlock();
+        ::operator delete(buffer, std::align_val_t(ALIGNMENT));
+        return;
+    }
+    while (heldBytes + bytes > maxHeldBytes) {
+        freeOldestBuffer();
+    }
+    idleBuffers.push_front(IdleBuffer{key, buffer, bytes});
+    idleBuffersByKey[key].push_back(idleBuffers.begin());
+    heldBytes += bytes;
+}
+
+void TensorPool::freeOldestBuffer() {
+    auto& oldest = idleBuffers.back();
+    // buffers of the same key are ordered from least recently returned
+    auto it = idleBuffersByKey.find(oldest.key);
+    it->second.erase(it->second.begin());
+    if (it->second.empty()) {
+        idleBuffersByKey.erase(it);
+    }
+    heldBytes -= oldest.bytes;
+    ::operator delete(oldest.data, std::align_val_t(ALIGNMENT));
+    idleBuffers.pop_back();
+}
+
+size_t TensorPool::getHeldBytes() const {
+    std::unique_lock lock(mtx);
+    return heldBytes;
+}
+
+std::pair<uint64_t, uint64_t> TensorPool::collectStatistics() {
+    uint64_t currentHits = hits;
+    uint64_t currentMisses = misses;
+    return {currentHits - reportedHits.exchange(currentHits), currentMisses - reportedMisses.exchange(currentMisses)};
+}
+
+PooledTensorAllocator::PooledTensorAllocator(std::shared_ptr<TensorPool> pool, TensorPool::tensor_key_t key) :
+    pool(std::move(pool)),
+    key(std::move(key)) {}
+
+void* PooledTensorAllocator::allocate(const size_t bytes, const size_t alignment) {
+    return pool->acquire(key, bytes, alignment);
+}
+
+void PooledTensorAllocator::deallocate(void* handle, const size_t bytes, size_t alignment) {
+    pool->release(key, handle, bytes);
+}
+
+bool PooledTensorAllocator::is_equal(const PooledTensorAllocator& other) const {
+    return (pool == other.pool) && (key == other.key);
+}
+
+}  // namespace ovms
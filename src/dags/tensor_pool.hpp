@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+namespace ovms {
+
+class Status;
+
+/**
+ * @brief Pool of buffers for DAG intermediate tensors shared by all requests of a pipeline definition.
+ *
+ * Tensors created by the pool return their buffers to it when the last reference is dropped. Buffers are kept
+ * per precision and shape, up to the configured number of idle bytes. Least recently returned buffers are freed first.
+ */
+class TensorPool : public std::enable_shared_from_this<TensorPool> {
+public:
+    using tensor_key_t = std::pair<ov::element::Type_t, std::vector<size_t>>;
+
+    TensorPool(size_t maxHeldBytes);
+    ~TensorPool();
+    TensorPool(const TensorPool&) = delete;
+    TensorPool& operator=(const TensorPool&) = delete;
+
+    Status createTensor(ov::Tensor& tensorOut, ov::element::Type_t precision, const ov::Shape& shape);
+    Status cloneTensor(ov::Tensor& destinationTensor, const ov::Tensor& sourceTensor);
+
+    void* acquire(const tensor_key_t& key, size_t bytes, size_t alignment);
+    void release(const tensor_key_t& key, void* buffer, size_t bytes);
+
+    size_t getMaxHeldBytes() const { return maxHeldBytes; }
+    size_t getHeldBytes() const;
+    uint64_t getHits() const { return hits; }
+    uint64_t getMisses() const { return misses; }
+
+    /**
+     * @brief Returns hits and misses counted since previous call, used for metrics reporting
+     */
+    std::pair<uint64_t, uint64_t> collectStatistics();
+
+    static constexpr size_t ALIGNMENT = 64;
+
+private:
+    struct IdleBuffer {
+        tensor_key_t key;
+        void* data;
+        size_t bytes;
+    };
+
+    void freeOldestBuffer();
+
+    const size_t maxHeldBytes;
+    mutable std::mutex mtx;
+    // most recently returned buffer first
+    std::list<IdleBuffer> idleBuffers;
+    std::map<tensor_key_t, std::vector<std::list<IdleBuffer>::iterator>> idleBuffersByKey;
+    size_t heldBytes = 0;
+
+    std::atomic<uint64_t> hits = 0;
+    std::atomic<uint64_t> misses = 0;
+    std::atomic<uint64_t> reportedHits = 0;
+    std::atomic<uint64_t> reportedMisses = 0;
+};
+
+class PooledTensorAllocator {
+    std::shared_ptr<TensorPool> pool;
+    TensorPool::tensor_key_t key;
+
+public:
+    PooledTensorAllocator(std::shared_ptr<TensorPool> pool, TensorPool::tensor_key_t key);
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t));
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t));
+    bool is_equal(const PooledTensorAllocator& other) const;
+};
+
+}  // namespace ovms
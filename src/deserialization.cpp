@@ -15,8 +15,11 @@
 //*****************************************************************************
 #include "deserialization.hpp"
 
+#include <vector>
+
 #include "capi_frontend/buffer.hpp"
 #include "logging.hpp"
+#include "precision_conversion.hpp"
 
 namespace ovms {
 
@@ -111,4 +114,50 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
     ov::Tensor tensor(precision, shape);
     return tensor;
 }
+static ov::Tensor convertIntoTensor(const void* data, Precision requestPrecision, const ov::Shape& shape, const TensorInfo& tensorInfo) {
+    OVMS_PROFILE_FUNCTION();
+    OV_LOGGER("ov::Tensor({}, shape)", toString(tensorInfo.getPrecision()));
+    ov::Tensor tensor(tensorInfo.getOvPrecision(), shape);
+    auto status = convertPrecision(data, requestPrecision, tensor.data(), tensorInfo.getPrecision(), tensor.get_size(), tensorInfo.getConversionScale());
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Failed to convert input: {} from precision: {}; to: {}", tensorInfo.getMappedName(), toString(requestPrecision), tensorInfo.getPrecisionAsString());
+        return ov::Tensor();
+    }
+    return tensor;
+}
+
+ov::Tensor makeConvertedTensor(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    ov::Shape shape;
+    for (int i = 0; i < requestInput.tensor_shape().dim_size(); i++) {
+        shape.push_back(requestInput.tensor_shape().dim(i).size());
+    }
+    const Precision requestPrecision = TFSPrecisionToOvmsPrecision(requestInput.dtype());
+    if (requestPrecision == Precision::FP16) {
+        // Half values are zero padded to int32:
+        // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L55
+        std::vector<uint16_t> halfValues(requestInput.half_val().begin(), requestInput.half_val().end());
+        return convertIntoTensor(halfValues.data(), requestPrecision, shape, *tensorInfo);
+    }
+    return convertIntoTensor(requestInput.tensor_content().data(), requestPrecision, shape, *tensorInfo);
+}
+
+ov::Tensor makeConvertedTensor(const ::KFSRequest::InferInputTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const std::string& buffer) {
+    ov::Shape shape;
+    for (int i = 0; i < requestInput.shape_size(); i++) {
+        shape.push_back(requestInput.shape().at(i));
+    }
+    return convertIntoTensor(buffer.data(), KFSPrecisionToOvmsPrecision(requestInput.datatype()), shape, *tensorInfo);
+}
+
+ov::Tensor makeConvertedTensor(const InferenceTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    ov::Shape shape;
+    for (const auto& dim : requestInput.getShape()) {
+        shape.push_back(dim);
+    }
+    return convertIntoTensor(requestInput.getBuffer()->data(), getOVMSDataTypeAsPrecision(requestInput.getDataType()), shape, *tensorInfo);
+}
 }  // namespace ovms
@@ -28,6 +28,7 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 
+#include "capi_frontend/capi_utils.hpp"
 #include "capi_frontend/inferencerequest.hpp"
 #include "capi_frontend/inferencetensor.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
@@ -59,6 +60,18 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
 ov::Tensor makeTensor(const InferenceTensor& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo);
 
+/**
+ * @brief Creates tensor in tensor info precision from request data sent in one of tensor info accepted precisions.
+ * Returns empty tensor if conversion fails.
+ */
+ov::Tensor makeConvertedTensor(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo);
+ov::Tensor makeConvertedTensor(const ::KFSRequest::InferInputTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const std::string& buffer);
+ov::Tensor makeConvertedTensor(const InferenceTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo);
+
 class ConcreteTensorProtoDeserializator {
 public:
     static ov::Tensor deserializeTensorProto(
@@ -66,6 +79,12 @@ public:
         const std::shared_ptr<const TensorInfo>& tensorInfo,
         const std::string* buffer) {
         OVMS_PROFILE_FUNCTION();
+        if (!tensorInfo->getAcceptedPrecisions().empty() && KFSPrecisionToOvmsPrecision(requestInput.datatype()) != tensorInfo->getPrecision()) {
+            if (nullptr == buffer) {
+                return ov::Tensor();
+            }
+            return makeConvertedTensor(requestInput, tensorInfo, *buffer);
+        }
         if (nullptr != buffer) {
             switch (tensorInfo->getPrecision()) {
             case ovms::Precision::FP64:
@@ -229,6 +248,9 @@ public:
         const InferenceTensor& requestInput,
         const std::shared_ptr<const TensorInfo>& tensorInfo) {
         OVMS_PROFILE_FUNCTION();
+        if (!tensorInfo->getAcceptedPrecisions().empty() && getOVMSDataTypeAsPrecision(requestInput.getDataType()) != tensorInfo->getPrecision()) {
+            return makeConvertedTensor(requestInput, tensorInfo);
+        }
         switch (tensorInfo->getPrecision()) {
         case ovms::Precision::FP64:
         case ovms::Precision::FP32:
@@ -260,6 +282,9 @@ public:
         const tensorflow::TensorProto& requestInput,
         const std::shared_ptr<const TensorInfo>& tensorInfo) {
         OVMS_PROFILE_FUNCTION();
+        if (!tensorInfo->getAcceptedPrecisions().empty() && TFSPrecisionToOvmsPrecision(requestInput.dtype()) != tensorInfo->getPrecision()) {
+            return makeConvertedTensor(requestInput, tensorInfo);
+        }
         switch (tensorInfo->getPrecision()) {
         case ovms::Precision::FP32:
         case ovms::Precision::I32:
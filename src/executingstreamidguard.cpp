@@ -15,11 +15,25 @@
 //*****************************************************************************
 #include "executingstreamidguard.hpp"
 
+#include <chrono>
+#include <future>
+
 #include "model_metric_reporter.hpp"
 #include "ovinferrequestsqueue.hpp"
 
 namespace ovms {
 
+static int acquireStream(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) {
+    std::future<int> futureStreamId = inferRequestsQueue.getIdleStream();
+    if (futureStreamId.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        return futureStreamId.get();
+    }
+    INCREMENT_IF_ENABLED(reporter.inferReqWaiting);
+    int streamId = futureStreamId.get();
+    DECREMENT_IF_ENABLED(reporter.inferReqWaiting);
+    return streamId;
+}
+
 ExecutingStreamIdGuard::CurrentRequestsMetricGuard::CurrentRequestsMetricGuard(ModelMetricReporter& reporter) :
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
@@ -32,10 +46,11 @@ ExecutingStreamIdGuard::CurrentRequestsMetricGuard::~CurrentRequestsMetricGuard(
 ExecutingStreamIdGuard::ExecutingStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
     currentRequestsMetricGuard(reporter),
     inferRequestsQueue_(inferRequestsQueue),
-    id_(inferRequestsQueue_.getIdleStream().get()),
+    id_(acquireStream(inferRequestsQueue_, reporter)),
     inferRequest(inferRequestsQueue.getInferRequest(id_)),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    OBSERVE_IF_ENABLED(this->reporter.inferReqUtilization, static_cast<double>(inferRequestsQueue_.getStreamsInUse()) / inferRequestsQueue_.getSize());
 }
 
 ExecutingStreamIdGuard::~ExecutingStreamIdGuard() {
@@ -114,6 +114,18 @@ public:
      */
     virtual StatusCode downloadModelVersions(const std::string& path, std::string* local_path, const std::vector<model_version_t>& versions) = 0;
 
+    /**
+     * @brief Get a fingerprint of a remote directory content built from object names and their ETags/generations.
+     * Fingerprint changes whenever any object under the path changes.
+     *
+     * @param path
+     * @param fingerprint
+     * @return StatusCode NOT_IMPLEMENTED if filesystem does not support fingerprinting
+     */
+    virtual StatusCode getDirectoryFingerprint(const std::string& path, std::string* fingerprint) {
+        return StatusCode::NOT_IMPLEMENTED;
+    }
+
     /**
      * @brief Delete a folder
      *
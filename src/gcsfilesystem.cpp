@@ -28,6 +28,7 @@
 #include <filesystem>
 #include <fstream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -329,6 +330,36 @@ StatusCode GCSFileSystem::downloadModelVersions(const std::string& path,
     return result;
 }
 
+StatusCode GCSFileSystem::getDirectoryFingerprint(const std::string& path, std::string* fingerprint) {
+    SPDLOG_LOGGER_TRACE(gcs_logger, "Getting directory fingerprint {}", path);
+    std::string bucket, directory_path;
+    auto status = this->parsePath(path, &bucket, &directory_path);
+    if (status != StatusCode::OK) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Unable to get directory fingerprint {} -> {}", path,
+            ovms::Status(status).string());
+        return status;
+    }
+    std::stringstream ss;
+    try {
+        // objects are listed in lexicographical order so fingerprint is stable
+        for (auto&& meta : client_.ListObjects(bucket, gcs::Prefix(appendSlash(directory_path)))) {
+            if (!meta) {
+                SPDLOG_LOGGER_ERROR(gcs_logger, "Unable to get directory fingerprint -> object metadata "
+                                                "is empty. Error: {}",
+                    meta.status().message());
+                return StatusCode::GCS_INVALID_ACCESS;
+            }
+            ss << meta->name() << ":" << meta->generation() << ":" << meta->etag() << ":" << meta->size() << ";";
+        }
+    } catch (std::exception& ex) {
+        SPDLOG_LOGGER_DEBUG(gcs_logger, "GCS list objects exception {}", ex.what());
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Invalid or missing GCS credentials, or directory does not exist - {}", path);
+        return StatusCode::GCS_INVALID_ACCESS;
+    }
+    *fingerprint = ss.str();
+    return StatusCode::OK;
+}
+
 StatusCode GCSFileSystem::downloadFileFolder(const std::string& path, const std::string& local_path) {
     SPDLOG_LOGGER_TRACE(gcs_logger, "Downloading dir {} and saving to {}", path, local_path);
     bool is_dir;
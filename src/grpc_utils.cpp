@@ -19,9 +19,18 @@
 #include <string>
 #include <unordered_map>
 
+#include "request_tracer.hpp"
 #include "status.hpp"
 
 namespace ovms {
+bool isTraceRequested(const grpc::ServerContext* context) {
+    if (!context) {
+        return false;
+    }
+    auto it = context->client_metadata().find(RequestTracer::TRACE_HEADER);
+    return it != context->client_metadata().end() && it->second != "0";
+}
+
 const grpc::Status grpc(const Status& status) {
     static const std::unordered_map<const StatusCode, grpc::StatusCode> grpcStatusMap = {
         {StatusCode::OK, grpc::StatusCode::OK},
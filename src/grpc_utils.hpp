@@ -20,4 +20,9 @@ namespace ovms {
 class Status;
 
 const grpc::Status grpc(const Status& status);
+
+/**
+ * @brief Checks if client asked for tracing the request with metadata entry
+ */
+bool isTraceRequested(const grpc::ServerContext* context);
 }  // namespace ovms
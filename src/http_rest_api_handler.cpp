@@ -15,8 +15,11 @@
 //*****************************************************************************
 #include "http_rest_api_handler.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -46,6 +49,7 @@
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
 #include "prediction_service_utils.hpp"
+#include "request_tracer.hpp"
 #include "rest_parser.hpp"
 #include "rest_utils.hpp"
 #include "servablemanagermodule.hpp"
@@ -689,6 +693,18 @@ Status HttpRestApiHandler::processRequest(
     HttpRequestComponents requestComponents;
     auto status = parseRequestComponents(requestComponents, http_method, request_path_str, *headers);
 
+    std::optional<RequestTraceScope> traceScope;
+    if (status.ok() && (requestComponents.type == Predict || requestComponents.type == KFS_Infer)) {
+        bool traceRequested = false;
+        for (auto& header : *headers) {
+            if (header.first.size() == RequestTracer::TRACE_HEADER.size() &&
+                std::equal(header.first.begin(), header.first.end(), RequestTracer::TRACE_HEADER.begin(), [](char a, char b) { return std::tolower(a) == b; })) {
+                traceRequested = header.second != "0";
+            }
+        }
+        traceScope.emplace(requestComponents.type == Predict ? "REST Predict" : "REST ModelInfer", traceRequested);
+    }
+
     headers->clear();
     response->clear();
     headers->push_back({"Content-Type", "application/json"});
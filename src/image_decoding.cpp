@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "image_decoding.hpp"
+
+#include <csetjmp>
+#include <cstdio>
+
+extern "C" {
+#include <jpeglib.h>
+}
+
+#include "logging.hpp"
+#include "opencv2/opencv.hpp"
+#include "profiler.hpp"
+
+namespace ovms {
+
+namespace {
+struct JpegErrorManager {
+    jpeg_error_mgr manager;
+    jmp_buf jumpBuffer;
+};
+
+void onJpegError(j_common_ptr cinfo) {
+    char message[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, message);
+    SPDLOG_DEBUG("libjpeg-turbo decoding failed: {}", message);
+    longjmp(reinterpret_cast<JpegErrorManager*>(cinfo->err)->jumpBuffer, 1);
+}
+
+// Corrupt data warnings are not reported to stderr
+void onJpegMessage(j_common_ptr) {}
+
+// Reduced IDCT sizes have dedicated fast implementations in libjpeg-turbo, other M/8 scales do not
+unsigned int selectScaleDenominator(size_t imageHeight, size_t imageWidth, size_t targetHeight, size_t targetWidth) {
+    if (targetHeight == 0 || targetWidth == 0) {
+        return 1;
+    }
+    for (unsigned int denominator : {8u, 4u, 2u}) {
+        if ((imageHeight + denominator - 1) / denominator >= targetHeight &&
+            (imageWidth + denominator - 1) / denominator >= targetWidth) {
+            return denominator;
+        }
+    }
+    return 1;
+}
+
+// Kept free of C++ objects with destructors since libjpeg-turbo errors longjmp back here
+bool decompress(jpeg_decompress_struct& cinfo, JpegErrorManager& errorManager, const std::string& data, size_t targetHeight, size_t targetWidth, cv::Mat& image) {
+    if (setjmp(errorManager.jumpBuffer)) {
+        return false;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, reinterpret_cast<unsigned char*>(const_cast<char*>(data.data())), data.size());
+    jpeg_read_header(&cinfo, TRUE);
+    if (cinfo.data_precision != 8) {
+        return false;
+    }
+    int channels;
+    switch (cinfo.jpeg_color_space) {
+    case JCS_GRAYSCALE:
+        cinfo.out_color_space = JCS_GRAYSCALE;
+        channels = 1;
+        break;
+    case JCS_YCbCr:
+    case JCS_RGB:
+        // Same channel order as cv::imdecode
+        cinfo.out_color_space = JCS_EXT_BGR;
+        channels = 3;
+        break;
+    default:
+        return false;
+    }
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = selectScaleDenominator(cinfo.image_height, cinfo.image_width, targetHeight, targetWidth);
+    jpeg_calc_output_dimensions(&cinfo);
+    image.create(cinfo.output_height, cinfo.output_width, CV_MAKETYPE(CV_8U, channels));
+    jpeg_start_decompress(&cinfo);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW row = image.ptr<JSAMPLE>(cinfo.output_scanline);
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    return true;
+}
+}  // namespace
+
+bool isJpeg(const std::string& data) {
+    return data.size() > 3 &&
+           static_cast<unsigned char>(data[0]) == 0xFF &&
+           static_cast<unsigned char>(data[1]) == 0xD8 &&
+           static_cast<unsigned char>(data[2]) == 0xFF;
+}
+
+cv::Mat decodeJpeg(const std::string& data, size_t targetHeight, size_t targetWidth) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isJpeg(data)) {
+        return cv::Mat{};
+    }
+    // Zeroed so that destroy is safe even if create did not complete
+    jpeg_decompress_struct cinfo{};
+    JpegErrorManager errorManager;
+    cinfo.err = jpeg_std_error(&errorManager.manager);
+    errorManager.manager.error_exit = onJpegError;
+    errorManager.manager.output_message = onJpegMessage;
+    cv::Mat image;
+    bool decoded = decompress(cinfo, errorManager, data, targetHeight, targetWidth, image);
+    jpeg_destroy_decompress(&cinfo);
+    if (!decoded) {
+        return cv::Mat{};
+    }
+    return image;
+}
+
+cv::Mat decodeImage(const std::string& data, size_t targetHeight, size_t targetWidth) {
+    OVMS_PROFILE_FUNCTION();
+    cv::Mat image = decodeJpeg(data, targetHeight, targetWidth);
+    if (image.data != nullptr) {
+        return image;
+    }
+    // cv::imdecode does not modify input buffer, no need to copy it
+    const cv::Mat dataMat(1, data.size(), CV_8UC1, const_cast<char*>(data.data()));
+    try {
+        return cv::imdecode(dataMat, cv::IMREAD_UNCHANGED);
+    } catch (const cv::Exception& e) {
+        SPDLOG_DEBUG("Error during string_val to mat conversion: {}", e.what());
+        return cv::Mat{};
+    }
+}
+}  // namespace ovms
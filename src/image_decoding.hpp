@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace cv {
+class Mat;
+}
+
+namespace ovms {
+
+bool isJpeg(const std::string& data);
+
+/**
+ * @brief Decodes 8 bit grayscale, YCbCr and RGB JPEG images into BGR or single channel cv::Mat with libjpeg-turbo.
+ * When both target dimensions are set, image is decoded with the smallest DCT scaling (1/2, 1/4, 1/8)
+ * that keeps the resolution not smaller than target. Returns empty cv::Mat for images this path does not handle.
+ *
+ * @param targetHeight expected height after resize, 0 if unknown
+ * @param targetWidth expected width after resize, 0 if unknown
+ */
+cv::Mat decodeJpeg(const std::string& data, size_t targetHeight = 0, size_t targetWidth = 0);
+
+/**
+ * @brief Decodes binary image with cv::IMREAD_UNCHANGED semantics.
+ * JPEG images are decoded with decodeJpeg, other formats fall back to cv::imdecode.
+ * Returns empty cv::Mat if image could not be decoded.
+ */
+cv::Mat decodeImage(const std::string& data, size_t targetHeight = 0, size_t targetWidth = 0);
+}  // namespace ovms
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Measures decoding of binary inputs. Compares cv::imdecode used previously with libjpeg-turbo path,
+// at full resolution and with DCT scaling to target resolution.
+// Usage: image_decoding_benchmark [images directory] [iterations] [target height] [target width]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "image_decoding.hpp"
+#include "opencv2/opencv.hpp"
+
+namespace {
+
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// Returns average microseconds per decode
+double measure(int iterations, const std::function<cv::Mat()>& decode) {
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        if (decode().data == nullptr) {
+            return -1;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - begin).count() / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::filesystem::path directory = argc > 1 ? argv[1] : "src/test/binaryutils";
+    const int iterations = argc > 2 ? std::atoi(argv[2]) : 10000;
+    const size_t targetHeight = argc > 3 ? std::atoi(argv[3]) : 1;
+    const size_t targetWidth = argc > 4 ? std::atoi(argv[4]) : targetHeight;
+
+    std::vector<std::filesystem::path> images;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.is_regular_file()) {
+            images.push_back(entry.path());
+        }
+    }
+    std::sort(images.begin(), images.end());
+
+    std::cout << "iterations: " << iterations << "; target resolution: " << targetHeight << "x" << targetWidth << std::endl;
+    std::cout << std::setw(24) << "image" << std::setw(16) << "resolution" << std::setw(20) << "imdecode [us]"
+              << std::setw(20) << "turbo [us]" << std::setw(20) << "turbo scaled [us]" << std::endl;
+    for (const auto& path : images) {
+        const std::string data = readFile(path);
+        const cv::Mat reference = ovms::decodeImage(data);
+        if (reference.data == nullptr) {
+            continue;
+        }
+        double imdecodeUs = measure(iterations, [&data]() {
+            // Copy of request data as done before decoding with cv::imdecode
+            std::vector<unsigned char> buffer(data.begin(), data.end());
+            return cv::imdecode(cv::Mat(buffer, true), cv::IMREAD_UNCHANGED);
+        });
+        double turboUs = measure(iterations, [&data]() { return ovms::decodeImage(data); });
+        double scaledUs = measure(iterations, [&data, targetHeight, targetWidth]() { return ovms::decodeImage(data, targetHeight, targetWidth); });
+        std::cout << std::setw(24) << path.filename().string()
+                  << std::setw(16) << (std::to_string(reference.rows) + "x" + std::to_string(reference.cols))
+                  << std::setw(20) << std::fixed << std::setprecision(2) << imdecodeUs
+                  << std::setw(20) << turboUs << std::setw(20) << scaledUs << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "image_preprocessing.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <openvino/core/type/float16.hpp>
+
+#include "logging.hpp"
+#include "opencv2/opencv.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+Status resizeAlgorithmFromString(const std::string& str, ResizeAlgorithm& resizeAlgorithm) {
+    static const std::unordered_map<std::string, ResizeAlgorithm> resizeAlgorithms{
+        {"nearest", ResizeAlgorithm::NEAREST},
+        {"linear", ResizeAlgorithm::LINEAR},
+        {"cubic", ResizeAlgorithm::CUBIC},
+        {"area", ResizeAlgorithm::AREA}};
+    auto it = resizeAlgorithms.find(str);
+    if (it == resizeAlgorithms.end()) {
+        return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+    }
+    resizeAlgorithm = it->second;
+    return StatusCode::OK;
+}
+
+int getResizeInterpolation(ResizeAlgorithm resizeAlgorithm) {
+    switch (resizeAlgorithm) {
+    case ResizeAlgorithm::NEAREST:
+        return cv::INTER_NEAREST;
+    case ResizeAlgorithm::CUBIC:
+        return cv::INTER_CUBIC;
+    case ResizeAlgorithm::AREA:
+        return cv::INTER_AREA;
+    case ResizeAlgorithm::LINEAR:
+    default:
+        return cv::INTER_LINEAR;
+    }
+}
+
+bool isImagePreprocessingPrecisionSupported(Precision precision) {
+    return precision == Precision::FP32 || precision == Precision::FP16 || precision == Precision::U8;
+}
+
+namespace {
+template <typename Dst>
+Dst castPixel(float value);
+
+template <>
+float castPixel<float>(float value) {
+    return value;
+}
+
+template <>
+ov::float16 castPixel<ov::float16>(float value) {
+    return ov::float16(value);
+}
+
+template <>
+uint8_t castPixel<uint8_t>(float value) {
+    return cv::saturate_cast<uint8_t>(value);
+}
+
+// (x - mean) / scale is computed as x * multiplier + offset
+struct ChannelTransform {
+    int sourceChannel;
+    float multiplier;
+    float offset;
+};
+
+template <typename Src, typename Dst>
+void writePixels(const cv::Mat& image, const std::vector<ChannelTransform>& transforms, bool planar, Dst* dst) {
+    const size_t channels = transforms.size();
+    const size_t rows = image.rows;
+    const size_t cols = image.cols;
+    const size_t planeSize = rows * cols;
+    for (size_t y = 0; y < rows; y++) {
+        const Src* row = image.ptr<Src>(y);
+        if (planar) {
+            for (size_t c = 0; c < channels; c++) {
+                const ChannelTransform& transform = transforms[c];
+                Dst* out = dst + c * planeSize + y * cols;
+                const Src* in = row + transform.sourceChannel;
+                for (size_t x = 0; x < cols; x++) {
+                    out[x] = castPixel<Dst>(static_cast<float>(in[x * channels]) * transform.multiplier + transform.offset);
+                }
+            }
+        } else {
+            Dst* out = dst + y * cols * channels;
+            for (size_t x = 0; x < cols; x++) {
+                for (size_t c = 0; c < channels; c++) {
+                    const ChannelTransform& transform = transforms[c];
+                    out[x * channels + c] = castPixel<Dst>(static_cast<float>(row[x * channels + transform.sourceChannel]) * transform.multiplier + transform.offset);
+                }
+            }
+        }
+    }
+}
+
+template <typename Src>
+Status writePixels(const cv::Mat& image, const std::vector<ChannelTransform>& transforms, Precision precision, bool planar, void* dst) {
+    switch (precision) {
+    case Precision::FP32:
+        writePixels<Src>(image, transforms, planar, reinterpret_cast<float*>(dst));
+        return StatusCode::OK;
+    case Precision::FP16:
+        writePixels<Src>(image, transforms, planar, reinterpret_cast<ov::float16*>(dst));
+        return StatusCode::OK;
+    case Precision::U8:
+        writePixels<Src>(image, transforms, planar, reinterpret_cast<uint8_t*>(dst));
+        return StatusCode::OK;
+    default:
+        SPDLOG_DEBUG("Image preprocessing does not support precision: {}", toString(precision));
+        return StatusCode::INVALID_PRECISION;
+    }
+}
+
+float getChannelValue(const std::vector<float>& values, size_t channel, float defaultValue) {
+    if (values.empty()) {
+        return defaultValue;
+    }
+    return values.size() == 1 ? values[0] : values[channel];
+}
+}  // namespace
+
+Status preprocessImage(const cv::Mat& image, const ImagePreprocessing& preprocessing, Precision precision, bool planar, void* dst) {
+    OVMS_PROFILE_FUNCTION();
+    const size_t channels = image.channels();
+    for (const auto* values : {&preprocessing.mean, &preprocessing.scale}) {
+        if (values->size() > 1 && values->size() != channels) {
+            SPDLOG_DEBUG("Image preprocessing defines {} channel values while image has {} channels", values->size(), channels);
+            return StatusCode::INVALID_NO_OF_CHANNELS;
+        }
+    }
+    std::vector<ChannelTransform> transforms(channels);
+    for (size_t c = 0; c < channels; c++) {
+        // Alpha channel of BGRA image stays in place
+        transforms[c].sourceChannel = (preprocessing.reverseChannels && channels >= 3 && c < 3) ? 2 - c : c;
+        const float mean = getChannelValue(preprocessing.mean, c, 0.0f);
+        const float scale = getChannelValue(preprocessing.scale, c, 1.0f);
+        transforms[c].multiplier = 1.0f / scale;
+        transforms[c].offset = -mean / scale;
+    }
+    switch (image.depth()) {
+    case CV_8U:
+        return writePixels<uint8_t>(image, transforms, precision, planar, dst);
+    case CV_16U:
+        return writePixels<uint16_t>(image, transforms, precision, planar, dst);
+    default:
+        SPDLOG_DEBUG("Image preprocessing does not support decoded image depth: {}", image.depth());
+        return StatusCode::INVALID_PRECISION;
+    }
+}
+}  // namespace ovms
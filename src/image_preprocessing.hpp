@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "precision.hpp"
+
+namespace cv {
+class Mat;
+}
+
+namespace ovms {
+class Status;
+
+enum class ResizeAlgorithm {
+    NEAREST,
+    LINEAR,
+    CUBIC,
+    AREA
+};
+
+/**
+ * @brief Preprocessing applied to binary image inputs while decoded pixels are written into input tensor
+ */
+struct ImagePreprocessing {
+    /**
+     * @brief Values subtracted from each channel. Empty, single value for all channels or one value per channel
+     */
+    std::vector<float> mean;
+
+    /**
+     * @brief Divisors applied to each channel after mean subtraction. Empty, single value for all channels or one value per channel
+     */
+    std::vector<float> scale;
+
+    /**
+     * @brief Swaps decoded BGR channels into RGB order
+     */
+    bool reverseChannels = false;
+
+    ResizeAlgorithm resizeAlgorithm = ResizeAlgorithm::LINEAR;
+
+    bool operator==(const ImagePreprocessing& rhs) const {
+        return this->mean == rhs.mean &&
+               this->scale == rhs.scale &&
+               this->reverseChannels == rhs.reverseChannels &&
+               this->resizeAlgorithm == rhs.resizeAlgorithm;
+    }
+    bool operator!=(const ImagePreprocessing& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+using image_preprocessing_map_t = std::unordered_map<std::string, ImagePreprocessing>;
+
+Status resizeAlgorithmFromString(const std::string& str, ResizeAlgorithm& resizeAlgorithm);
+
+int getResizeInterpolation(ResizeAlgorithm resizeAlgorithm);
+
+bool isImagePreprocessingPrecisionSupported(Precision precision);
+
+/**
+ * @brief Writes decoded image into tensor memory in a single pass over pixels.
+ * Channels are reordered, mean is subtracted, result is divided by scale and converted into precision.
+ *
+ * @param planar writes channels in CHW order instead of HWC
+ */
+Status preprocessImage(const cv::Mat& image, const ImagePreprocessing& preprocessing, Precision precision, bool planar, void* dst);
+}  // namespace ovms
@@ -15,13 +15,21 @@
 //*****************************************************************************
 #include "kfs_grpc_inference_service.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "../config.hpp"
 #include "../dags/pipeline.hpp"
 #include "../dags/pipelinedefinition.hpp"
 #include "../dags/pipelinedefinitionstatus.hpp"
@@ -40,6 +48,7 @@
 #include "../modelmanager.hpp"
 #include "../ovinferrequestsqueue.hpp"
 #include "../prediction_service_utils.hpp"
+#include "../request_tracer.hpp"
 #include "../serialization.hpp"
 #include "../servablemanagermodule.hpp"
 #include "../server.hpp"
@@ -246,6 +255,7 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
 
 ::grpc::Status KFSInferenceServiceImpl::ModelInfer(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response) {
     OVMS_PROFILE_FUNCTION();
+    RequestTraceScope traceScope("gRPC ModelInfer", isTraceRequested(context));
     Timer<TIMER_END> timer;
     timer.start(TOTAL);
     SPDLOG_DEBUG("Processing gRPC request for model: {}; version: {}",
@@ -331,13 +341,18 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
 
 Status KFSInferenceServiceImpl::ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
     OVMS_PROFILE_FUNCTION();
-#if (MEDIAPIPE_DISABLE == 0)
     ::inference::ModelInferRequest firstRequest;
     if (!stream->Read(&firstRequest)) {
         Status status = StatusCode::MEDIAPIPE_UNINITIALIZED_STREAM_CLOSURE;
         SPDLOG_DEBUG(status.string());
         return status;
     }
+    // Same servable lookup order as in unary ModelInfer
+    if (this->modelManager.findModelByName(firstRequest.model_name()) != nullptr ||
+        this->modelManager.getPipelineFactory().definitionExists(firstRequest.model_name())) {
+        return ModelStreamInferServableImpl(context, std::move(firstRequest), stream);
+    }
+#if (MEDIAPIPE_DISABLE == 0)
     std::shared_ptr<MediapipeGraphExecutor> executor;
     auto status = this->modelManager.createPipeline(executor, firstRequest.model_name(), &firstRequest, nullptr /* response not present in streaming api */);
     if (!status.ok()) {
@@ -345,11 +360,200 @@ Status KFSInferenceServiceImpl::ModelStreamInferImpl(::grpc::ServerContext* cont
     }
     return executor->inferStream(firstRequest, *stream);
 #else
-    SPDLOG_DEBUG("Mediapipe support was disabled during build process...");
-    return StatusCode::NOT_IMPLEMENTED;
+    SPDLOG_DEBUG("Requested servable: {} does not exist. Mediapipe support was disabled during build process...", firstRequest.model_name());
+    return StatusCode::MODEL_NAME_MISSING;
 #endif
 }
 
+namespace {
+struct StreamInferSlot {
+    KFSRequest request;
+    ::inference::ModelStreamInferResponse response;
+    bool processed = false;
+};
+}  // namespace
+
+static void processStreamRequest(KFSInferenceServiceImpl& impl, ::grpc::ServerContext* context, const KFSRequest& request, ::inference::ModelStreamInferResponse& response) {
+    RequestTraceScope traceScope("gRPC ModelStreamInfer", isTraceRequested(context));
+    Timer<TIMER_END> timer;
+    timer.start(TOTAL);
+    ServableMetricReporter* reporter = nullptr;
+    Status status;
+    try {
+        status = impl.ModelInferImpl(context, &request, response.mutable_infer_response(), ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter);
+    } catch (const std::exception& e) {
+        SPDLOG_ERROR("Caught exception in stream inference for servable: {} exception: {}", request.model_name(), e.what());
+        status = Status(StatusCode::UNKNOWN_ERROR, e.what());
+    } catch (...) {
+        SPDLOG_ERROR("Caught unknown exception in stream inference for servable: {}", request.model_name());
+        status = StatusCode::UNKNOWN_ERROR;
+    }
+    timer.stop(TOTAL);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Stream request for servable: {}; id: {} failed: {}", request.model_name(), request.id(), status.string());
+        response.Clear();
+        response.set_error_message(status.string());
+        // Failed request does not end the stream, id allows client to match the error with request
+        response.mutable_infer_response()->set_model_name(request.model_name());
+        response.mutable_infer_response()->set_id(request.id());
+        return;
+    }
+    if (reporter) {
+        OBSERVE_IF_ENABLED(reporter->requestTimeGrpc, timer.elapsed<std::chrono::microseconds>(TOTAL));
+    }
+}
+
+namespace {
+/**
+ * @brief Processes requests of single stream with at most maxInFlight worker threads reused for subsequent requests.
+ * Responses are written by separate thread in the order of requests. Threads are joined on destruction.
+ */
+class StreamInferProcessor {
+public:
+    StreamInferProcessor(KFSInferenceServiceImpl& impl, ::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream, size_t maxInFlight) :
+        impl(impl),
+        context(context),
+        stream(stream),
+        maxInFlight(maxInFlight) {}
+    ~StreamInferProcessor() {
+        finish();
+    }
+
+    Status start() {
+        try {
+            this->writer = std::thread(&StreamInferProcessor::writeResponses, this);
+        } catch (const std::system_error& e) {
+            SPDLOG_ERROR("Failed to start stream response writer thread: {}", e.what());
+            return StatusCode::INTERNAL_ERROR;
+        }
+        return StatusCode::OK;
+    }
+
+    // Waits until number of requests in flight is below limit
+    Status schedule(std::shared_ptr<StreamInferSlot> slot) {
+        {
+            std::unique_lock<std::mutex> lock(this->mtx);
+            this->cv.wait(lock, [this]() { return this->slots.size() < this->maxInFlight; });
+            this->slots.push_back(slot);
+            this->pending.push_back(slot);
+            if (this->idleWorkers < this->pending.size() && this->workers.size() < this->maxInFlight) {
+                try {
+                    this->workers.emplace_back(&StreamInferProcessor::processRequests, this);
+                } catch (const std::system_error& e) {
+                    SPDLOG_ERROR("Failed to start stream worker thread: {}", e.what());
+                    // Request is left to already running workers
+                    if (this->workers.empty()) {
+                        this->slots.pop_back();
+                        this->pending.pop_back();
+                        return StatusCode::INTERNAL_ERROR;
+                    }
+                }
+            }
+        }
+        this->cv.notify_all();
+        return StatusCode::OK;
+    }
+
+    bool isClientDisconnected() const {
+        return this->clientDisconnected.load();
+    }
+
+    // Processes remaining requests, writes their responses and joins threads
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(this->mtx);
+            this->readingFinished = true;
+        }
+        this->cv.notify_all();
+        for (auto& worker : this->workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        if (this->writer.joinable()) {
+            this->writer.join();
+        }
+    }
+
+private:
+    void processRequests() {
+        std::unique_lock<std::mutex> lock(this->mtx);
+        while (true) {
+            ++this->idleWorkers;
+            this->cv.wait(lock, [this]() { return !this->pending.empty() || this->readingFinished; });
+            --this->idleWorkers;
+            if (this->pending.empty()) {
+                return;
+            }
+            auto slot = this->pending.front();
+            this->pending.pop_front();
+            lock.unlock();
+            processStreamRequest(this->impl, this->context, slot->request, slot->response);
+            lock.lock();
+            slot->processed = true;
+            this->cv.notify_all();
+        }
+    }
+
+    void writeResponses() {
+        std::unique_lock<std::mutex> lock(this->mtx);
+        while (true) {
+            this->cv.wait(lock, [this]() { return this->slots.empty() ? this->readingFinished : this->slots.front()->processed; });
+            if (this->slots.empty()) {
+                return;
+            }
+            auto slot = this->slots.front();
+            lock.unlock();
+            if (!this->clientDisconnected.load() && !this->stream->Write(slot->response)) {
+                SPDLOG_DEBUG("Writing stream response to disconnected client");
+                this->clientDisconnected.store(true);
+            }
+            lock.lock();
+            this->slots.pop_front();
+            this->cv.notify_all();
+        }
+    }
+
+    KFSInferenceServiceImpl& impl;
+    ::grpc::ServerContext* context;
+    ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream;
+    const size_t maxInFlight;
+    std::mutex mtx;
+    std::condition_variable cv;
+    // Requests in arrival order until their responses are written
+    std::deque<std::shared_ptr<StreamInferSlot>> slots;
+    // Requests not yet taken by any worker
+    std::deque<std::shared_ptr<StreamInferSlot>> pending;
+    size_t idleWorkers = 0;
+    bool readingFinished = false;
+    std::atomic<bool> clientDisconnected{false};
+    std::vector<std::thread> workers;
+    std::thread writer;
+};
+}  // namespace
+
+Status KFSInferenceServiceImpl::ModelStreamInferServableImpl(::grpc::ServerContext* context, KFSRequest&& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
+    const size_t maxInFlight = Config::instance().grpcStreamMaxInFlight();
+    SPDLOG_DEBUG("Start streaming KServe requests to servable: {}; max requests in flight: {}", firstRequest.model_name(), maxInFlight);
+    StreamInferProcessor processor(*this, context, stream, maxInFlight);
+    auto status = processor.start();
+    if (!status.ok()) {
+        return status;
+    }
+    auto slot = std::make_shared<StreamInferSlot>();
+    slot->request = std::move(firstRequest);
+    do {
+        status = processor.schedule(std::move(slot));
+        if (!status.ok() || processor.isClientDisconnected()) {
+            break;
+        }
+        slot = std::make_shared<StreamInferSlot>();
+    } while (stream->Read(&slot->request));
+    processor.finish();
+    SPDLOG_DEBUG("Finished streaming KServe requests");
+    return status;
+}
+
 Status KFSInferenceServiceImpl::buildResponse(
     std::shared_ptr<ModelInstance> instance,
     KFSGetModelStatusResponse* response) {
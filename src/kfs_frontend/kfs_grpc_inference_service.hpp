@@ -83,6 +83,11 @@ public:
     static Status getModelReady(const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response, const ModelManager& manager, ExecutionContext executionContext);
 
 protected:
+    /**
+     * @brief Processes stream of requests to a model or DAG. Up to grpc_stream_max_in_flight requests are executed concurrently
+     * and responses are written in the order of requests.
+     */
+    Status ModelStreamInferServableImpl(::grpc::ServerContext* context, KFSRequest&& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream);
     Status getModelInstance(const KFSRequest* request,
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr);
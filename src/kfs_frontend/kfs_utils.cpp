@@ -35,6 +35,7 @@ Precision KFSPrecisionToOvmsPrecision(const KFSDataType& datatype) {
         {"FP64", Precision::FP64},
         {"FP32", Precision::FP32},
         {"FP16", Precision::FP16},
+        {"BF16", Precision::BF16},
         {"INT64", Precision::I64},
         {"INT32", Precision::I32},
         {"INT16", Precision::I16},
@@ -63,6 +64,7 @@ size_t KFSDataTypeSize(const KFSDataType& datatype) {
         {"INT32", 4},
         {"INT64", 8},
         {"FP16", 2},
+        {"BF16", 2},
         {"FP32", 4},
         {"FP64", 8},
         {"BYTES", 1}};
@@ -78,6 +80,7 @@ const KFSDataType& ovmsPrecisionToKFSPrecision(Precision precision) {
         {Precision::FP64, "FP64"},
         {Precision::FP32, "FP32"},
         {Precision::FP16, "FP16"},
+        {Precision::BF16, "BF16"},
         {Precision::I64, "INT64"},
         {Precision::I32, "INT32"},
         {Precision::I16, "INT16"},
@@ -88,7 +91,6 @@ const KFSDataType& ovmsPrecisionToKFSPrecision(Precision precision) {
         {Precision::U8, "UINT8"},
         {Precision::STRING, "BYTES"},
         {Precision::BOOL, "BOOL"}};
-    // {Precision::BF16, ""},
     // {Precision::U4, ""},
     // {Precision::U1, ""},
     // {Precision::CUSTOM, ""},
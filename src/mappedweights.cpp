@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "mappedweights.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+std::mutex MappedWeights::registryMtx;
+std::map<MappedWeights::file_key_t, std::weak_ptr<MappedWeights>> MappedWeights::registry;
+
+MappedWeights::~MappedWeights() {
+    {
+        std::lock_guard<std::mutex> lock(registryMtx);
+        auto it = registry.find(key);
+        // entry could be already replaced by new mapping of the same file
+        if (it != registry.end() && it->second.expired()) {
+            registry.erase(it);
+        }
+    }
+    if (munmap(address, length) != 0) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Failed to unmap weights file; error: {}", std::strerror(errno));
+    }
+}
+
+std::shared_ptr<MappedWeights> MappedWeights::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Failed to open weights file: {}; error: {}", path, std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Failed to stat or empty weights file: {}", path);
+        close(fd);
+        return nullptr;
+    }
+    file_key_t key{st.st_dev, st.st_ino, static_cast<uint64_t>(st.st_size), st.st_mtim.tv_sec, st.st_mtim.tv_nsec};
+    std::lock_guard<std::mutex> lock(registryMtx);
+    auto it = registry.find(key);
+    if (it != registry.end()) {
+        auto existing = it->second.lock();
+        if (existing) {
+            close(fd);
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reusing memory mapping of weights file: {}; size: {}", path, existing->size());
+            return existing;
+        }
+    }
+    void* address = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping stays valid after descriptor is closed
+    close(fd);
+    if (address == MAP_FAILED) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Failed to map weights file: {}; error: {}", path, std::strerror(errno));
+        return nullptr;
+    }
+    auto mapping = std::shared_ptr<MappedWeights>(new MappedWeights(address, st.st_size, key));
+    registry[key] = mapping;
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Mapped weights file: {}; size: {}", path, mapping->size());
+    return mapping;
+}
+
+size_t MappedWeights::getActiveMappingsCount() {
+    std::lock_guard<std::mutex> lock(registryMtx);
+    size_t count = 0;
+    for (const auto& [key, mapping] : registry) {
+        if (!mapping.expired()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+}  // namespace ovms
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace ovms {
+
+/**
+ * @brief Read-only memory mapping of a model weights file.
+ *
+ * Mappings are shared between all users opening the same file (same device, inode, size and modification time)
+ * so model instances loaded from the same weights do not hold separate copies. Mapping is released when the last
+ * user drops its reference.
+ */
+class MappedWeights {
+public:
+    ~MappedWeights();
+    MappedWeights(const MappedWeights&) = delete;
+    MappedWeights& operator=(const MappedWeights&) = delete;
+
+    /**
+     * @brief Returns shared mapping of the file, creating it if no other user holds it
+     *
+     * @param path
+     * @return mapping or nullptr if file could not be mapped
+     */
+    static std::shared_ptr<MappedWeights> open(const std::string& path);
+
+    const void* data() const { return address; }
+    size_t size() const { return length; }
+
+    static size_t getActiveMappingsCount();
+
+private:
+    using file_key_t = std::tuple<uint64_t, uint64_t, uint64_t, int64_t, int64_t>;
+
+    MappedWeights(void* address, size_t length, file_key_t key) :
+        address(address),
+        length(length),
+        key(key) {}
+
+    void* address;
+    size_t length;
+    file_key_t key;
+
+    static std::mutex registryMtx;
+    static std::map<file_key_t, std::weak_ptr<MappedWeights>> registry;
+};
+
+}  // namespace ovms
@@ -43,6 +43,7 @@
 
 namespace ovms {
 class MediapipeGraphDefinitionUnloadGuard;
+class MediapipeServableMetricReporter;
 class MetricConfig;
 class MetricRegistry;
 class ModelManager;
@@ -156,6 +157,8 @@ private:
     std::atomic<uint64_t> requestsHandlesCounter = 0;
 
     PythonBackend* pythonBackend;
+
+    std::unique_ptr<MediapipeServableMetricReporter> reporter;
 };
 
 class MediapipeGraphDefinitionUnloadGuard {
@@ -15,6 +15,8 @@
 //*****************************************************************************
 #include "mediapipegraphexecutor.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <limits>
@@ -23,14 +25,17 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "../boundedqueue.hpp"
 #include "../deserialization.hpp"
 #include "../execution_context.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
 #include "../metric.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../modelmanager.hpp"
 #include "../predict_request_validation_utils.hpp"
 #include "../serialization.hpp"
@@ -104,7 +109,7 @@ const Timestamp DEFAULT_STARTING_STREAM_TIMESTAMP = Timestamp(0);
             std::stringstream ss;                                            \
             ss << status.string() << "; " << message;                        \
             *resp.mutable_error_message() = ss.str();                        \
-            if (!streamSynchronizedWrite(stream, streamWriterMutex, resp)) { \
+            if (!outbound.push(std::move(resp))) {                           \
                 SPDLOG_DEBUG("Writing error to disconnected client");        \
             }                                                                \
         }                                                                    \
@@ -517,7 +522,8 @@ MediapipeGraphExecutor::MediapipeGraphExecutor(const std::string& name, const st
     stream_types_mapping_t outputTypes,
     std::vector<std::string> inputNames, std::vector<std::string> outputNames,
     const PythonNodeResourcesMap& pythonNodeResourcesMap,
-    PythonBackend* pythonBackend) :
+    PythonBackend* pythonBackend,
+    MediapipeServableMetricReporter* reporter) :
     name(name),
     version(version),
     config(config),
@@ -527,6 +533,7 @@ MediapipeGraphExecutor::MediapipeGraphExecutor(const std::string& name, const st
     outputNames(std::move(outputNames)),
     pythonNodeResourcesMap(pythonNodeResourcesMap),
     pythonBackend(pythonBackend),
+    reporter(reporter),
     currentStreamTimestamp(DEFAULT_STARTING_STREAM_TIMESTAMP) {}
 
 namespace {
@@ -847,7 +854,9 @@ static Status createPacketAndPushIntoGraph(const std::string& inputName, std::sh
 
 Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) const {
     Timer<TIMER_END> timer;
+    using std::chrono::microseconds;
     SPDLOG_DEBUG("Start unary KServe request mediapipe graph: {} execution", request->model_name());
+    timer.start(INITIALIZE_GRAPH);
     ::mediapipe::CalculatorGraph graph;
     MP_RETURN_ON_FAIL(graph.Initialize(this->config), std::string("failed initialization of MediaPipe graph: ") + request->model_name(), StatusCode::MEDIAPIPE_GRAPH_INITIALIZATION_ERROR);
     std::unordered_map<std::string, ::mediapipe::OutputStreamPoller> outputPollers;
@@ -870,6 +879,10 @@ Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* res
     sideInputPackets[PYTHON_SESSION_SIDE_PACKET_TAG] = mediapipe::MakePacket<PythonNodeResourcesMap>(this->pythonNodeResourcesMap).At(mediapipe::Timestamp(STARTING_TIMESTAMP));
 #endif
     MP_RETURN_ON_FAIL(graph.StartRun(sideInputPackets), std::string("start MediaPipe graph: ") + request->model_name(), StatusCode::MEDIAPIPE_GRAPH_START_ERROR);
+    timer.stop(INITIALIZE_GRAPH);
+    if (this->reporter) {
+        OBSERVE_IF_ENABLED(this->reporter->graphInitializationStageTime, timer.elapsed<microseconds>(INITIALIZE_GRAPH));
+    }
     if (static_cast<int>(this->inputNames.size()) != request->inputs().size()) {
         std::stringstream ss;
         ss << "Expected: " << this->inputNames.size() << "; Actual: " << request->inputs().size();
@@ -884,6 +897,7 @@ Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* res
     ovms::Status status;
     size_t insertedStreamPackets = 0;
     std::shared_ptr<const KFSRequest> requestWithNoOwnership(request, [](const KFSRequest* r) {});
+    timer.start(ADD_INPUT_PACKET);
     for (auto& inputName : this->inputNames) {
         OVMS_RETURN_ON_FAIL(createPacketAndPushIntoGraph<HolderWithNoRequestOwnership>(inputName, requestWithNoOwnership, graph, this->currentStreamTimestamp, this->inputTypes, pythonBackend));
         ++insertedStreamPackets;
@@ -895,9 +909,15 @@ Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* res
             this->name);
         return Status(StatusCode::INTERNAL_ERROR, "Not all input packets created");
     }
+    timer.stop(ADD_INPUT_PACKET);
+    if (this->reporter) {
+        OBSERVE_IF_ENABLED(this->reporter->deserializationStageTime, timer.elapsed<microseconds>(ADD_INPUT_PACKET));
+    }
     // we wait idle since some calculators could hold ownership on packet content while nodes further down the graph
     // can be still processing those. Closing packet sources triggers Calculator::Close() on nodes that do not expect
     // new packets
+    timer.start(RUN_GRAPH);
+    double serializationTime = 0;
     MP_RETURN_ON_FAIL(graph.WaitUntilIdle(), "graph wait until idle", StatusCode::MEDIAPIPE_EXECUTION_ERROR);
     MP_RETURN_ON_FAIL(graph.CloseAllPacketSources(), "graph close all packet sources", StatusCode::MEDIAPIPE_GRAPH_CLOSE_INPUT_STREAM_ERROR);
     for (auto& [outputStreamName, poller] : outputPollers) {
@@ -905,17 +925,26 @@ Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* res
         SPDLOG_DEBUG("Will wait for output stream: {} packet", outputStreamName);
         if (poller.Next(&packet)) {
             SPDLOG_DEBUG("Received packet from output stream: {}", outputStreamName);
+            timer.start(FETCH_OUTPUT);
             OVMS_RETURN_ON_FAIL(serializePacket(outputStreamName, *response, packet));
+            timer.stop(FETCH_OUTPUT);
+            serializationTime += timer.elapsed<microseconds>(FETCH_OUTPUT);
             outputPollersWithReceivedPacket.insert(outputStreamName);
             ++receivedOutputs;
         }
         SPDLOG_TRACE("Received all: {} packets for: {}", receivedOutputs, outputStreamName);
     }
     MP_RETURN_ON_FAIL(graph.WaitUntilDone(), "grap wait until done", StatusCode::MEDIAPIPE_EXECUTION_ERROR);
+    timer.stop(RUN_GRAPH);
     if (outputPollers.size() != outputPollersWithReceivedPacket.size()) {
         SPDLOG_DEBUG("Mediapipe failed to execute. Failed to receive all output packets");
         return Status(StatusCode::MEDIAPIPE_EXECUTION_ERROR, "Unknown error during mediapipe execution");
     }
+    if (this->reporter) {
+        // Serialization runs while graph is still executing so it is excluded from execution stage
+        OBSERVE_IF_ENABLED(this->reporter->executionStageTime, timer.elapsed<microseconds>(RUN_GRAPH) - serializationTime);
+        OBSERVE_IF_ENABLED(this->reporter->serializationStageTime, serializationTime);
+    }
     SPDLOG_DEBUG("Received all output stream packets for graph: {}", request->model_name());
     response->set_model_name(request->model_name());
     response->set_id(request->id());
@@ -975,30 +1004,108 @@ Status MediapipeGraphExecutor::validateSubsequentRequest(const ::inference::Mode
     return StatusCode::OK;
 }
 
-static bool streamSynchronizedWrite(::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream,
-    std::mutex& mtx, ::inference::ModelStreamInferResponse& resp) {
-    const std::lock_guard<std::mutex> lock(mtx);
-    return stream.Write(resp);
-}
+namespace {
+/**
+ * @brief Bounded queue of a single stream with dedicated consumer thread.
+ * Reports queue depth and time of waiting for free space to servable metrics.
+ */
+template <typename T>
+class StreamQueueWorker {
+public:
+    StreamQueueWorker(const char* direction, MetricHistogram* depthMetric, MetricHistogram* backpressureMetric, std::function<bool(T&)> consume) :
+        direction(direction),
+        depthMetric(depthMetric),
+        backpressureMetric(backpressureMetric),
+        queue(MediapipeGraphExecutor::STREAM_QUEUE_CAPACITY),
+        consumer([this, consume]() {
+            while (auto element = this->queue.pop()) {
+                if (!consume(element.value())) {
+                    // Consumer cannot continue, reject further messages
+                    this->queue.close();
+                    break;
+                }
+            }
+        }) {}
+
+    ~StreamQueueWorker() {
+        this->finish();
+    }
+
+    /**
+     * @brief Queues element, waiting if queue is full
+     *
+     * @return false if consumer has stopped
+     */
+    bool push(T&& element) {
+        size_t depth = 0;
+        std::chrono::microseconds waited{0};
+        if (!this->queue.push(std::move(element), depth, waited)) {
+            return false;
+        }
+        OBSERVE_IF_ENABLED(this->depthMetric, depth);
+        OBSERVE_IF_ENABLED(this->backpressureMetric, waited.count());
+        size_t currentMax = this->maxDepth.load(std::memory_order_relaxed);
+        while (depth > currentMax && !this->maxDepth.compare_exchange_weak(currentMax, depth, std::memory_order_relaxed)) {
+        }
+        this->backpressureMicroseconds.fetch_add(waited.count(), std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Waits until consumer processes already queued elements
+     */
+    void finish() {
+        this->queue.close();
+        if (this->consumer.joinable()) {
+            this->consumer.join();
+        }
+    }
+
+    void logSummary(const std::string& graphName) const {
+        SPDLOG_DEBUG("Graph {}: {} stream queue max depth: {}; backpressure time: {} us", graphName, this->direction, this->maxDepth.load(), this->backpressureMicroseconds.load());
+    }
+
+private:
+    const char* direction;
+    MetricHistogram* depthMetric;
+    MetricHistogram* backpressureMetric;
+    std::atomic<size_t> maxDepth{0};
+    std::atomic<uint64_t> backpressureMicroseconds{0};
+    BoundedQueue<T> queue;
+    std::thread consumer;
+};
+}  // namespace
 
 Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream) {
     SPDLOG_DEBUG("Start streaming KServe request mediapipe graph: {} execution", this->name);
-    std::mutex streamWriterMutex;
     try {
+        // Responses are written by dedicated thread so slow client does not block graph outputs until queue is full.
+        // Declared before the graph to outlive output stream observers.
+        StreamQueueWorker<::inference::ModelStreamInferResponse> outbound("outbound",
+            this->reporter ? this->reporter->outboundQueueDepth.get() : nullptr,
+            this->reporter ? this->reporter->outboundBackpressureTime.get() : nullptr,
+            [&stream](::inference::ModelStreamInferResponse& resp) {
+                if (!stream.Write(resp)) {
+                    SPDLOG_DEBUG("Client disconnected, stopping writing stream responses");
+                    return false;
+                }
+                return true;
+            });
+
         // Init
         ::mediapipe::CalculatorGraph graph;
         MP_RETURN_ON_FAIL(graph.Initialize(this->config), "graph initialization", StatusCode::MEDIAPIPE_GRAPH_INITIALIZATION_ERROR);
 
         // Installing observers
         for (const auto& outputName : this->outputNames) {
-            MP_RETURN_ON_FAIL(graph.ObserveOutputStream(outputName, [&stream, &streamWriterMutex, &outputName, this](const ::mediapipe::Packet& packet) -> absl::Status {
+            MP_RETURN_ON_FAIL(graph.ObserveOutputStream(outputName, [&outbound, &outputName, this](const ::mediapipe::Packet& packet) -> absl::Status {
                 try {
                     ::inference::ModelStreamInferResponse resp;
                     OVMS_RETURN_MP_ERROR_ON_FAIL(serializePacket(outputName, *resp.mutable_infer_response(), packet), "error in serialization");
                     *resp.mutable_infer_response()->mutable_model_name() = this->name;
                     *resp.mutable_infer_response()->mutable_model_version() = this->version;
                     resp.mutable_infer_response()->mutable_parameters()->operator[](MediapipeGraphExecutor::TIMESTAMP_PARAMETER_NAME).set_int64_param(packet.Timestamp().Value());
-                    if (!streamSynchronizedWrite(stream, streamWriterMutex, resp)) {
+                    if (!outbound.push(std::move(resp))) {
                         return absl::Status(absl::StatusCode::kCancelled, "client disconnected");
                     }
                     return absl::OkStatus();
@@ -1027,24 +1134,37 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
                                                   graph),
             "partial deserialization of first request");
 
+        // Subsequent requests are deserialized by dedicated thread so reading is not blocked by deserialization.
+        // Declared after the graph to stop pushing packets before graph is destroyed.
+        StreamQueueWorker<std::shared_ptr<::inference::ModelInferRequest>> inbound("inbound",
+            this->reporter ? this->reporter->inboundQueueDepth.get() : nullptr,
+            this->reporter ? this->reporter->inboundBackpressureTime.get() : nullptr,
+            [this, &graph, &outbound](std::shared_ptr<::inference::ModelInferRequest>& req) {
+                auto pstatus = this->validateSubsequentRequest(*req);
+                if (pstatus.ok()) {
+                    OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->partialDeserialize(req, graph), "partial deserialization of subsequent requests");
+                } else {
+                    OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(pstatus, "validate subsequent requests");
+                }
+                if (graph.HasError()) {
+                    SPDLOG_DEBUG("Graph {}: encountered an error, stopping the execution", this->name);
+                    return false;
+                }
+                return true;
+            });
+
         // Read loop
         // Here we create ModelInferRequest with shared ownership,
         // and move it down to custom packet holder to ensure
         // lifetime is extended to lifetime of deserialized Packets.
         auto req = std::make_shared<::inference::ModelInferRequest>();
         while (stream.Read(req.get())) {
-            auto pstatus = this->validateSubsequentRequest(*req);
-            if (pstatus.ok()) {
-                OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->partialDeserialize(req, graph), "partial deserialization of subsequent requests");
-            } else {
-                OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(pstatus, "validate subsequent requests");
-            }
-            if (graph.HasError()) {
-                SPDLOG_DEBUG("Graph {}: encountered an error, stopping the execution", this->name);
+            if (!inbound.push(std::move(req))) {
                 break;
             }
             req = std::make_shared<::inference::ModelInferRequest>();
         }
+        inbound.finish();
 
         SPDLOG_DEBUG("Graph {}: Closing packet sources...", this->name);
         // Close input streams
@@ -1052,6 +1172,9 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
 
         SPDLOG_DEBUG("Graph {}: Closed all packet sources. Waiting untill done...", this->name);
         MP_RETURN_ON_FAIL(graph.WaitUntilDone(), "waiting until done", StatusCode::MEDIAPIPE_EXECUTION_ERROR);
+        outbound.finish();
+        inbound.logSummary(this->name);
+        outbound.logSummary(this->name);
         SPDLOG_DEBUG("Graph {}: Done execution", this->name);
         return StatusCode::OK;
     } catch (...) {
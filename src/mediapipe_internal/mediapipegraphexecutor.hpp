@@ -33,6 +33,7 @@
 #include "packettypes.hpp"
 
 namespace ovms {
+class MediapipeServableMetricReporter;
 class Status;
 class PythonNodeResources;
 class PythonBackend;
@@ -48,6 +49,7 @@ class MediapipeGraphExecutor {
 
     PythonNodeResourcesMap pythonNodeResourcesMap;
     PythonBackend* pythonBackend;
+    MediapipeServableMetricReporter* reporter;
 
     ::mediapipe::Timestamp currentStreamTimestamp;
 
@@ -60,12 +62,15 @@ protected:
 
 public:
     static const std::string TIMESTAMP_PARAMETER_NAME;
+    // Capacity of inbound and outbound message queues of a single stream
+    static constexpr size_t STREAM_QUEUE_CAPACITY = 16;
     MediapipeGraphExecutor(const std::string& name, const std::string& version, const ::mediapipe::CalculatorGraphConfig& config,
         stream_types_mapping_t inputTypes,
         stream_types_mapping_t outputTypes,
         std::vector<std::string> inputNames, std::vector<std::string> outputNames,
         const PythonNodeResourcesMap& pythonNodeResourcesMap,
-        PythonBackend* pythonBackend);
+        PythonBackend* pythonBackend,
+        MediapipeServableMetricReporter* reporter = nullptr);
     Status infer(const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) const;
 
     Status inferStream(const ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>& stream);
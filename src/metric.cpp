@@ -15,17 +15,125 @@
 //*****************************************************************************
 #include "metric.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+
 #include <prometheus/counter.h>
 #include <prometheus/gauge.h>
 #include <prometheus/histogram.h>
 
 namespace ovms {
 
-MetricCounter::MetricCounter(prometheus::Counter& counterImpl) :
-    counterImpl(counterImpl) {}
+static constexpr size_t MAX_METRIC_SHARDS_COUNT = 64;
+static constexpr size_t VALUES_PER_SHARD_LINE = 8;
+
+struct alignas(64) MetricShardLine {
+    std::atomic<uint64_t> values[VALUES_PER_SHARD_LINE] = {};
+};
+
+static size_t getShardsCount() {
+    static const size_t shardsCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_METRIC_SHARDS_COUNT);
+    return shardsCount;
+}
+
+// Threads are assigned to shards in round robin fashion on first use of any metric
+static size_t getThreadShardIndex() {
+    static std::atomic<size_t> nextThreadIndex{0};
+    thread_local const size_t shardIndex = nextThreadIndex.fetch_add(1, std::memory_order_relaxed) % getShardsCount();
+    return shardIndex;
+}
+
+static uint64_t toBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static double fromBits(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static void addToShard(std::atomic<uint64_t>& shardValue, double value) {
+    uint64_t expected = shardValue.load(std::memory_order_relaxed);
+    while (!shardValue.compare_exchange_weak(expected, toBits(fromBits(expected) + value), std::memory_order_relaxed)) {
+    }
+}
+
+static double takeFromShard(std::atomic<uint64_t>& shardValue) {
+    return fromBits(shardValue.exchange(toBits(0.0), std::memory_order_relaxed));
+}
+
+void ShardedMetricSet::add(ShardedMetric* metric, const void* familyImpl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    this->metrics[metric] = familyImpl;
+}
+
+void ShardedMetricSet::detach(ShardedMetric* metric) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (this->metrics.erase(metric) > 0) {
+        metric->flush();
+    }
+}
+
+void ShardedMetricSet::remove(ShardedMetric* metric, const void* familyImpl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = this->metrics.find(metric);
+    if (it != this->metrics.end() && it->second == familyImpl) {
+        this->metrics.erase(it);
+    }
+}
+
+void ShardedMetricSet::removeFamily(const void* familyImpl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto it = this->metrics.begin(); it != this->metrics.end();) {
+        if (it->second == familyImpl) {
+            it = this->metrics.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ShardedMetricSet::flush() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto& [metric, familyImpl] : this->metrics) {
+        metric->flush();
+    }
+}
+
+MetricCounter::MetricCounter(prometheus::Counter& counterImpl, std::weak_ptr<ShardedMetricSet> shardedMetrics) :
+    counterImpl(counterImpl),
+    shards(std::make_unique<MetricShardLine[]>(getShardsCount())),
+    shardedMetrics(std::move(shardedMetrics)) {}
+
+MetricCounter::~MetricCounter() {
+    if (auto metrics = this->shardedMetrics.lock()) {
+        metrics->detach(this);
+    }
+}
 
 void MetricCounter::increment(double value) {
-    this->counterImpl.Increment(value);
+    // Same as in prometheus counter, negative increments are ignored
+    if (value < 0.0) {
+        return;
+    }
+    addToShard(this->shards[getThreadShardIndex()].values[0], value);
+}
+
+void MetricCounter::flush() {
+    double value = 0.0;
+    for (size_t i = 0; i < getShardsCount(); i++) {
+        value += takeFromShard(this->shards[i].values[0]);
+    }
+    if (value > 0.0) {
+        this->counterImpl.Increment(value);
+    }
 }
 
 MetricGauge::MetricGauge(prometheus::Gauge& gaugeImpl) :
@@ -43,11 +151,58 @@ void MetricGauge::set(double value) {
     this->gaugeImpl.Set(value);
 }
 
-MetricHistogram::MetricHistogram(prometheus::Histogram& histogramImpl) :
-    histogramImpl(histogramImpl) {}
+static std::vector<double> getBucketBoundaries(prometheus::Histogram& histogramImpl) {
+    std::vector<double> bucketBoundaries;
+    const auto buckets = histogramImpl.Collect().histogram.bucket;
+    // last bucket is +Inf
+    for (size_t i = 0; i + 1 < buckets.size(); i++) {
+        bucketBoundaries.emplace_back(buckets[i].upper_bound);
+    }
+    return bucketBoundaries;
+}
+
+MetricHistogram::MetricHistogram(prometheus::Histogram& histogramImpl, std::weak_ptr<ShardedMetricSet> shardedMetrics) :
+    histogramImpl(histogramImpl),
+    bucketBoundaries(getBucketBoundaries(histogramImpl)),
+    // sum and bucket counts including +Inf bucket
+    linesPerShard((this->bucketBoundaries.size() + 2 + VALUES_PER_SHARD_LINE - 1) / VALUES_PER_SHARD_LINE),
+    shards(std::make_unique<MetricShardLine[]>(getShardsCount() * linesPerShard)),
+    shardedMetrics(std::move(shardedMetrics)) {}
+
+MetricHistogram::~MetricHistogram() {
+    if (auto metrics = this->shardedMetrics.lock()) {
+        metrics->detach(this);
+    }
+}
 
 void MetricHistogram::observe(double value) {
-    this->histogramImpl.Observe(value);
+    // Value belongs to the first bucket with upper bound not less than value, same as in prometheus histogram
+    size_t bucket = std::lower_bound(this->bucketBoundaries.begin(), this->bucketBoundaries.end(), value) - this->bucketBoundaries.begin();
+    auto* shard = &this->shards[getThreadShardIndex() * this->linesPerShard];
+    addToShard(shard[0].values[0], value);
+    size_t position = bucket + 1;
+    shard[position / VALUES_PER_SHARD_LINE].values[position % VALUES_PER_SHARD_LINE].fetch_add(1, std::memory_order_relaxed);
+}
+
+void MetricHistogram::flush() {
+    std::vector<double> bucketIncrements(this->bucketBoundaries.size() + 1, 0.0);
+    double sum = 0.0;
+    bool observed = false;
+    for (size_t i = 0; i < getShardsCount(); i++) {
+        auto* shard = &this->shards[i * this->linesPerShard];
+        sum += takeFromShard(shard[0].values[0]);
+        for (size_t bucket = 0; bucket < bucketIncrements.size(); bucket++) {
+            size_t position = bucket + 1;
+            uint64_t count = shard[position / VALUES_PER_SHARD_LINE].values[position % VALUES_PER_SHARD_LINE].exchange(0, std::memory_order_relaxed);
+            if (count > 0) {
+                bucketIncrements[bucket] += static_cast<double>(count);
+                observed = true;
+            }
+        }
+    }
+    if (observed) {
+        this->histogramImpl.ObserveMultiple(bucketIncrements, sum);
+    }
 }
 
 }  // namespace ovms
@@ -15,7 +15,11 @@
 //*****************************************************************************
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace prometheus {
 class Counter;
@@ -45,18 +49,53 @@ namespace ovms {
 template <typename T>
 class MetricFamily;
 
-class MetricCounter {
+struct MetricShardLine;
+
+/**
+ * @brief Metric accumulating values in per thread shards instead of shared prometheus object.
+ * Shards are moved into prometheus object with flush, when metrics are collected.
+ */
+class ShardedMetric {
+public:
+    virtual ~ShardedMetric() = default;
+    virtual void flush() = 0;
+};
+
+/**
+ * @brief Sharded metrics of single registry, shared with metrics so they can detach themselves when destroyed.
+ */
+class ShardedMetricSet {
+public:
+    void add(ShardedMetric* metric, const void* familyImpl);
+    // Flushes metric for the last time and stops tracking it
+    void detach(ShardedMetric* metric);
+    // Stops tracking metric without flushing since its prometheus object is removed
+    void remove(ShardedMetric* metric, const void* familyImpl);
+    void removeFamily(const void* familyImpl);
+    void flush();
+
 private:
-    MetricCounter(prometheus::Counter& counterImpl);
+    std::mutex mtx;
+    std::unordered_map<ShardedMetric*, const void*> metrics;
+};
+
+class MetricCounter : public ShardedMetric {
+private:
+    MetricCounter(prometheus::Counter& counterImpl, std::weak_ptr<ShardedMetricSet> shardedMetrics);
     MetricCounter(const MetricCounter&) = delete;
     MetricCounter(MetricCounter&&) = delete;
     MetricCounter& operator=(const MetricCounter&) = delete;
 
 public:
+    ~MetricCounter();
+
     void increment(double value = 1.0f);
+    void flush() override;
 
 private:
     prometheus::Counter& counterImpl;
+    std::unique_ptr<MetricShardLine[]> shards;
+    std::weak_ptr<ShardedMetricSet> shardedMetrics;
 
     friend class MetricFamily<MetricCounter>;
 };
@@ -78,17 +117,25 @@ private:
     friend class MetricFamily<MetricGauge>;
 };
 
-class MetricHistogram {
+class MetricHistogram : public ShardedMetric {
 public:
-    MetricHistogram(prometheus::Histogram& histogramImpl);
+    MetricHistogram(prometheus::Histogram& histogramImpl, std::weak_ptr<ShardedMetricSet> shardedMetrics);
     MetricHistogram(const MetricHistogram&) = delete;
     MetricHistogram(MetricCounter&&) = delete;
     MetricHistogram& operator=(const MetricHistogram&) = delete;
+    ~MetricHistogram();
 
     void observe(double value);
+    void flush() override;
 
 private:
     prometheus::Histogram& histogramImpl;
+    // Boundaries of prometheus histogram, which could be created earlier with different boundaries for the same labels
+    const std::vector<double> bucketBoundaries;
+    // Each shard holds sum of observed values followed by bucket counts, padded to cache lines
+    size_t linesPerShard;
+    std::unique_ptr<MetricShardLine[]> shards;
+    std::weak_ptr<ShardedMetricSet> shardedMetrics;
 
     friend class MetricFamily<MetricHistogram>;
 };
@@ -38,12 +38,33 @@ const std::string METRIC_NAME_STREAMS = "ovms_streams";
 const std::string METRIC_NAME_INFER_REQ_QUEUE_SIZE = "ovms_infer_req_queue_size";
 
 const std::string METRIC_NAME_INFER_REQ_ACTIVE = "ovms_infer_req_active";
+const std::string METRIC_NAME_INFER_REQ_WAITING = "ovms_infer_req_waiting";
+const std::string METRIC_NAME_INFER_REQ_UTILIZATION = "ovms_infer_req_utilization";
 
 const std::string METRIC_NAME_INFERENCE_TIME = "ovms_inference_time_us";
 const std::string METRIC_NAME_CURRENT_REQUESTS = "ovms_current_requests";
 const std::string METRIC_NAME_REQUEST_TIME = "ovms_request_time_us";
 const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME = "ovms_wait_for_infer_req_time_us";
 
+const std::string METRIC_NAME_COMPILE_TIME = "ovms_compile_time_us";
+const std::string METRIC_NAME_SHAPE_CACHE_HITS = "ovms_shape_cache_hits";
+const std::string METRIC_NAME_SHAPE_CACHE_MISSES = "ovms_shape_cache_misses";
+
+const std::string METRIC_NAME_PIPELINE_BYTES_COPIED = "ovms_pipeline_bytes_copied";
+const std::string METRIC_NAME_PIPELINE_TENSOR_POOL_HITS = "ovms_pipeline_tensor_pool_hits";
+const std::string METRIC_NAME_PIPELINE_TENSOR_POOL_MISSES = "ovms_pipeline_tensor_pool_misses";
+const std::string METRIC_NAME_PIPELINE_TENSOR_POOL_HELD_BYTES = "ovms_pipeline_tensor_pool_held_bytes";
+
+const std::string METRIC_NAME_REQUEST_STAGE_TIME = "ovms_request_stage_time_us";
+const std::string METRIC_NAME_PIPELINE_NODE_TIME = "ovms_pipeline_node_time_us";
+
+const std::string METRIC_NAME_STREAM_QUEUE_DEPTH = "ovms_stream_queue_depth";
+const std::string METRIC_NAME_STREAM_BACKPRESSURE_TIME = "ovms_stream_backpressure_time_us";
+
+const std::string METRIC_NAME_CLOUD_MODEL_CACHE_HITS = "ovms_cloud_model_cache_hits";
+const std::string METRIC_NAME_CLOUD_MODEL_CACHE_MISSES = "ovms_cloud_model_cache_misses";
+const std::string METRIC_NAME_CLOUD_MODEL_CACHE_BYTES_SAVED = "ovms_cloud_model_cache_bytes_saved";
+
 bool MetricConfig::validateEndpointPath(const std::string& endpoint) {
     std::regex valid_endpoint_regex("^/[a-zA-Z0-9]*$");
     return std::regex_match(endpoint, valid_endpoint_regex);
@@ -30,12 +30,33 @@ extern const std::string METRIC_NAME_STREAMS;
 extern const std::string METRIC_NAME_INFER_REQ_QUEUE_SIZE;
 
 extern const std::string METRIC_NAME_INFER_REQ_ACTIVE;
+extern const std::string METRIC_NAME_INFER_REQ_WAITING;
+extern const std::string METRIC_NAME_INFER_REQ_UTILIZATION;
 
 extern const std::string METRIC_NAME_INFERENCE_TIME;
 extern const std::string METRIC_NAME_CURRENT_REQUESTS;
 extern const std::string METRIC_NAME_REQUEST_TIME;
 extern const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME;
 
+extern const std::string METRIC_NAME_COMPILE_TIME;
+extern const std::string METRIC_NAME_SHAPE_CACHE_HITS;
+extern const std::string METRIC_NAME_SHAPE_CACHE_MISSES;
+
+extern const std::string METRIC_NAME_PIPELINE_BYTES_COPIED;
+extern const std::string METRIC_NAME_PIPELINE_TENSOR_POOL_HITS;
+extern const std::string METRIC_NAME_PIPELINE_TENSOR_POOL_MISSES;
+extern const std::string METRIC_NAME_PIPELINE_TENSOR_POOL_HELD_BYTES;
+
+extern const std::string METRIC_NAME_REQUEST_STAGE_TIME;
+extern const std::string METRIC_NAME_PIPELINE_NODE_TIME;
+
+extern const std::string METRIC_NAME_STREAM_QUEUE_DEPTH;
+extern const std::string METRIC_NAME_STREAM_BACKPRESSURE_TIME;
+
+extern const std::string METRIC_NAME_CLOUD_MODEL_CACHE_HITS;
+extern const std::string METRIC_NAME_CLOUD_MODEL_CACHE_MISSES;
+extern const std::string METRIC_NAME_CLOUD_MODEL_CACHE_BYTES_SAVED;
+
 class Status;
 /**
      * @brief This class represents metrics configuration
@@ -74,7 +95,23 @@ private:
 
     std::unordered_set<std::string> additionalMetricFamilies = {
         {METRIC_NAME_INFER_REQ_QUEUE_SIZE},
-        {METRIC_NAME_INFER_REQ_ACTIVE}};
+        {METRIC_NAME_INFER_REQ_ACTIVE},
+        {METRIC_NAME_INFER_REQ_WAITING},
+        {METRIC_NAME_INFER_REQ_UTILIZATION},
+        {METRIC_NAME_COMPILE_TIME},
+        {METRIC_NAME_SHAPE_CACHE_HITS},
+        {METRIC_NAME_SHAPE_CACHE_MISSES},
+        {METRIC_NAME_PIPELINE_BYTES_COPIED},
+        {METRIC_NAME_PIPELINE_TENSOR_POOL_HITS},
+        {METRIC_NAME_PIPELINE_TENSOR_POOL_MISSES},
+        {METRIC_NAME_PIPELINE_TENSOR_POOL_HELD_BYTES},
+        {METRIC_NAME_REQUEST_STAGE_TIME},
+        {METRIC_NAME_PIPELINE_NODE_TIME},
+        {METRIC_NAME_STREAM_QUEUE_DEPTH},
+        {METRIC_NAME_STREAM_BACKPRESSURE_TIME},
+        {METRIC_NAME_CLOUD_MODEL_CACHE_HITS},
+        {METRIC_NAME_CLOUD_MODEL_CACHE_MISSES},
+        {METRIC_NAME_CLOUD_MODEL_CACHE_BYTES_SAVED}};
 
     std::unordered_set<std::string> defaultMetricFamilies = {
         {METRIC_NAME_CURRENT_REQUESTS},
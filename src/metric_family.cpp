@@ -15,6 +15,8 @@
 //*****************************************************************************
 #include "metric_family.hpp"
 
+#include <utility>
+
 #include <prometheus/counter.h>
 #include <prometheus/gauge.h>
 #include <prometheus/histogram.h>
@@ -25,37 +27,44 @@
 namespace ovms {
 
 template <>
-MetricFamily<MetricCounter>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef) :
+MetricFamily<MetricCounter>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef, std::weak_ptr<ShardedMetricSet> shardedMetrics) :
     registryImplRef(registryImplRef),
     familyImplRef(&prometheus::BuildCounter()
                        .Name(name)
                        .Help(description)
-                       .Register(this->registryImplRef)) {
+                       .Register(this->registryImplRef)),
+    shardedMetrics(std::move(shardedMetrics)) {
 }
 
 template <>
-MetricFamily<MetricGauge>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef) :
+MetricFamily<MetricGauge>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef, std::weak_ptr<ShardedMetricSet> shardedMetrics) :
     registryImplRef(registryImplRef),
     familyImplRef(&prometheus::BuildGauge()
                        .Name(name)
                        .Help(description)
-                       .Register(this->registryImplRef)) {
+                       .Register(this->registryImplRef)),
+    shardedMetrics(std::move(shardedMetrics)) {
 }
 
 template <>
-MetricFamily<MetricHistogram>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef) :
+MetricFamily<MetricHistogram>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef, std::weak_ptr<ShardedMetricSet> shardedMetrics) :
     registryImplRef(registryImplRef),
     familyImplRef(&prometheus::BuildHistogram()
                        .Name(name)
                        .Help(description)
-                       .Register(this->registryImplRef)) {
+                       .Register(this->registryImplRef)),
+    shardedMetrics(std::move(shardedMetrics)) {
 }
 
 template <>
 std::unique_ptr<MetricCounter> MetricFamily<MetricCounter>::addMetric(const MetricLabels& labels, const BucketBoundaries& bucketBoundaries) {
     auto familyImpl = static_cast<prometheus::Family<prometheus::Counter>*>(this->familyImplRef);
     prometheus::Counter& counterImpl = familyImpl->Add(labels);
-    return std::unique_ptr<MetricCounter>(new MetricCounter(counterImpl));
+    auto metric = std::unique_ptr<MetricCounter>(new MetricCounter(counterImpl, this->shardedMetrics));
+    if (auto metrics = this->shardedMetrics.lock()) {
+        metrics->add(metric.get(), this->familyImplRef);
+    }
+    return metric;
 }
 
 template <>
@@ -69,12 +78,19 @@ template <>
 std::unique_ptr<MetricHistogram> MetricFamily<MetricHistogram>::addMetric(const MetricLabels& labels, const BucketBoundaries& bucketBoundaries) {
     auto familyImpl = static_cast<prometheus::Family<prometheus::Histogram>*>(this->familyImplRef);
     prometheus::Histogram& histogramImpl = familyImpl->Add(labels, bucketBoundaries);
-    return std::unique_ptr<MetricHistogram>(new MetricHistogram(histogramImpl));
+    auto metric = std::unique_ptr<MetricHistogram>(new MetricHistogram(histogramImpl, this->shardedMetrics));
+    if (auto metrics = this->shardedMetrics.lock()) {
+        metrics->add(metric.get(), this->familyImplRef);
+    }
+    return metric;
 }
 
 template <>
 void MetricFamily<MetricCounter>::remove(std::unique_ptr<MetricCounter>& metric) {
     auto family = static_cast<prometheus::Family<prometheus::Counter>*>(this->familyImplRef);
+    if (auto metrics = this->shardedMetrics.lock()) {
+        metrics->remove(metric.get(), this->familyImplRef);
+    }
     family->Remove(&metric->counterImpl);
 }
 
@@ -87,6 +103,9 @@ void MetricFamily<MetricGauge>::remove(std::unique_ptr<MetricGauge>& metric) {
 template <>
 void MetricFamily<MetricHistogram>::remove(std::unique_ptr<MetricHistogram>& metric) {
     auto family = static_cast<prometheus::Family<prometheus::Histogram>*>(this->familyImplRef);
+    if (auto metrics = this->shardedMetrics.lock()) {
+        metrics->remove(metric.get(), this->familyImplRef);
+    }
     family->Remove(&metric->histogramImpl);
 }
 
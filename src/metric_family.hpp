@@ -30,11 +30,12 @@ using MetricLabels = std::map<std::string, std::string>;
 using BucketBoundaries = std::vector<double>;
 
 class MetricRegistry;
+class ShardedMetricSet;
 
 template <typename MetricType>
 class MetricFamily {
 private:
-    MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef);
+    MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef, std::weak_ptr<ShardedMetricSet> shardedMetrics);
     MetricFamily(const MetricFamily&) = delete;
     MetricFamily(MetricFamily&&) = delete;
     MetricFamily& operator=(const MetricFamily&) = delete;
@@ -49,6 +50,7 @@ public:
 private:
     prometheus::Registry& registryImplRef;
     void* familyImplRef;  // This is reference to prometheus::Family<T> where T is prometheus::Counter/Gauge/Histogram depending on MetricType.
+    std::weak_ptr<ShardedMetricSet> shardedMetrics;
 
     friend class MetricRegistry;
 };
@@ -23,15 +23,18 @@
 
 namespace ovms {
 
-MetricRegistry::MetricRegistry() = default;
+MetricRegistry::MetricRegistry() :
+    shardedMetrics(std::make_shared<ShardedMetricSet>()) {}
 
 std::string MetricRegistry::collect() const {
+    this->shardedMetrics->flush();
     prometheus::TextSerializer serializer;
     return serializer.Serialize(this->registryImpl.Collect());
 }
 
 template <>
 bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricCounter>> family) {
+    this->shardedMetrics->removeFamily(family->familyImplRef);
     return this->registryImpl.Remove(*static_cast<prometheus::Family<prometheus::Counter>*>(family->familyImplRef));
 }
 
@@ -42,6 +45,7 @@ bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricGauge>> family) {
 
 template <>
 bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricHistogram>> family) {
+    this->shardedMetrics->removeFamily(family->familyImplRef);
     return this->registryImpl.Remove(*static_cast<prometheus::Family<prometheus::Histogram>*>(family->familyImplRef));
 }
 
@@ -24,6 +24,7 @@ namespace ovms {
 
 template <typename MetricType>
 class MetricFamily;
+class ShardedMetricSet;
 
 class MetricRegistry {
 public:
@@ -36,7 +37,7 @@ public:
     std::shared_ptr<MetricFamily<MetricType>> createFamily(const std::string& name, const std::string& description) {
         try {
             return std::shared_ptr<MetricFamily<MetricType>>(
-                new MetricFamily<MetricType>(name, description, this->registryImpl));
+                new MetricFamily<MetricType>(name, description, this->registryImpl, this->shardedMetrics));
         } catch (std::invalid_argument&) {
             return nullptr;
         }
@@ -46,10 +47,12 @@ public:
     bool remove(std::shared_ptr<MetricFamily<MetricType>> family);
 
     // Returns all collected metrics in "Prometheus Text Exposition Format".
+    // Values accumulated in per thread shards of counters and histograms are aggregated here.
     std::string collect() const;
 
 private:
     prometheus::Registry registryImpl;
+    std::shared_ptr<ShardedMetricSet> shardedMetrics;
 };
 
 }  // namespace ovms
@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Measures cost of histogram observe on the inference hot path when many threads report to the same metric.
+// Compares sharded ovms::MetricHistogram with plain prometheus::Histogram it is flushed into.
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <prometheus/family.h>
+#include <prometheus/histogram.h>
+#include <prometheus/registry.h>
+
+#include "metric.hpp"
+#include "metric_family.hpp"
+#include "metric_registry.hpp"
+
+namespace {
+
+constexpr int NUMBER_OF_BUCKETS = 33;
+constexpr double BUCKET_POWER_BASE = 1.8;
+constexpr double BUCKET_MULTIPLIER = 10;
+
+std::vector<double> createBuckets() {
+    // Same buckets as used for request latency in model metric reporter
+    std::vector<double> buckets;
+    for (int i = 0; i < NUMBER_OF_BUCKETS; i++) {
+        buckets.emplace_back(floor(BUCKET_MULTIPLIER * pow(BUCKET_POWER_BASE, i)));
+    }
+    return buckets;
+}
+
+// Returns average nanoseconds per observe call
+double measure(int threadsCount, int observationsPerThread, const std::function<void(double)>& observe) {
+    std::vector<std::thread> workers;
+    std::promise<void> start;
+    std::shared_future<void> started = start.get_future().share();
+    for (int i = 0; i < threadsCount; i++) {
+        workers.emplace_back([started, observationsPerThread, &observe, i]() {
+            started.wait();
+            for (int j = 0; j < observationsPerThread; j++) {
+                observe(static_cast<double>((i * 7919 + j) % 100000));
+            }
+        });
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start.set_value();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double elapsedNs = std::chrono::duration<double, std::nano>(end - begin).count();
+    // Threads run concurrently so wall time is divided by observations of a single thread
+    return elapsedNs / observationsPerThread;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int maxThreads = argc > 1 ? std::atoi(argv[1]) : 64;
+    const int observationsPerThread = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    const auto buckets = createBuckets();
+
+    prometheus::Registry prometheusRegistry;
+    auto& prometheusFamily = prometheus::BuildHistogram().Name("prometheus_histogram").Help("desc").Register(prometheusRegistry);
+    auto& prometheusHistogram = prometheusFamily.Add({}, buckets);
+
+    ovms::MetricRegistry registry;
+    auto family = registry.createFamily<ovms::MetricHistogram>("sharded_histogram", "desc");
+    auto shardedHistogram = family->addMetric({}, buckets);
+
+    std::cout << "observations per thread: " << observationsPerThread << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(24) << "prometheus [ns/op]" << std::setw(24) << "sharded [ns/op]" << std::endl;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double prometheusNs = measure(threads, observationsPerThread, [&prometheusHistogram](double value) { prometheusHistogram.Observe(value); });
+        double shardedNs = measure(threads, observationsPerThread, [&shardedHistogram](double value) { shardedHistogram->observe(value); });
+        std::cout << std::setw(8) << threads << std::setw(24) << std::fixed << std::setprecision(2) << prometheusNs << std::setw(24) << shardedNs << std::endl;
+    }
+    // Aggregation cost is paid on scrape only
+    auto begin = std::chrono::steady_clock::now();
+    registry.collect();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "collect: " << std::chrono::duration<double, std::micro>(end - begin).count() << " us" << std::endl;
+    return 0;
+}
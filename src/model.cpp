@@ -21,6 +21,7 @@
 #include <sstream>
 #include <utility>
 
+#include "cloudmodelcache.hpp"
 #include "customloaderinterface.hpp"
 #include "customloaders.hpp"
 #include "dags/pipelinedefinition.hpp"
@@ -39,7 +40,13 @@ static StatusCode downloadModels(std::shared_ptr<FileSystem>& fs, ModelConfig& c
 
     std::string localPath;
     SPDLOG_INFO("Getting model from {}", config.getBasePath());
-    auto sc = fs->downloadModelVersions(config.getBasePath(), &localPath, *versions);
+    auto& cloudModelCache = CloudModelCache::instance();
+    StatusCode sc;
+    if (cloudModelCache.isEnabled() && !FileSystem::isLocalFilesystem(config.getBasePath())) {
+        sc = cloudModelCache.downloadModelVersions(*fs, config.getBasePath(), &localPath, *versions);
+    } else {
+        sc = fs->downloadModelVersions(config.getBasePath(), &localPath, *versions);
+    }
     if (sc != StatusCode::OK) {
         SPDLOG_ERROR("Couldn't download model from {}", config.getBasePath());
         return sc;
@@ -260,10 +267,15 @@ Status Model::reloadVersions(std::shared_ptr<model_versions_t>& versionsToReload
             result = StatusCode::UNKNOWN_ERROR;
             continue;
         }
+        // Local copy of previous load, kept until the version is loaded from the new one
+        const ModelConfig previousConfig = modelVersion->getModelConfig();
+        bool downloaded = false;
         if (modelVersion->getStatus().getState() == ModelVersionState::END ||
             modelVersion->getStatus().getState() == ModelVersionState::LOADING ||
             modelVersion->getModelConfig().getBasePath() != config.getBasePath()) {
-            downloadModels(fs, config, versionsToReload);
+            // Each download holds cloud model cache entries of its versions until cleanupModelTmpFiles
+            downloadModels(fs, config, std::make_shared<model_versions_t>(model_versions_t{version}));
+            downloaded = true;
         } else {
             config.setLocalPath(modelVersion->getModelConfig().getLocalPath());
         }
@@ -281,6 +293,11 @@ Status Model::reloadVersions(std::shared_ptr<model_versions_t>& versionsToReload
             versionsFailed->push_back(version);
             continue;
         }
+        // Retired versions had their local copy removed already
+        if (downloaded && previousConfig.isCloudStored() && previousConfig.getPath() != config.getPath() &&
+            std::filesystem::exists(std::filesystem::symlink_status(previousConfig.getPath()))) {
+            cleanupModelTmpFiles(previousConfig);
+        }
         updateDefaultVersion();
     }
     subscriptionManager.notifySubscribers();
@@ -291,6 +308,7 @@ Status Model::cleanupModelTmpFiles(const ModelConfig& config) {
     auto lfstatus = StatusCode::OK;
 
     if (config.isCloudStored()) {
+        CloudModelCache::instance().release(config.getPath());
         LocalFileSystem lfs;
         lfstatus = lfs.deleteFileFolder(config.getPath());
         if (lfstatus != StatusCode::OK) {
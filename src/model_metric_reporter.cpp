@@ -17,6 +17,7 @@
 
 #include <cmath>
 #include <exception>
+#include <mutex>
 
 #include "execution_context.hpp"
 #include "logging.hpp"
@@ -30,16 +31,42 @@ constexpr int NUMBER_OF_BUCKETS = 33;
 constexpr double BUCKET_POWER_BASE = 1.8;
 constexpr double BUCKET_MULTIPLIER = 10;
 
+static const std::vector<double> UTILIZATION_BUCKETS{0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
+static const std::vector<double> QUEUE_DEPTH_BUCKETS{1, 2, 4, 8, 16, 32};
+
 #define THROW_IF_NULL(VAR, MESSAGE)                        \
     if (VAR == nullptr) {                                  \
         SPDLOG_LOGGER_ERROR(modelmanager_logger, MESSAGE); \
         throw std::logic_error(MESSAGE);                   \
     }
 
+// Family is shared by models and MediaPipe graphs, description has to be the same for each registration
+static const std::string REQUEST_STAGE_TIME_DESCRIPTION = "Processing time of request in the given stage of execution.";
+
+static std::unique_ptr<MetricHistogram> createStageMetric(MetricFamily<MetricHistogram>& family, const std::string& name, model_version_t version, const std::string& stage, const std::vector<double>& buckets) {
+    auto metric = family.addMetric({{"name", name},
+                                       {"version", std::to_string(version)},
+                                       {"stage", stage}},
+        buckets);
+    THROW_IF_NULL(metric, "cannot create metric");
+    return metric;
+}
+
+static std::unique_ptr<MetricHistogram> createStreamQueueMetric(MetricFamily<MetricHistogram>& family, const std::string& name, model_version_t version, const std::string& direction, const std::vector<double>& buckets) {
+    auto metric = family.addMetric({{"name", name},
+                                       {"version", std::to_string(version)},
+                                       {"direction", direction}},
+        buckets);
+    THROW_IF_NULL(metric, "cannot create metric");
+    return metric;
+}
+
 ServableMetricReporter::~ServableMetricReporter() = default;
 
 ServableMetricReporter::ServableMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion) :
-    registry(registry) {
+    registry(registry),
+    name(modelName),
+    version(modelVersion) {
     if (!registry) {
         return;
     }
@@ -248,6 +275,97 @@ ServableMetricReporter::ServableMetricReporter(const MetricConfig* metricConfig,
             this->buckets);
         THROW_IF_NULL(this->requestTimeRest, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_PIPELINE_BYTES_COPIED;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of bytes of intermediate tensors copied between DAG nodes.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->pipelineBytesCopied = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->pipelineBytesCopied, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_PIPELINE_TENSOR_POOL_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of DAG intermediate tensors allocated from buffers recycled by the pipeline tensor pool.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->pipelineTensorPoolHits = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->pipelineTensorPoolHits, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_PIPELINE_TENSOR_POOL_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of DAG intermediate tensors which required new buffer allocation in the pipeline tensor pool.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->pipelineTensorPoolMisses = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->pipelineTensorPoolMisses, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_PIPELINE_TENSOR_POOL_HELD_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of bytes of idle buffers held by the pipeline tensor pool.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->pipelineTensorPoolHeldBytes = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->pipelineTensorPoolHeldBytes, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_PIPELINE_NODE_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        // Metrics are added on first execution of each node, since nodes can change with pipeline reload
+        this->pipelineNodeTimeFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Processing time of DAG node sessions, including waiting for the inference request.");
+        THROW_IF_NULL(this->pipelineNodeTimeFamily, "cannot create family");
+    }
+}
+
+void ServableMetricReporter::observePipelineNodeTime(const std::string& nodeName, double microseconds) {
+    if (!this->pipelineNodeTimeFamily) {
+        return;
+    }
+    {
+        std::shared_lock lock(this->pipelineNodeTimeMtx);
+        auto it = this->pipelineNodeTime.find(nodeName);
+        if (it != this->pipelineNodeTime.end()) {
+            it->second->observe(microseconds);
+            return;
+        }
+    }
+    std::unique_lock lock(this->pipelineNodeTimeMtx);
+    auto it = this->pipelineNodeTime.find(nodeName);
+    if (it == this->pipelineNodeTime.end()) {
+        auto metric = this->pipelineNodeTimeFamily->addMetric({{"name", this->name},
+                                                                   {"version", std::to_string(this->version)},
+                                                                   {"node", nodeName}},
+            this->buckets);
+        if (!metric) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "cannot create metric");
+            return;
+        }
+        it = this->pipelineNodeTime.emplace(nodeName, std::move(metric)).first;
+    }
+    it->second->observe(microseconds);
+}
+
+void ServableMetricReporter::prunePipelineNodeTime(const std::set<std::string>& nodeNames) {
+    if (!this->pipelineNodeTimeFamily) {
+        return;
+    }
+    std::unique_lock lock(this->pipelineNodeTimeMtx);
+    for (auto it = this->pipelineNodeTime.begin(); it != this->pipelineNodeTime.end();) {
+        if (nodeNames.count(it->first) > 0) {
+            ++it;
+            continue;
+        }
+        this->pipelineNodeTimeFamily->remove(it->second);
+        it = this->pipelineNodeTime.erase(it);
+    }
 }
 
 ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion) :
@@ -312,6 +430,27 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
         THROW_IF_NULL(this->inferReqActive, "cannot create metric");
     }
 
+    familyName = METRIC_NAME_INFER_REQ_WAITING;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of requests waiting for idle inference request from the processing queue.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inferReqWaiting = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->inferReqWaiting, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_INFER_REQ_UTILIZATION;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Ratio of consumed inference requests to the processing queue size, observed each time inference request is acquired.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inferReqUtilization = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            UTILIZATION_BUCKETS);
+        THROW_IF_NULL(this->inferReqUtilization, "cannot create metric");
+    }
+
     familyName = METRIC_NAME_CURRENT_REQUESTS;
     if (metricConfig->isFamilyEnabled(familyName)) {
         auto family = registry->createFamily<MetricGauge>(familyName,
@@ -321,6 +460,91 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
             {{"name", modelName}, {"version", std::to_string(modelVersion)}});
         THROW_IF_NULL(this->currentRequests, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_COMPILE_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of compiling the model for the target device.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->compileTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            this->buckets);
+        THROW_IF_NULL(this->compileTime, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SHAPE_CACHE_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of input shape changes served by previously compiled model.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeCacheHits = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->shapeCacheHits, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SHAPE_CACHE_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of input shape changes which required model compilation.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeCacheMisses = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->shapeCacheMisses, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_REQUEST_STAGE_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName, REQUEST_STAGE_TIME_DESCRIPTION);
+        THROW_IF_NULL(family, "cannot create family");
+        this->getInferRequestStageTime = createStageMetric(*family, modelName, modelVersion, "get_infer_request", this->buckets);
+        this->preprocessStageTime = createStageMetric(*family, modelName, modelVersion, "preprocess", this->buckets);
+        this->deserializationStageTime = createStageMetric(*family, modelName, modelVersion, "deserialization", this->buckets);
+        this->predictionStageTime = createStageMetric(*family, modelName, modelVersion, "prediction", this->buckets);
+        this->serializationStageTime = createStageMetric(*family, modelName, modelVersion, "serialization", this->buckets);
+        this->postprocessStageTime = createStageMetric(*family, modelName, modelVersion, "postprocess", this->buckets);
+    }
+}
+
+MediapipeServableMetricReporter::MediapipeServableMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& graphName, model_version_t graphVersion) {
+    if (!registry) {
+        return;
+    }
+
+    if (!metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+
+    for (int i = 0; i < NUMBER_OF_BUCKETS; i++) {
+        this->buckets.emplace_back(floor(BUCKET_MULTIPLIER * pow(BUCKET_POWER_BASE, i)));
+    }
+
+    std::string familyName = METRIC_NAME_REQUEST_STAGE_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName, REQUEST_STAGE_TIME_DESCRIPTION);
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphInitializationStageTime = createStageMetric(*family, graphName, graphVersion, "graph_initialization", this->buckets);
+        this->deserializationStageTime = createStageMetric(*family, graphName, graphVersion, "deserialization", this->buckets);
+        this->executionStageTime = createStageMetric(*family, graphName, graphVersion, "execution", this->buckets);
+        this->serializationStageTime = createStageMetric(*family, graphName, graphVersion, "serialization", this->buckets);
+    }
+
+    familyName = METRIC_NAME_STREAM_QUEUE_DEPTH;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Number of messages waiting in the stream queue, observed when message is queued.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inboundQueueDepth = createStreamQueueMetric(*family, graphName, graphVersion, "inbound", QUEUE_DEPTH_BUCKETS);
+        this->outboundQueueDepth = createStreamQueueMetric(*family, graphName, graphVersion, "outbound", QUEUE_DEPTH_BUCKETS);
+    }
+
+    familyName = METRIC_NAME_STREAM_BACKPRESSURE_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of waiting for free space in the full stream queue.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inboundBackpressureTime = createStreamQueueMetric(*family, graphName, graphVersion, "inbound", this->buckets);
+        this->outboundBackpressureTime = createStreamQueueMetric(*family, graphName, graphVersion, "outbound", this->buckets);
+    }
 }
 
 }  // namespace ovms
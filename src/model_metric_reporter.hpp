@@ -16,7 +16,10 @@
 #pragma once
 
 #include <memory>
+#include <set>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "execution_context.hpp"
@@ -30,6 +33,12 @@ class MetricConfig;
 
 class ServableMetricReporter {
     MetricRegistry* registry;
+    const std::string name;
+    const model_version_t version;
+
+    std::shared_ptr<MetricFamily<MetricHistogram>> pipelineNodeTimeFamily;
+    std::shared_mutex pipelineNodeTimeMtx;
+    std::unordered_map<std::string, std::unique_ptr<MetricHistogram>> pipelineNodeTime;
 
 protected:
     std::vector<double> buckets;
@@ -75,6 +84,28 @@ public:
     std::unique_ptr<MetricHistogram> requestTimeGrpc;
     std::unique_ptr<MetricHistogram> requestTimeRest;
 
+    std::unique_ptr<MetricCounter> pipelineBytesCopied;
+    std::unique_ptr<MetricCounter> pipelineTensorPoolHits;
+    std::unique_ptr<MetricCounter> pipelineTensorPoolMisses;
+    std::unique_ptr<MetricGauge> pipelineTensorPoolHeldBytes;
+
+    bool isPipelineNodeTimeEnabled() const { return this->pipelineNodeTimeFamily != nullptr; }
+
+    /**
+     * @brief Records duration of DAG node session, creating histogram for the node on first use
+     *
+     * @param nodeName
+     * @param microseconds time from scheduling node session until it reported finish
+     */
+    void observePipelineNodeTime(const std::string& nodeName, double microseconds);
+
+    /**
+     * @brief Removes node histograms of nodes no longer present in pipeline definition
+     *
+     * @param nodeNames names of nodes that remain in pipeline
+     */
+    void prunePipelineNodeTime(const std::set<std::string>& nodeNames);
+
     inline std::unique_ptr<MetricCounter>& getGetModelStatusRequestSuccessMetric(const ExecutionContext& context) {
         if (context.method != ExecutionContext::Method::GetModelStatus) {
             static std::unique_ptr<MetricCounter> empty = nullptr;
@@ -143,12 +174,47 @@ public:
     std::unique_ptr<MetricHistogram> inferenceTime;
     std::unique_ptr<MetricHistogram> waitForInferReqTime;
 
+    // Per stage breakdown of ModelInstance::infer
+    std::unique_ptr<MetricHistogram> getInferRequestStageTime;
+    std::unique_ptr<MetricHistogram> preprocessStageTime;
+    std::unique_ptr<MetricHistogram> deserializationStageTime;
+    std::unique_ptr<MetricHistogram> predictionStageTime;
+    std::unique_ptr<MetricHistogram> serializationStageTime;
+    std::unique_ptr<MetricHistogram> postprocessStageTime;
+
     std::unique_ptr<MetricGauge> streams;
     std::unique_ptr<MetricGauge> inferReqQueueSize;
     std::unique_ptr<MetricGauge> inferReqActive;
+    std::unique_ptr<MetricGauge> inferReqWaiting;
     std::unique_ptr<MetricGauge> currentRequests;
 
+    // Ratio of consumed inference requests to nireq observed when request acquires inference request
+    std::unique_ptr<MetricHistogram> inferReqUtilization;
+
+    std::unique_ptr<MetricHistogram> compileTime;
+    std::unique_ptr<MetricCounter> shapeCacheHits;
+    std::unique_ptr<MetricCounter> shapeCacheMisses;
+
     ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
 };
 
+class MediapipeServableMetricReporter {
+    std::vector<double> buckets;
+
+public:
+    MediapipeServableMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& graphName, model_version_t graphVersion);
+
+    // Per stage breakdown of MediapipeGraphExecutor::infer
+    std::unique_ptr<MetricHistogram> graphInitializationStageTime;
+    std::unique_ptr<MetricHistogram> deserializationStageTime;
+    std::unique_ptr<MetricHistogram> executionStageTime;
+    std::unique_ptr<MetricHistogram> serializationStageTime;
+
+    // Queues of MediapipeGraphExecutor::inferStream, inbound between reader and deserialization, outbound between graph outputs and writer
+    std::unique_ptr<MetricHistogram> inboundQueueDepth;
+    std::unique_ptr<MetricHistogram> outboundQueueDepth;
+    std::unique_ptr<MetricHistogram> inboundBackpressureTime;
+    std::unique_ptr<MetricHistogram> outboundBackpressureTime;
+};
+
 }  // namespace ovms
@@ -100,6 +100,10 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to lowLatencyTransformation mismatch", this->name);
         return true;
     }
+    if (this->continuousBatching != rhs.continuousBatching) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to continuousBatching mismatch", this->name);
+        return true;
+    }
     if (this->basePath != rhs.basePath) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to original base path mismatch", this->name);
         return true;
@@ -132,6 +136,26 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shape configuration mismatch", this->name);
         return true;
     }
+    if (this->acceptedPrecisions != rhs.acceptedPrecisions) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to accepted precisions mismatch", this->name);
+        return true;
+    }
+    if (this->imagePreprocessing != rhs.imagePreprocessing) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to image preprocessing mismatch", this->name);
+        return true;
+    }
+    if (this->warmupIterations != rhs.warmupIterations) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to warm-up iterations mismatch", this->name);
+        return true;
+    }
+    if (this->warmupRequestsPath != rhs.warmupRequestsPath) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to warm-up requests path mismatch", this->name);
+        return true;
+    }
+    if (this->shapeCacheSize != rhs.shapeCacheSize) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shape cache size mismatch", this->name);
+        return true;
+    }
     if (isCustomLoaderConfigChanged(rhs)) {
         return true;
     }
@@ -451,6 +475,104 @@ Status ModelConfig::parseLayoutParameter(const std::string& command) {
     return parseLayoutParameter(node);
 }
 
+Status ModelConfig::parseAcceptedPrecisions(const rapidjson::Value& node) {
+    if (!node.IsObject()) {
+        return StatusCode::CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT;
+    }
+    accepted_precisions_map_t acceptedPrecisions;
+    for (auto it = node.MemberBegin(); it != node.MemberEnd(); ++it) {
+        if (!it->value.IsObject() || !it->value.HasMember("precisions") || !it->value["precisions"].IsArray()) {
+            SPDLOG_ERROR("Accepted precisions for input: {} have to be an object with precisions list", it->name.GetString());
+            return StatusCode::CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT;
+        }
+        AcceptedPrecisionsConfig config;
+        for (const auto& precisionNode : it->value["precisions"].GetArray()) {
+            Precision precision = precisionNode.IsString() ? fromString(precisionNode.GetString()) : Precision::UNDEFINED;
+            if (precision == Precision::UNDEFINED) {
+                SPDLOG_ERROR("Accepted precisions for input: {} contain invalid precision", it->name.GetString());
+                return StatusCode::CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT;
+            }
+            config.precisions.push_back(precision);
+        }
+        if (it->value.HasMember("scale")) {
+            if (!it->value["scale"].IsNumber()) {
+                SPDLOG_ERROR("Accepted precisions scale for input: {} has to be a number", it->name.GetString());
+                return StatusCode::CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT;
+            }
+            config.scale = it->value["scale"].GetFloat();
+        }
+        acceptedPrecisions[it->name.GetString()] = std::move(config);
+    }
+    setAcceptedPrecisions(acceptedPrecisions);
+    return StatusCode::OK;
+}
+
+static Status parseChannelValues(const rapidjson::Value& node, std::vector<float>& values) {
+    if (node.IsNumber()) {
+        values = {node.GetFloat()};
+        return StatusCode::OK;
+    }
+    if (!node.IsArray()) {
+        return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+    }
+    values.clear();
+    for (const auto& value : node.GetArray()) {
+        if (!value.IsNumber()) {
+            return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+        }
+        values.push_back(value.GetFloat());
+    }
+    return StatusCode::OK;
+}
+
+Status ModelConfig::parseImagePreprocessing(const rapidjson::Value& node) {
+    if (!node.IsObject()) {
+        return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+    }
+    image_preprocessing_map_t imagePreprocessing;
+    for (auto it = node.MemberBegin(); it != node.MemberEnd(); ++it) {
+        const std::string inputName = it->name.GetString();
+        if (!it->value.IsObject()) {
+            SPDLOG_ERROR("Image preprocessing for input: {} has to be an object", inputName);
+            return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+        }
+        ImagePreprocessing preprocessing;
+        if (it->value.HasMember("mean")) {
+            auto status = parseChannelValues(it->value["mean"], preprocessing.mean);
+            if (!status.ok()) {
+                SPDLOG_ERROR("Image preprocessing mean for input: {} has to be a number or list of numbers", inputName);
+                return status;
+            }
+        }
+        if (it->value.HasMember("scale")) {
+            auto status = parseChannelValues(it->value["scale"], preprocessing.scale);
+            if (!status.ok() || std::find(preprocessing.scale.begin(), preprocessing.scale.end(), 0.0f) != preprocessing.scale.end()) {
+                SPDLOG_ERROR("Image preprocessing scale for input: {} has to be a non zero number or list of non zero numbers", inputName);
+                return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+            }
+        }
+        if (it->value.HasMember("color_order")) {
+            const std::string colorOrder = it->value["color_order"].IsString() ? it->value["color_order"].GetString() : "";
+            if (colorOrder != "BGR" && colorOrder != "RGB") {
+                SPDLOG_ERROR("Image preprocessing color order for input: {} has to be BGR or RGB", inputName);
+                return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+            }
+            preprocessing.reverseChannels = (colorOrder == "RGB");
+        }
+        if (it->value.HasMember("resize")) {
+            const std::string resize = it->value["resize"].IsString() ? it->value["resize"].GetString() : "";
+            auto status = resizeAlgorithmFromString(resize, preprocessing.resizeAlgorithm);
+            if (!status.ok()) {
+                SPDLOG_ERROR("Image preprocessing resize algorithm for input: {} has to be one of: nearest, linear, cubic, area", inputName);
+                return status;
+            }
+        }
+        imagePreprocessing[inputName] = std::move(preprocessing);
+    }
+    setImagePreprocessing(imagePreprocessing);
+    return StatusCode::OK;
+}
+
 Status ModelConfig::parseShape(ShapeInfo& shapeInfo, const std::string& str) {
     if (str == "auto") {
         SPDLOG_LOGGER_WARN(modelmanager_logger, "Shape auto is deprecated. Use model dynamic shapes instead. Check (https://docs.openvino.ai/2023.3/ovms_docs_dynamic_shape_dynamic_model.html#doxid-ovms-docs-dynamic-shape-dynamic-model)");
@@ -644,6 +766,14 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         this->setIdleSequenceCleanup(v["idle_sequence_cleanup"].GetBool());
     }
 
+    if (v.HasMember("continuous_batching")) {
+        if (!this->isStateful()) {
+            SPDLOG_ERROR("Continuous batching parameter was set for non stateful model {}.", v["name"].GetString());
+            return StatusCode::INVALID_NON_STATEFUL_MODEL_PARAMETER;
+        }
+        this->setContinuousBatching(v["continuous_batching"].GetBool());
+    }
+
     if (v.HasMember("max_sequence_number")) {
         if (!this->isStateful()) {
             SPDLOG_ERROR("Max sequence number parameter was set for non stateful model {}.", v["name"].GetString());
@@ -709,6 +839,7 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         SPDLOG_DEBUG("idle_sequence_cleanup: {}", getIdleSequenceCleanup());
         SPDLOG_DEBUG("max_sequence_number: {}", getMaxSequenceNumber());
         SPDLOG_DEBUG("low_latency_transformation: {}", isLowLatencyTransformationUsed());
+        SPDLOG_DEBUG("continuous_batching: {}", isContinuousBatchingUsed());
     }
 
     // Model Cache options
@@ -717,6 +848,47 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         SPDLOG_DEBUG("allow_cache: {}", v["allow_cache"].GetBool());
     }
 
+    if (v.HasMember("shape_cache_size")) {
+        this->setShapeCacheSize(v["shape_cache_size"].GetUint());
+        SPDLOG_DEBUG("shape_cache_size: {}", getShapeCacheSize());
+    }
+
+    if (v.HasMember("accepted_precisions")) {
+        auto status = parseAcceptedPrecisions(v["accepted_precisions"]);
+        if (!status.ok()) {
+            return status;
+        }
+        for (const auto& [inputName, config] : getAcceptedPrecisions()) {
+            std::stringstream precisions;
+            for (const auto& precision : config.precisions) {
+                precisions << toString(precision) << " ";
+            }
+            SPDLOG_DEBUG("accepted_precisions: {}: {}scale: {}", inputName, precisions.str(), config.scale);
+        }
+    }
+
+    if (v.HasMember("image_preprocessing")) {
+        auto status = parseImagePreprocessing(v["image_preprocessing"]);
+        if (!status.ok()) {
+            return status;
+        }
+        for (const auto& [inputName, preprocessing] : getImagePreprocessing()) {
+            SPDLOG_DEBUG("image_preprocessing: {}: mean values: {}; scale values: {}; reverse channels: {}",
+                inputName, preprocessing.mean.size(), preprocessing.scale.size(), preprocessing.reverseChannels);
+        }
+    }
+
+    if (v.HasMember("warmup")) {
+        const auto& warmup = v["warmup"];
+        if (warmup.HasMember("iterations")) {
+            this->setWarmupIterations(warmup["iterations"].GetUint());
+        }
+        if (warmup.HasMember("requests_path")) {
+            this->setWarmupRequestsPath(warmup["requests_path"].GetString());
+        }
+        SPDLOG_DEBUG("warmup iterations: {}; requests path: {}", getWarmupIterations(), getWarmupRequestsPath());
+    }
+
     // if the config has models which require custom loader to be used, then load the same here
     if (v.HasMember("custom_loader_options")) {
         if (!parseCustomLoaderOptionsConfig(v["custom_loader_options"]).ok()) {
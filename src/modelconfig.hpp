@@ -26,8 +26,10 @@
 
 #include <rapidjson/document.h>
 
+#include "image_preprocessing.hpp"
 #include "layout_configuration.hpp"
 #include "modelversion.hpp"
+#include "precision.hpp"
 #include "shape.hpp"
 #include "status.hpp"
 
@@ -38,6 +40,25 @@ using mapping_config_t = std::unordered_map<std::string, std::string>;
 using plugin_config_t = std::map<std::string, ov::Any>;
 using custom_loader_options_config_t = std::map<std::string, std::string>;
 
+/**
+     * @brief Request precisions accepted for a model input in addition to its own precision
+     */
+struct AcceptedPrecisionsConfig {
+    std::vector<Precision> precisions;
+    /**
+         * @brief Multiplier applied to data converted from integer precision
+         */
+    float scale = 1.0f;
+
+    bool operator==(const AcceptedPrecisionsConfig& rhs) const {
+        return this->precisions == rhs.precisions && this->scale == rhs.scale;
+    }
+    bool operator!=(const AcceptedPrecisionsConfig& rhs) const {
+        return !(*this == rhs);
+    }
+};
+using accepted_precisions_map_t = std::unordered_map<std::string, AcceptedPrecisionsConfig>;
+
 extern const std::string ANONYMOUS_INPUT_NAME;
 extern const std::string MAPPING_CONFIG_JSON;
 const uint32_t DEFAULT_MAX_SEQUENCE_NUMBER = 500;
@@ -107,6 +128,11 @@ private:
          */
     bool lowLatencyTransformation;
 
+    /**
+         * @brief Flag determining if steps of different sequences are combined into one batched inference
+         */
+    bool continuousBatching = false;
+
     /**
          * @brief Number of maximum frames in one sequence
          */
@@ -122,6 +148,21 @@ private:
          */
     bool isAllowCacheTrue = false;
 
+    /**
+         * @brief Number of synthetic warm-up inferences run on each infer request before model is available
+         */
+    uint32_t warmupIterations = 0;
+
+    /**
+         * @brief Directory with recorded requests replayed on each infer request before model is available
+         */
+    std::string warmupRequestsPath;
+
+    /**
+         * @brief Number of compiled models for previously used input shapes kept aside for shape auto and batch size auto
+         */
+    uint32_t shapeCacheSize = 0;
+
     /**
          * @brief Model version
          */
@@ -148,6 +189,16 @@ private:
          */
     layout_configurations_map_t layouts;
 
+    /**
+         * @brief Map of request precisions accepted for inputs
+         */
+    accepted_precisions_map_t acceptedPrecisions;
+
+    /**
+         * @brief Map of preprocessing applied to binary image inputs
+         */
+    image_preprocessing_map_t imagePreprocessing;
+
     /**
          * @brief Input mapping configuration
          */
@@ -389,6 +440,123 @@ public:
         this->isAllowCacheTrue = allowCache;
     }
 
+    /**
+         * @brief Get the number of synthetic warm-up iterations
+         * 
+         * @return uint32_t
+         */
+    uint32_t getWarmupIterations() const {
+        return this->warmupIterations;
+    }
+
+    /**
+         * @brief Set the number of synthetic warm-up iterations
+         * 
+         * @param warmupIterations
+         */
+    void setWarmupIterations(uint32_t warmupIterations) {
+        this->warmupIterations = warmupIterations;
+    }
+
+    /**
+         * @brief Get the directory with recorded warm-up requests
+         * 
+         * @return const std::string&
+         */
+    const std::string& getWarmupRequestsPath() const {
+        return this->warmupRequestsPath;
+    }
+
+    /**
+         * @brief Set the directory with recorded warm-up requests
+         * 
+         * @param warmupRequestsPath
+         */
+    void setWarmupRequestsPath(const std::string& warmupRequestsPath) {
+        this->warmupRequestsPath = warmupRequestsPath;
+    }
+
+    /**
+         * @brief Get the number of compiled models kept for previously used input shapes
+         * 
+         * @return uint32_t
+         */
+    uint32_t getShapeCacheSize() const {
+        return this->shapeCacheSize;
+    }
+
+    /**
+         * @brief Set the number of compiled models kept for previously used input shapes
+         * 
+         * @param shapeCacheSize
+         */
+    void setShapeCacheSize(uint32_t shapeCacheSize) {
+        this->shapeCacheSize = shapeCacheSize;
+    }
+
+    /**
+         * @brief Get the request precisions accepted for inputs
+         * 
+         * @return const accepted_precisions_map_t&
+         */
+    const accepted_precisions_map_t& getAcceptedPrecisions() const {
+        return this->acceptedPrecisions;
+    }
+
+    /**
+         * @brief Set the request precisions accepted for inputs
+         * 
+         * @param acceptedPrecisions
+         */
+    void setAcceptedPrecisions(const accepted_precisions_map_t& acceptedPrecisions) {
+        this->acceptedPrecisions = acceptedPrecisions;
+    }
+
+    /**
+         * @brief Parses json node with request precisions accepted for inputs
+         * 
+         * @param node json object with input names as keys
+         * 
+         * @return status
+         */
+    Status parseAcceptedPrecisions(const rapidjson::Value& node);
+
+    /**
+         * @brief Get the preprocessing applied to binary image inputs
+         * 
+         * @return const image_preprocessing_map_t&
+         */
+    const image_preprocessing_map_t& getImagePreprocessing() const {
+        return this->imagePreprocessing;
+    }
+
+    /**
+         * @brief Set the preprocessing applied to binary image inputs
+         * 
+         * @param imagePreprocessing
+         */
+    void setImagePreprocessing(const image_preprocessing_map_t& imagePreprocessing) {
+        this->imagePreprocessing = imagePreprocessing;
+    }
+
+    /**
+         * @brief Parses json node with preprocessing of binary image inputs
+         * 
+         * @param node json object with input names as keys
+         * 
+         * @return status
+         */
+    Status parseImagePreprocessing(const rapidjson::Value& node);
+
+    /**
+         * @brief Checks if any kind of warm-up is configured
+         * 
+         * @return bool
+         */
+    bool isWarmupEnabled() const {
+        return this->warmupIterations > 0 || !this->warmupRequestsPath.empty();
+    }
+
     /**
          * @brief Checks if given device is used as single target device.
          * 
@@ -603,6 +771,24 @@ public:
         this->idleSequenceCleanup = idleSequenceCleanup;
     }
 
+    /**
+     * @brief Get flag determining if stateful model uses continuous batching
+     *
+     * @return bool
+     */
+    bool isContinuousBatchingUsed() const {
+        return this->continuousBatching;
+    }
+
+    /**
+     * @brief Set flag determining if stateful model uses continuous batching
+     *
+     * @param continuousBatching
+     */
+    void setContinuousBatching(const bool continuousBatching) {
+        this->continuousBatching = continuousBatching;
+    }
+
     /**
          * @brief Parses json node for plugin config keys and values
          * 
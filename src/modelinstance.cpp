@@ -17,6 +17,9 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -38,16 +41,21 @@
 #include "deserialization.hpp"
 #include "executingstreamidguard.hpp"
 #include "filesystem.hpp"
+#include "image_preprocessing.hpp"
 #include "layout.hpp"
 #include "layout_configuration.hpp"
+#include "localfilesystem.hpp"
 #include "logging.hpp"
+#include "mappedweights.hpp"
 #include "model_metric_reporter.hpp"
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "ov_utils.hpp"
+#include "precision_conversion.hpp"
 #include "predict_request_validation_utils.hpp"
 #include "prediction_service_utils.hpp"
 #include "profiler.hpp"
+#include "request_tracer.hpp"
 #include "serialization.hpp"
 #include "shape.hpp"
 #include "status.hpp"
@@ -80,7 +88,7 @@ ModelInstance::ModelInstance(const std::string& name, model_version_t version, o
     version(version),
     subscriptionManager(std::string("model: ") + name + std::string(" version: ") + std::to_string(version)),
     status(name, version),
-    reporter(std::make_unique<ModelMetricReporter>(metricConfig, registry, name, version)) {
+    reporter(std::make_shared<ModelMetricReporter>(metricConfig, registry, name, version)) {
     isCustomLoaderConfigChanged = false;
 }
 
@@ -165,6 +173,24 @@ static Status validateConfigurationAgainstNetwork(const ModelConfig& config, std
             return StatusCode::CONFIG_LAYOUT_IS_NOT_IN_MODEL;
         }
     }
+    for (const auto& [name, _] : config.getAcceptedPrecisions()) {
+        if (hasInputWithName(model, name) && config.getMappingInputByKey(name) != "") {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Config accepted precisions - {} is mapped by {}. Changes will not apply", name, config.getMappingInputByKey(name));
+            return StatusCode::CONFIG_ACCEPTED_PRECISIONS_MAPPED_BUT_USED_REAL_NAME;
+        } else if (!hasInputWithName(model, name) && !hasInputWithName(model, config.getRealInputNameByValue(name))) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Config accepted precisions - {} not found in model", name);
+            return StatusCode::CONFIG_ACCEPTED_PRECISIONS_IS_NOT_IN_MODEL;
+        }
+    }
+    for (const auto& [name, _] : config.getImagePreprocessing()) {
+        if (hasInputWithName(model, name) && config.getMappingInputByKey(name) != "") {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Config image preprocessing - {} is mapped by {}. Changes will not apply", name, config.getMappingInputByKey(name));
+            return StatusCode::CONFIG_IMAGE_PREPROCESSING_MAPPED_BUT_USED_REAL_NAME;
+        } else if (!hasInputWithName(model, name) && !hasInputWithName(model, config.getRealInputNameByValue(name))) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Config image preprocessing - {} not found in model", name);
+            return StatusCode::CONFIG_IMAGE_PREPROCESSING_IS_NOT_IN_MODEL;
+        }
+    }
     return StatusCode::OK;
 }
 
@@ -347,10 +373,12 @@ static Status applyLayoutConfiguration(const ModelConfig& config, std::shared_pt
 const std::string RT_INFO_KEY{"model_info"};
 
 ov::AnyMap ModelInstance::getRTInfo() const {
-    OV_LOGGER("model: {}, ov::Model::has_rt_info({})", reinterpret_cast<void*>(model.get()), RT_INFO_KEY);
-    if (this->model->has_rt_info(RT_INFO_KEY)) {
-        OV_LOGGER("model: {}, ov::Model::get_rt_info<ov::AnyMap>({})", reinterpret_cast<void*>(model.get()), RT_INFO_KEY);
-        return model->get_rt_info<ov::AnyMap>(RT_INFO_KEY);
+    auto currentSnapshot = getSnapshot();
+    const auto& currentModel = currentSnapshot ? currentSnapshot->model : this->model;
+    OV_LOGGER("model: {}, ov::Model::has_rt_info({})", reinterpret_cast<void*>(currentModel.get()), RT_INFO_KEY);
+    if (currentModel->has_rt_info(RT_INFO_KEY)) {
+        OV_LOGGER("model: {}, ov::Model::get_rt_info<ov::AnyMap>({})", reinterpret_cast<void*>(currentModel.get()), RT_INFO_KEY);
+        return currentModel->get_rt_info<ov::AnyMap>(RT_INFO_KEY);
     }
     OV_LOGGER("ov::AnyMap()");
     return ov::AnyMap();
@@ -432,6 +460,7 @@ Status ModelInstance::gatherReshapeInfo(bool isBatchingModeAuto, const DynamicMo
 
 Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicModelParameter& parameter) {
     this->inputsInfo.clear();
+    this->validationPlan.reset();
 
     std::map<std::string, ov::PartialShape> modelShapes;
     bool reshapeRequired = false;
@@ -487,6 +516,37 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
                 shape,
                 layout);
 
+            auto acceptedPrecisionsIt = config.getAcceptedPrecisions().find(info->getMappedName());
+            if (acceptedPrecisionsIt != config.getAcceptedPrecisions().end()) {
+                for (const auto& acceptedPrecision : acceptedPrecisionsIt->second.precisions) {
+                    if (acceptedPrecision != precision && !isPrecisionConversionSupported(acceptedPrecision, precision)) {
+                        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Accepted precision: {}; cannot be converted into precision: {}; of input name: {}", toString(acceptedPrecision), toString(precision), name);
+                        return StatusCode::CONFIG_ACCEPTED_PRECISION_CONVERSION_NOT_SUPPORTED;
+                    }
+                }
+                info = info->createCopyWithAcceptedPrecisions(acceptedPrecisionsIt->second.precisions, acceptedPrecisionsIt->second.scale);
+            }
+
+            auto imagePreprocessingIt = config.getImagePreprocessing().find(info->getMappedName());
+            if (imagePreprocessingIt != config.getImagePreprocessing().end()) {
+                if (shape.size() != 4 || !isImagePreprocessingPrecisionSupported(precision)) {
+                    SPDLOG_LOGGER_ERROR(modelmanager_logger, "Image preprocessing requires 4 dimensional input with FP32, FP16 or U8 precision; input name: {}; shape: {}; precision: {}", name, shape.toString(), toString(precision));
+                    return StatusCode::CONFIG_IMAGE_PREPROCESSING_NOT_SUPPORTED;
+                }
+                const bool planar = layout == "NCHW" || layout == "N?CHW";
+                const Dimension& channels = shape[planar ? 1 : 3];
+                if (channels.isStatic()) {
+                    for (const auto* values : {&imagePreprocessingIt->second.mean, &imagePreprocessingIt->second.scale}) {
+                        if (values->size() > 1 && values->size() != static_cast<size_t>(channels.getStaticValue())) {
+                            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Image preprocessing defines {} channel values while input name: {}; shape: {}; layout: {}; has {} channels",
+                                values->size(), name, shape.toString(), layout, channels.getStaticValue());
+                            return StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT;
+                        }
+                    }
+                }
+                info = info->createCopyWithImagePreprocessing(imagePreprocessingIt->second);
+            }
+
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Input {}", info->asString());
             this->inputsInfo[info->getMappedName()] = std::move(info);
         } catch (const ov::Exception& e) {
@@ -508,6 +568,7 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
             return StatusCode::UNKNOWN_ERROR;
         }
     }
+    this->validationPlan = std::make_shared<const request_validation_utils::ValidationPlan>(this->inputsInfo, config.getShapes());
     return StatusCode::OK;
 }
 
@@ -644,6 +705,18 @@ uint ModelInstance::getNumOfParallelInferRequests(const ModelConfig& modelConfig
 }
 
 std::shared_ptr<ov::Model> ModelInstance::loadOVModelPtr(const std::string& modelFile) {
+    if (endsWith(modelFile, ".xml")) {
+        // IR weights are read from shared read-only mapping instead of being copied for each model instance
+        auto weights = MappedWeights::open(modelFile.substr(0, modelFile.size() - 4) + ".bin");
+        std::string modelXml;
+        if (weights && LocalFileSystem().readTextFile(modelFile, &modelXml) == StatusCode::OK) {
+            ov::Tensor weightsTensor(ov::element::u8, ov::Shape{weights->size()}, const_cast<void*>(weights->data()));
+            OV_LOGGER("ov::Core: {}, model = ieCore.read_model(<xml from \"{}\">, <mapped weights tensor>)", reinterpret_cast<const void*>(&this->ieCore), modelFile);
+            auto model = this->ieCore.read_model(modelXml, weightsTensor);
+            this->weightsStorage = weights;
+            return model;
+        }
+    }
     OV_LOGGER("ov::Core: {}, model = ieCore.read_model(\"{}\")", reinterpret_cast<const void*>(&this->ieCore), modelFile);
     return this->ieCore.read_model(modelFile);
 }
@@ -694,9 +767,11 @@ Status ModelInstance::loadOVModelUsingCustomLoader() {
         std::string strModel(modelBinary.begin(), modelBinary.end());
 
         if (res == CustomLoaderStatus::MODEL_TYPE_IR) {
-            ov::Tensor tensorWts(ov::element::u8, ov::Shape{weights.size()});
-            std::memcpy(tensorWts.data(), weights.data(), weights.size());
+            // weights buffer is kept alive with the model instead of being copied into tensor
+            auto weightsBuffer = std::make_shared<std::vector<uint8_t>>(std::move(weights));
+            ov::Tensor tensorWts(ov::element::u8, ov::Shape{weightsBuffer->size()}, weightsBuffer->data());
             model = ieCore.read_model(strModel, tensorWts);
+            this->weightsStorage = weightsBuffer;
         } else if (res == CustomLoaderStatus::MODEL_TYPE_ONNX) {
             model = ieCore.read_model(strModel, ov::Tensor());
         } else if (res == CustomLoaderStatus::MODEL_TYPE_BLOB) {
@@ -729,8 +804,15 @@ plugin_config_t ModelInstance::prepareDefaultPluginConfig(const ModelConfig& con
 
 Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
     plugin_config_t pluginConfig = prepareDefaultPluginConfig(config);
+    enum : unsigned int {
+        COMPILE,
+        TIMER_END2
+    };
+    Timer<TIMER_END2> timer;
     try {
+        timer.start(COMPILE);
         loadCompiledModelPtr(pluginConfig);
+        timer.stop(COMPILE);
     } catch (ov::Exception& e) {
         Status status = StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "{}; error: {}; model: {}; version: {}; device: {}",
@@ -751,6 +833,10 @@ Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
         return status;
     }
 
+    double compileTime = timer.elapsed<std::chrono::microseconds>(COMPILE);
+    OBSERVE_IF_ENABLED(getMetricReporter().compileTime, compileTime);
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Compiled model: {}; version: {}; in: {} ms", getName(), getVersion(), compileTime / 1000);
+
     uint32_t numberOfStreams = getNumOfStreams();
     SET_IF_ENABLED(getMetricReporter().streams, numberOfStreams);
 
@@ -818,7 +904,7 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     if (numberOfParallelInferRequests == 0) {
         return Status(StatusCode::INVALID_NIREQ, "Exceeded allowed nireq value");
     }
-    inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*compiledModel, numberOfParallelInferRequests);
+    inferRequestsQueue = std::make_shared<OVInferRequestsQueue>(*compiledModel, numberOfParallelInferRequests);
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, numberOfParallelInferRequests);
     auto batchSize = getBatchSize();
     SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}",
@@ -829,6 +915,176 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     return StatusCode::OK;
 }
 
+Status ModelInstance::readWarmupRequests(const ModelConfig& config, std::vector<KFSRequest>& requests) {
+    if (config.getWarmupRequestsPath().empty()) {
+        return StatusCode::OK;
+    }
+    std::filesystem::path directory(config.getWarmupRequestsPath());
+    if (directory.is_relative()) {
+        directory = std::filesystem::path(config.getPath()) / directory;
+    }
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory, ec)) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Warm-up requests path: {} for model: {}; version: {} is not a directory", directory.string(), getName(), getVersion());
+        return StatusCode::PATH_INVALID;
+    }
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (entry.is_regular_file(ec)) {
+            files.emplace_back(entry.path().string());
+        }
+    }
+    // replay requests in deterministic order
+    std::sort(files.begin(), files.end());
+    size_t invalidFiles = 0;
+    Status firstError = StatusCode::OK;
+    for (const auto& file : files) {
+        std::ifstream stream(file, std::ios::binary);
+        KFSRequest request;
+        if (!stream.is_open() || !request.ParseFromIstream(&stream)) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Warm-up request file: {}; is not a serialized ModelInferRequest", file);
+            invalidFiles++;
+            if (firstError.ok()) {
+                firstError = StatusCode::FILE_INVALID;
+            }
+            continue;
+        }
+        auto status = validate(&request);
+        if (!status.ok()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Warm-up request file: {}; validation failed: {}", file, status.string());
+            invalidFiles++;
+            if (firstError.ok()) {
+                firstError = status;
+            }
+            continue;
+        }
+        requests.emplace_back(std::move(request));
+    }
+    if (invalidFiles > 0) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "{} of {} warm-up request files in: {} for model: {}; version: {} are invalid",
+            invalidFiles, files.size(), directory.string(), getName(), getVersion());
+        return firstError;
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Read {} warm-up requests from: {}", requests.size(), directory.string());
+    return StatusCode::OK;
+}
+
+static ov::Tensor createWarmupTensor(const TensorInfo& tensorInfo) {
+    ov::Shape shape;
+    for (const auto& dim : tensorInfo.getShape()) {
+        shape.push_back(dim.isAny() ? 1 : std::max<dimension_value_t>(1, dim.getLowerBound()));
+    }
+    ov::Tensor tensor(tensorInfo.getOvPrecision(), shape);
+    if (tensorInfo.getOvPrecision() != ov::element::string) {
+        std::memset(tensor.data(), 0, tensor.get_byte_size());
+    }
+    return tensor;
+}
+
+void ModelInstance::runWarmupInferences() {
+    for (size_t i = 0; i < inferRequestsQueue->getSize(); ++i) {
+        inferRequestsQueue->getInferRequest(i).start_async();
+    }
+    for (size_t i = 0; i < inferRequestsQueue->getSize(); ++i) {
+        inferRequestsQueue->getInferRequest(i).wait();
+    }
+}
+
+Status ModelInstance::warmup(const ModelConfig& config) {
+    if (!config.isWarmupEnabled()) {
+        return StatusCode::OK;
+    }
+    enum : unsigned int {
+        WARMUP,
+        TIMER_END2
+    };
+    Timer<TIMER_END2> timer;
+    timer.start(WARMUP);
+    std::vector<KFSRequest> recordedRequests;
+    auto status = readWarmupRequests(config, recordedRequests);
+    if (!status.ok()) {
+        return status;
+    }
+    const size_t inferRequestsCount = inferRequestsQueue->getSize();
+    size_t inferencesCount = 0;
+    // Warm-up inputs must not stay bound to pooled requests, original tensors are restored afterwards
+    std::vector<std::map<std::string, ov::Tensor>> originalInputs(inferRequestsCount);
+    try {
+        for (size_t i = 0; i < inferRequestsCount; ++i) {
+            for (const auto& [name, tensorInfo] : this->inputsInfo) {
+                originalInputs[i].emplace(tensorInfo->getName(), inferRequestsQueue->getInferRequest(i).get_tensor(tensorInfo->getName()));
+            }
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Warm-up of model: {}; version: {} failed to read inputs: {}", getName(), getVersion(), e.what());
+        return Status(StatusCode::INTERNAL_ERROR, "Failed to read inputs for warm-up");
+    }
+    status = runWarmup(config, recordedRequests, inferencesCount);
+    try {
+        for (size_t i = 0; i < inferRequestsCount; ++i) {
+            for (auto& [name, tensor] : originalInputs[i]) {
+                inferRequestsQueue->getInferRequest(i).set_tensor(name, tensor);
+            }
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to restore inputs after warm-up of model: {}; version: {}; error: {}", getName(), getVersion(), e.what());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    if (!status.ok()) {
+        return status;
+    }
+    timer.stop(WARMUP);
+    uint64_t durationMs = timer.elapsed<std::chrono::milliseconds>(WARMUP);
+    this->status.setWarmupDuration(durationMs);
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Warm-up of model: {}; version: {} finished; inferences: {}; duration: {} ms",
+        getName(), getVersion(), inferencesCount, durationMs);
+    return StatusCode::OK;
+}
+
+Status ModelInstance::runWarmup(const ModelConfig& config, const std::vector<KFSRequest>& recordedRequests, size_t& inferencesCount) {
+    const size_t inferRequestsCount = inferRequestsQueue->getSize();
+    try {
+        if (config.getWarmupIterations() > 0) {
+            std::map<std::string, ov::Tensor> syntheticInputs;
+            for (const auto& [name, tensorInfo] : this->inputsInfo) {
+                syntheticInputs.emplace(tensorInfo->getName(), createWarmupTensor(*tensorInfo));
+            }
+            for (size_t i = 0; i < inferRequestsCount; ++i) {
+                for (auto& [name, tensor] : syntheticInputs) {
+                    inferRequestsQueue->getInferRequest(i).set_tensor(name, tensor);
+                }
+            }
+            for (uint32_t iteration = 0; iteration < config.getWarmupIterations(); ++iteration) {
+                runWarmupInferences();
+                inferencesCount += inferRequestsCount;
+            }
+        }
+        for (const auto& request : recordedRequests) {
+            for (size_t i = 0; i < inferRequestsCount; ++i) {
+                InputSink<ov::InferRequest&> inputSink(inferRequestsQueue->getInferRequest(i));
+                bool isPipeline = false;
+                auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, this->inputsInfo, inputSink, isPipeline);
+                if (!status.ok()) {
+                    SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to deserialize warm-up request for model: {}; version: {}; error: {}", getName(), getVersion(), status.string());
+                    return status;
+                }
+            }
+            runWarmupInferences();
+            inferencesCount += inferRequestsCount;
+        }
+        // warm-up must not leave any state visible to the first sequence of stateful model
+        for (size_t i = 0; i < inferRequestsCount; ++i) {
+            for (auto&& state : inferRequestsQueue->getInferRequest(i).query_state()) {
+                state.reset();
+            }
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Warm-up of model: {}; version: {} failed with exception: {}", getName(), getVersion(), e.what());
+        return Status(StatusCode::OV_INTERNAL_INFERENCE_ERROR, e.what());
+    }
+    return StatusCode::OK;
+}
+
 void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicModelParameter& parameter) {
     if (parameter.isBatchSizeRequested()) {
         OV_LOGGER("ov::Model: {}, ov::set_batch({})", reinterpret_cast<void*>(this->model.get()), parameter.getBatchSize());
@@ -847,6 +1103,12 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
     this->path = config.getPath();
     this->targetDevice = config.getTargetDevice();
     this->config = config;
+    // compiled models for other shapes may not match new configuration
+    shapeCache.clear();
+    // requests are not served while loading so previous components are not pinned anymore
+    publishSnapshot(nullptr);
+    // previous weights must outlive previous model and compiled model which are replaced below
+    auto previousWeightsStorage = this->weightsStorage;
     auto status = fetchModelFilepaths();
 
     if (!status.ok()) {
@@ -861,6 +1123,7 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
         }
 
         if (!this->model || isLayoutConfigurationChanged) {
+            this->weightsStorage.reset();
             if (this->config.isCustomLoaderRequiredToLoadModel()) {
                 status = loadOVModelUsingCustomLoader();
             } else {
@@ -888,6 +1151,11 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        status = warmup(this->config);
+        if (!status.ok()) {
+            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+            return status;
+        }
     } catch (const ov::Exception& e) {
         SPDLOG_ERROR("exception occurred while loading model: {}", e.what());
         this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
@@ -904,6 +1172,7 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
     } catch (...) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Unable to get information if model was loaded from cache; model: {}; version: {}; device: {}", getName(), getVersion(), config.getTargetDevice());
     }
+    publishSnapshot(createSnapshot());
     this->status.setAvailable();
     modelLoadedNotify.notify_all();
     return status;
@@ -986,6 +1255,130 @@ Status ModelInstance::reshapeWithFullReload(const Status& status, const DynamicM
     return recoveryStatus;
 }
 
+static std::string createShapeKey(const tensor_map_t& inputsInfo) {
+    std::stringstream key;
+    for (const auto& [name, tensorInfo] : inputsInfo) {
+        key << name << ":" << tensorInfo->getShape().toString() << ";";
+    }
+    return key.str();
+}
+
+// Shapes which reload with requested parameter produces, known without preparing new model
+static std::string createShapeKey(const tensor_map_t& inputsInfo, const DynamicModelParameter& parameter) {
+    std::stringstream key;
+    for (const auto& [name, tensorInfo] : inputsInfo) {
+        Shape shape = tensorInfo->getShape();
+        if (parameter.isBatchSizeRequested()) {
+            const auto batchIndex = tensorInfo->getLayout().getBatchIndex();
+            if (batchIndex.has_value() && batchIndex.value() < shape.size()) {
+                shape[batchIndex.value()] = Dimension(parameter.getBatchSize());
+            }
+        } else if (parameter.isShapeRequested(name)) {
+            shape = Shape(parameter.getShape(name));
+        }
+        key << name << ":" << shape.toString() << ";";
+    }
+    return key.str();
+}
+
+std::shared_ptr<const ModelInstanceSnapshot> ModelInstance::createSnapshot() const {
+    auto created = std::make_shared<ModelInstanceSnapshot>();
+    created->model = this->model;
+    created->compiledModel = this->compiledModel;
+    created->inferRequestsQueue = this->inferRequestsQueue;
+    created->inputsInfo = this->inputsInfo;
+    created->outputsInfo = this->outputsInfo;
+    created->validationPlan = this->validationPlan;
+    return created;
+}
+
+std::shared_ptr<const ModelInstanceSnapshot> ModelInstance::publishSnapshot(std::shared_ptr<const ModelInstanceSnapshot> next) {
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    std::swap(this->activeSnapshot, next);
+    return next;
+}
+
+Status ModelInstance::reloadModelWithCompiledModelSwap(const DynamicModelParameter& parameter) {
+    std::lock_guard<std::recursive_mutex> loadingLock(loadingMutex);
+    std::shared_ptr<const ModelInstanceSnapshot> next;
+    const std::string shapeKey = createShapeKey(this->inputsInfo, parameter);
+    auto cached = std::find_if(shapeCache.begin(), shapeCache.end(), [&shapeKey](const ShapeCacheEntry& entry) { return entry.shapeKey == shapeKey; });
+    if (cached != shapeCache.end()) {
+        SPDLOG_INFO("Reusing compiled model: {} version: {} for shapes: {}", getName(), getVersion(), shapeKey);
+        INCREMENT_IF_ENABLED(this->getMetricReporter().shapeCacheHits);
+        next = std::move(cached->snapshot);
+        shapeCache.erase(cached);
+    } else {
+        if (this->config.getShapeCacheSize() > 0) {
+            INCREMENT_IF_ENABLED(this->getMetricReporter().shapeCacheMisses);
+        }
+        // Prepare new model, compiled model and infer requests aside while current ones keep serving requests
+        ModelInstance staging(getName(), getVersion(), ieCore);
+        staging.config = this->config;
+        staging.path = this->path;
+        staging.targetDevice = this->targetDevice;
+        staging.weightsStorage = this->weightsStorage;
+        // compile time of staging model is observed by loadOVCompiledModel in metrics of this instance
+        staging.reporter = this->reporter;
+        try {
+            OV_LOGGER("ov::Model: {}, model->clone()", reinterpret_cast<void*>(this->model.get()));
+            staging.model = this->model->clone();
+            bool needsToApplyLayoutConfiguration = false;
+            auto status = staging.loadTensors(staging.config, needsToApplyLayoutConfiguration, parameter);
+            if (!status.ok()) {
+                return status;
+            }
+            status = staging.loadOVCompiledModel(staging.config);
+            if (!status.ok()) {
+                return status;
+            }
+            status = staging.prepareInferenceRequestsQueue(staging.config);
+            if (!status.ok()) {
+                return status;
+            }
+            status = staging.warmup(staging.config);
+            if (!status.ok()) {
+                return status;
+            }
+        } catch (const ov::Exception& e) {
+            SPDLOG_ERROR("exception occurred while preparing model: {} version: {} for swap: {}", getName(), getVersion(), e.what());
+            return StatusCode::MODEL_NOT_LOADED;
+        } catch (const std::exception& e) {
+            SPDLOG_ERROR("exception occurred while preparing model: {} version: {} for swap: {}", getName(), getVersion(), e.what());
+            return StatusCode::MODEL_NOT_LOADED;
+        }
+        if (staging.status.getWarmupDuration().has_value()) {
+            this->status.setWarmupDuration(staging.status.getWarmupDuration().value());
+        }
+        next = staging.createSnapshot();
+    }
+    subscriptionManager.notifySubscribers();
+    // further reloads start from components of new snapshot
+    this->model = next->model;
+    this->compiledModel = next->compiledModel;
+    this->inferRequestsQueue = next->inferRequestsQueue;
+    this->inputsInfo = next->inputsInfo;
+    this->outputsInfo = next->outputsInfo;
+    this->validationPlan = next->validationPlan;
+    // model stays available; inferences in progress keep previous snapshot pinned by their unload guards
+    auto previous = publishSnapshot(std::move(next));
+    SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, inferRequestsQueue->getSize());
+    SET_IF_ENABLED(this->getMetricReporter().streams, getNumOfStreams());
+    SPDLOG_INFO("Swapped compiled model: {} version: {}", getName(), getVersion());
+    if (this->config.getShapeCacheSize() > 0) {
+        ShapeCacheEntry entry;
+        entry.shapeKey = createShapeKey(previous->inputsInfo);
+        entry.snapshot = std::move(previous);
+        shapeCache.push_front(std::move(entry));
+        while (shapeCache.size() > this->config.getShapeCacheSize()) {
+            SPDLOG_DEBUG("Evicting compiled model: {} version: {} for shapes: {}", getName(), getVersion(), shapeCache.back().shapeKey);
+            shapeCache.pop_back();
+        }
+    }
+    // previous snapshot not kept in shape cache is released together with last unload guard pinning it
+    return StatusCode::OK;
+}
+
 Status ModelInstance::reloadModel(std::optional<Dimension> batchSize, std::map<std::string, shape_t> requestShapes, std::unique_ptr<ModelInstanceUnloadGuard>& unloadGuard) {
     // temporarily release current predictRequest lock on model loading
     unloadGuard.reset();
@@ -1004,7 +1397,8 @@ Status ModelInstance::reloadModel(std::optional<Dimension> batchSize, std::map<s
         return StatusCode::INTERNAL_ERROR;
     }
 
-    auto status = reloadModel(config, parameter);
+    // stateful models keep sequence state in infer requests so they cannot be served by two queues
+    auto status = this->config.isStateful() ? reloadModel(config, parameter) : reloadModelWithCompiledModelSwap(parameter);
     if (!status.ok()) {
         status = this->reshapeWithFullReload(status, parameter);
         if (!status.ok()) {
@@ -1123,11 +1517,15 @@ void ModelInstance::unloadModelComponents() {
     }
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, 0);
     SET_IF_ENABLED(this->getMetricReporter().streams, 0);
+    publishSnapshot(nullptr);
+    shapeCache.clear();
     inferRequestsQueue.reset();
     compiledModel.reset();
     model.reset();
+    weightsStorage.reset();
     outputsInfo.clear();
     inputsInfo.clear();
+    validationPlan.reset();
     modelFiles.clear();
 
     if (this->config.isCustomLoaderRequiredToLoadModel()) {
@@ -1151,9 +1549,44 @@ const std::set<std::string>& ModelInstance::getOptionalInputNames() {
     return optionalInputNames;
 }
 
+template <typename RequestType>
+const Status ModelInstance::validate(const RequestType* request, const ModelInstanceSnapshot& snapshot) {
+    OVMS_PROFILE_FUNCTION();
+    if (snapshot.validationPlan) {
+        return request_validation_utils::validate(
+            *request,
+            *snapshot.validationPlan,
+            getName(),
+            getVersion(),
+            this->getOptionalInputNames(),
+            getModelConfig().getBatchingMode());
+    }
+    return request_validation_utils::validate(
+        *request,
+        snapshot.inputsInfo,
+        getName(),
+        getVersion(),
+        this->getOptionalInputNames(),
+        getModelConfig().getBatchingMode(),
+        getModelConfig().getShapes());
+}
+
+template const Status ModelInstance::validate(const InferenceRequest* request, const ModelInstanceSnapshot& snapshot);
+template const Status ModelInstance::validate(const ::KFSRequest* request, const ModelInstanceSnapshot& snapshot);
+template const Status ModelInstance::validate(const tensorflow::serving::PredictRequest* request, const ModelInstanceSnapshot& snapshot);
+
 template <typename RequestType>
 const Status ModelInstance::validate(const RequestType* request) {
     OVMS_PROFILE_FUNCTION();
+    if (this->validationPlan) {
+        return request_validation_utils::validate(
+            *request,
+            *this->validationPlan,
+            getName(),
+            getVersion(),
+            this->getOptionalInputNames(),
+            getModelConfig().getBatchingMode());
+    }
     return request_validation_utils::validate(
         *request,
         getInputsInfo(),
@@ -1208,13 +1641,20 @@ Status ModelInstance::infer(const RequestType* requestProto,
     auto status = requestProcessor->extractRequestParameters(requestProto);
     if (!status.ok())
         return status;
-    status = validate(requestProto);
+    // compiled model, infer requests and tensor information used by this request until unload guard is released
+    auto snapshot = modelUnloadGuardPtr->getSnapshot();
+    if (!snapshot)
+        return StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE;
+    status = validate(requestProto, *snapshot);
     if (status.batchSizeChangeRequired() || status.reshapeRequired()) {
         // We are ensured that request shape is valid and convertible to model shape (non negative, non zero)
         // We can use it to perform reshape via shape=auto
         auto requestBatchSize = getRequestBatchSize(requestProto, this->getBatchSizeIndex());
         auto requestShapes = getRequestShapes(requestProto);
         status = reloadModelIfRequired(status, requestBatchSize, requestShapes, modelUnloadGuardPtr);
+        if (status.ok()) {
+            snapshot = modelUnloadGuardPtr->getSnapshot();
+        }
     }
     if (!status.ok())
         return status;
@@ -1223,61 +1663,79 @@ Status ModelInstance::infer(const RequestType* requestProto,
         return status;
 
     timer.start(GET_INFER_REQUEST);
+    TraceSpan queueWaitSpan("queue wait");
     OVMS_PROFILE_SYNC_BEGIN("getInferRequest");
-    ExecutingStreamIdGuard executingStreamIdGuard(getInferRequestsQueue(), this->getMetricReporter());
+    ExecutingStreamIdGuard executingStreamIdGuard(*snapshot->inferRequestsQueue, this->getMetricReporter());
     int executingInferId = executingStreamIdGuard.getId();
     ov::InferRequest& inferRequest = executingStreamIdGuard.getInferRequest();
     OVMS_PROFILE_SYNC_END("getInferRequest");
     timer.stop(GET_INFER_REQUEST);
+    queueWaitSpan.end();
     double getInferRequestTime = timer.elapsed<microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    OBSERVE_IF_ENABLED(this->getMetricReporter().getInferRequestStageTime, getInferRequestTime);
     SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, getInferRequestTime / 1000);
 
     timer.start(PREPROCESS);
+    TraceSpan preprocessSpan("preprocess");
     status = requestProcessor->preInferenceProcessing(inferRequest);
     timer.stop(PREPROCESS);
+    preprocessSpan.end();
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().preprocessStageTime, timer.elapsed<microseconds>(PREPROCESS));
     SPDLOG_DEBUG("Preprocessing duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREPROCESS) / 1000);
 
     timer.start(DESERIALIZE);
+    TraceSpan deserializationSpan("deserialization");
     InputSink<ov::InferRequest&> inputSink(inferRequest);
     bool isPipeline = false;
-    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, snapshot->inputsInfo, inputSink, isPipeline);
     timer.stop(DESERIALIZE);
+    deserializationSpan.end();
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().deserializationStageTime, timer.elapsed<microseconds>(DESERIALIZE));
     SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
 
     timer.start(PREDICTION);
-    status = performInference(inferRequest);
+    TraceSpan inferenceSpan("inference");
+    status = requestProcessor->performInference(*this, inferRequest);
     timer.stop(PREDICTION);
+    inferenceSpan.end();
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().predictionStageTime, timer.elapsed<microseconds>(PREDICTION));
     SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
 
     timer.start(SERIALIZE);
+    TraceSpan serializationSpan("serialization");
     OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
-    status = serializePredictResponse(outputGetter, getName(), getVersion(), getOutputsInfo(), responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+    status = serializePredictResponse(outputGetter, getName(), getVersion(), snapshot->outputsInfo, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
     timer.stop(SERIALIZE);
+    serializationSpan.end();
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().serializationStageTime, timer.elapsed<microseconds>(SERIALIZE));
     SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(SERIALIZE) / 1000);
 
     timer.start(POSTPROCESS);
+    TraceSpan postprocessSpan("postprocess");
     status = requestProcessor->postInferenceProcessing(responseProto, inferRequest);
     timer.stop(POSTPROCESS);
+    postprocessSpan.end();
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().postprocessStageTime, timer.elapsed<microseconds>(POSTPROCESS));
     SPDLOG_DEBUG("Postprocessing duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(POSTPROCESS) / 1000);
     if (this->targetDevice == "AUTO")
-        for (std::string device : compiledModel->get_property(ov::execution_devices))
+        for (std::string device : snapshot->compiledModel->get_property(ov::execution_devices))
             SPDLOG_DEBUG("Used device: {}", device);
 
     status = requestProcessor->release();
@@ -1290,8 +1748,9 @@ template Status ModelInstance::infer(const ::KFSRequest* requestProto,
     ::KFSResponse* responseProto,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
 const size_t ModelInstance::getBatchSizeIndex() const {
-    const auto& inputItr = this->inputsInfo.cbegin();
-    if (inputItr == this->inputsInfo.cend()) {
+    const auto& inputsInfo = getInputsInfo();
+    const auto& inputItr = inputsInfo.cbegin();
+    if (inputItr == inputsInfo.cend()) {
         throw std::logic_error("model has no inputs");
     }
     const auto& input = inputItr->second;
@@ -1349,6 +1808,8 @@ Status RequestProcessor<RequestType, ResponseType>::prepare() { return StatusCod
 template <typename RequestType, typename ResponseType>
 Status RequestProcessor<RequestType, ResponseType>::preInferenceProcessing(ov::InferRequest& inferRequest) { return StatusCode::OK; }
 template <typename RequestType, typename ResponseType>
+Status RequestProcessor<RequestType, ResponseType>::performInference(ModelInstance& modelInstance, ov::InferRequest& inferRequest) { return modelInstance.performInference(inferRequest); }
+template <typename RequestType, typename ResponseType>
 Status RequestProcessor<RequestType, ResponseType>::postInferenceProcessing(ResponseType* response, ov::InferRequest& inferRequest) { return StatusCode::OK; }
 template <typename RequestType, typename ResponseType>
 Status RequestProcessor<RequestType, ResponseType>::release() { return StatusCode::OK; }
@@ -17,8 +17,10 @@
 
 #include <condition_variable>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -46,6 +48,9 @@ class PipelineDefinition;
 class Status;
 template <typename T1, typename T2>
 struct RequestProcessor;
+namespace request_validation_utils {
+class ValidationPlan;
+}  // namespace request_validation_utils
 
 class DynamicModelParameter {
 public:
@@ -70,6 +75,20 @@ private:
     std::map<std::string, shape_t> shapes;
 };
 
+/**
+     * @brief Compiled model with its infer requests and tensor information prepared for specific input shapes
+     *
+     * Requests pin snapshot through ModelInstanceUnloadGuard so it outlives swaps done while they are processed.
+     */
+struct ModelInstanceSnapshot {
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<ov::CompiledModel> compiledModel;
+    std::shared_ptr<OVInferRequestsQueue> inferRequestsQueue;
+    tensor_map_t inputsInfo;
+    tensor_map_t outputsInfo;
+    std::shared_ptr<const request_validation_utils::ValidationPlan> validationPlan;
+};
+
 /**
      * @brief This class contains all the information about model
      */
@@ -92,6 +111,11 @@ protected:
          */
     std::shared_ptr<ov::Model> model;
 
+    /**
+         * @brief Owner of memory backing model weights (shared file mapping or custom loader buffer)
+         */
+    std::shared_ptr<const void> weightsStorage;
+
     /**
          * @brief OpenVINO Runtime CompiledModel object
          */
@@ -180,7 +204,8 @@ protected:
          */
     std::recursive_mutex loadingMutex;
 
-    std::unique_ptr<ModelMetricReporter> reporter;
+    // shared with staging instance prepared during compiled model swap
+    std::shared_ptr<ModelMetricReporter> reporter;
 
     /**
          * @brief Load OV Engine
@@ -211,6 +236,32 @@ protected:
          */
     Status prepareInferenceRequestsQueue(const ModelConfig& config);
 
+    /**
+         * @brief Runs configured warm-up inferences on every InferRequest before model becomes available
+         *
+         * @return Status
+         */
+    Status warmup(const ModelConfig& config);
+
+    /**
+         * @brief Binds synthetic and recorded warm-up inputs and runs inferences
+         *
+         * @return Status
+         */
+    Status runWarmup(const ModelConfig& config, const std::vector<KFSRequest>& recordedRequests, size_t& inferencesCount);
+
+    /**
+         * @brief Reads and validates recorded warm-up requests
+         *
+         * @return Status
+         */
+    Status readWarmupRequests(const ModelConfig& config, std::vector<KFSRequest>& requests);
+
+    /**
+         * @brief Starts inference on every InferRequest and waits for all of them to finish
+         */
+    void runWarmupInferences();
+
     /**
          * @brief Fetch model file paths
          *
@@ -237,6 +288,9 @@ protected:
     template <typename RequestType>
     const Status validate(const RequestType* request);
 
+    template <typename RequestType>
+    const Status validate(const RequestType* request, const ModelInstanceSnapshot& snapshot);
+
 private:
     /**
          * @brief Holds model required file names. First is loaded
@@ -248,6 +302,11 @@ private:
          */
     tensor_map_t inputsInfo;
 
+    /**
+         * @brief Request validation data built from inputsInfo on each load
+         */
+    std::shared_ptr<const request_validation_utils::ValidationPlan> validationPlan;
+
     /**
          * @brief Holds the information about outputs and it's parameters
          */
@@ -256,7 +315,30 @@ private:
     /**
          * @brief OpenVINO inference execution stream pool
          */
-    std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
+    std::shared_ptr<OVInferRequestsQueue> inferRequestsQueue;
+
+    /**
+         * @brief Components serving requests, published once loading or compiled model swap completes
+         */
+    std::shared_ptr<const ModelInstanceSnapshot> activeSnapshot;
+
+    /**
+         * @brief Guards snapshot replacement
+         */
+    mutable std::mutex snapshotMutex;
+
+    /**
+         * @brief Compiled model prepared for specific input shapes
+         */
+    struct ShapeCacheEntry {
+        std::string shapeKey;
+        std::shared_ptr<const ModelInstanceSnapshot> snapshot;
+    };
+
+    /**
+         * @brief Compiled models for previously used input shapes, most recently used first
+         */
+    std::list<ShapeCacheEntry> shapeCache;
 
     /**
          * @brief Holds current usage count in predict requests
@@ -319,6 +401,30 @@ private:
          */
     Status reshapeWithFullReload(const Status& status, const DynamicModelParameter& parameter);
 
+    /**
+         * @brief Reload model with dynamic parameter by preparing new compiled model and infer requests
+         * while current ones keep serving, then swapping snapshot serving requests
+         *
+         * @param parameter requested dynamic parameter
+         *
+         * @return Status
+         */
+    Status reloadModelWithCompiledModelSwap(const DynamicModelParameter& parameter);
+
+    /**
+         * @brief Creates snapshot of currently loaded components
+         */
+    std::shared_ptr<const ModelInstanceSnapshot> createSnapshot() const;
+
+    /**
+         * @brief Replaces snapshot serving requests
+         *
+         * @param next snapshot to serve further requests
+         *
+         * @return previously published snapshot, released once requests pinning it finish
+         */
+    std::shared_ptr<const ModelInstanceSnapshot> publishSnapshot(std::shared_ptr<const ModelInstanceSnapshot> next);
+
     /**
       * Variable to tell reload is due to customloader config change
       */
@@ -429,8 +535,9 @@ public:
          * @return batch size
          */
     virtual std::optional<Dimension> getBatchSize() const {
+        auto currentSnapshot = getSnapshot();
         try {
-            return Dimension(ov::get_batch(model));
+            return Dimension(ov::get_batch(currentSnapshot ? currentSnapshot->model : model));
         } catch (...) {
             return std::nullopt;
         }
@@ -453,7 +560,8 @@ public:
          * @return const tensor_map_t& 
          */
     virtual const tensor_map_t& getInputsInfo() const {
-        return inputsInfo;
+        auto currentSnapshot = getSnapshot();
+        return currentSnapshot ? currentSnapshot->inputsInfo : inputsInfo;
     }
 
     virtual ov::AnyMap getRTInfo() const;
@@ -464,7 +572,8 @@ public:
          * @return const tensor_map_t& 
          */
     virtual const tensor_map_t& getOutputsInfo() const {
-        return outputsInfo;
+        auto currentSnapshot = getSnapshot();
+        return currentSnapshot ? currentSnapshot->outputsInfo : outputsInfo;
     }
 
     /**
@@ -482,7 +591,18 @@ public:
          * @return OVStreamsQueue
          */
     OVInferRequestsQueue& getInferRequestsQueue() {
-        return *inferRequestsQueue;
+        auto currentSnapshot = getSnapshot();
+        return currentSnapshot ? *currentSnapshot->inferRequestsQueue : *inferRequestsQueue;
+    }
+
+    /**
+         * @brief Gets components currently serving requests
+         *
+         * @return snapshot or nullptr if model is not loaded
+         */
+    std::shared_ptr<const ModelInstanceSnapshot> getSnapshot() const {
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        return activeSnapshot;
     }
 
     /**
@@ -593,6 +713,7 @@ struct RequestProcessor {
     virtual Status extractRequestParameters(const RequestType* request);
     virtual Status prepare();
     virtual Status preInferenceProcessing(ov::InferRequest& inferRequest);
+    virtual Status performInference(ModelInstance& modelInstance, ov::InferRequest& inferRequest);
     virtual Status postInferenceProcessing(ResponseType* response, ov::InferRequest& inferRequest);
     virtual Status release();
 };
@@ -21,9 +21,19 @@ namespace ovms {
 ModelInstanceUnloadGuard::ModelInstanceUnloadGuard(ModelInstance& modelInstance) :
     modelInstance(modelInstance) {
     modelInstance.increasePredictRequestsHandlesCount();
+    snapshot = modelInstance.getSnapshot();
 }
 
 ModelInstanceUnloadGuard::~ModelInstanceUnloadGuard() {
+    snapshot.reset();
     modelInstance.decreasePredictRequestsHandlesCount();
 }
+
+const std::shared_ptr<const ModelInstanceSnapshot>& ModelInstanceUnloadGuard::getSnapshot() {
+    // guard may be created before model becomes available
+    if (!snapshot) {
+        snapshot = modelInstance.getSnapshot();
+    }
+    return snapshot;
+}
 }  // namespace ovms
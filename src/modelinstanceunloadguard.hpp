@@ -15,8 +15,11 @@
 //*****************************************************************************
 #pragma once
 
+#include <memory>
+
 namespace ovms {
 class ModelInstance;
+struct ModelInstanceSnapshot;
 
 class ModelInstanceUnloadGuard {
 public:
@@ -24,7 +27,13 @@ public:
     ModelInstanceUnloadGuard(ModelInstance& modelInstance);
     ~ModelInstanceUnloadGuard();
 
+    /**
+     * @brief Gets compiled model with infer requests pinned for the lifetime of the guard
+     */
+    const std::shared_ptr<const ModelInstanceSnapshot>& getSnapshot();
+
 private:
     ModelInstance& modelInstance;
+    std::shared_ptr<const ModelInstanceSnapshot> snapshot;
 };
 }  // namespace ovms
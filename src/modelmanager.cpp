@@ -35,6 +35,7 @@
 #include <unistd.h>
 
 #include "cleaner_utils.hpp"
+#include "cloudmodelcache.hpp"
 #include "config.hpp"
 #include "customloaderconfig.hpp"
 #include "customloaderinterface.hpp"
@@ -100,6 +101,14 @@ ModelManager::ModelManager(const std::string& modelCacheDirectory, MetricRegistr
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Model cache is enabled: {}", this->modelCacheDirectory);
         }
     }
+    if (!ovms::Config::instance().cloudModelCacheDir().empty()) {
+        auto status = CloudModelCache::instance().configure(ovms::Config::instance().cloudModelCacheDir(), ovms::Config::instance().cloudModelCacheSizeMb() * 1024 * 1024);
+        if (status != StatusCode::OK) {
+            // configure leaves the cache disabled on failure, models are downloaded without it
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Cloud model cache is disabled, failed to configure it in: {}; error: {}",
+                ovms::Config::instance().cloudModelCacheDir(), Status(status).string());
+        }
+    }
     this->customNodeLibraryManager = std::make_unique<CustomNodeLibraryManager>();
     if (ovms::Config::instance().cpuExtensionLibraryPath() != "") {
         SPDLOG_INFO("Loading custom CPU extension from {}", ovms::Config::instance().cpuExtensionLibraryPath());
@@ -135,6 +144,7 @@ void ModelManager::logPluginConfiguration() {
 ModelManager::~ModelManager() {
     join();
     models.clear();
+    CloudModelCache::instance().unregisterMetrics(this->metricRegistry);
 }
 
 Status ModelManager::start(const Config& config) {
@@ -209,6 +219,7 @@ Status ModelManager::startFromConfig() {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Loading metric cli settings only once per server start.");
 
         this->metricConfigLoadedOnce = true;
+        CloudModelCache::instance().registerMetrics(this->metricRegistry, &this->metricConfig);
     } else {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Metric cli settings already loaded error.");
         return StatusCode::INTERNAL_ERROR;
@@ -491,6 +502,10 @@ static Status processPipelineConfig(rapidjson::Document& configJson, const rapid
             gatherFromNode.insert(nodeToGatherFrom);
             gatheredDemultiplexerNodes.insert(nodeToGatherFrom);
         }
+        bool batchShards = false;
+        if (nodeConfig.HasMember("batch_shards")) {
+            batchShards = nodeConfig["batch_shards"].GetBool();
+        }
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Creating node: {} type: {} model_name: {} modelVersion: {}",
             nodeName, nodeKindStr, dlNodeInfo.modelName, dlNodeInfo.modelVersion.value_or(0));
         info.emplace_back(
@@ -502,7 +517,8 @@ static Status processPipelineConfig(rapidjson::Document& configJson, const rapid
             demultiplyCount,
             gatherFromNode,
             customNodeInfo.library,
-            customNodeInfo.parameters);
+            customNodeInfo.parameters,
+            batchShards);
         auto nodeInputItr = nodeConfig.FindMember("inputs");
         processNodeInputs(nodeName, nodeInputItr, connections);
     }
@@ -924,6 +940,7 @@ Status ModelManager::loadConfig(const std::string& jsonFilename) {
         }
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reading metric config only once per server start.");
         this->metricConfigLoadedOnce = true;
+        CloudModelCache::instance().registerMetrics(this->metricRegistry, &this->metricConfig);
     } else {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reading metric from config json file skipped. Settings already loaded.");
     }
@@ -81,6 +81,9 @@ void ModelVersionStatus::setLoading(ModelVersionStatusErrorCode error_code) {
     SPDLOG_DEBUG("{}: {} - {} (previous state: {}) -> error: {}", __func__, this->modelName, this->version, ModelVersionStateToString(this->state), ModelVersionStatusErrorCodeToString(error_code));
     state = ModelVersionState::LOADING;
     errorCode = error_code;
+    if (errorCode == ModelVersionStatusErrorCode::OK) {
+        warmupDurationMs.reset();
+    }
     logStatus();
 }
 
@@ -105,7 +108,24 @@ void ModelVersionStatus::setEnd(ModelVersionStatusErrorCode error_code) {
     logStatus();
 }
 
+void ModelVersionStatus::setWarmupDuration(uint64_t durationMs) {
+    warmupDurationMs = durationMs;
+}
+
+const std::optional<uint64_t>& ModelVersionStatus::getWarmupDuration() const {
+    return warmupDurationMs;
+}
+
 void ModelVersionStatus::logStatus() {
+    if (warmupDurationMs.has_value()) {
+        SPDLOG_INFO("STATUS CHANGE: Version {} of model {} status change. New status: ( \"state\": \"{}\", \"error_code\": \"{}\", \"warmup_duration_ms\": {} )",
+            this->version,
+            this->modelName,
+            ModelVersionStateToString(state),
+            ModelVersionStatusErrorCodeToString(errorCode),
+            warmupDurationMs.value());
+        return;
+    }
     SPDLOG_INFO("STATUS CHANGE: Version {} of model {} status change. New status: ( \"state\": \"{}\", \"error_code\": \"{}\" )",
         this->version,
         this->modelName,
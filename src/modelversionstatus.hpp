@@ -15,7 +15,9 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -67,6 +69,7 @@ class ModelVersionStatus {
     model_version_t version;
     ModelVersionState state;
     ModelVersionStatusErrorCode errorCode;
+    std::optional<uint64_t> warmupDurationMs;
 
 public:
     ModelVersionStatus() = delete;
@@ -98,6 +101,14 @@ public:
     void setEnd(ModelVersionStatusErrorCode error_code = ModelVersionStatusErrorCode::OK);
     void setState(ModelVersionState state, ModelVersionStatusErrorCode error_code = ModelVersionStatusErrorCode::OK);
 
+    /**
+     * @brief Set duration of warm-up performed during current loading. It is reported in following state transitions until next loading.
+     *
+     * @param durationMs
+     */
+    void setWarmupDuration(uint64_t durationMs);
+    const std::optional<uint64_t>& getWarmupDuration() const;
+
 private:
     void logStatus();
 };
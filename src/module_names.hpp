@@ -23,4 +23,5 @@ extern const std::string HTTP_SERVER_MODULE_NAME;
 extern const std::string SERVABLE_MANAGER_MODULE_NAME;
 extern const std::string METRICS_MODULE_NAME;
 extern const std::string PYTHON_INTERPRETER_MODULE_NAME;
+extern const std::string TRACING_MODULE_NAME;
 }  // namespace ovms
@@ -74,8 +74,12 @@ Status tensorClone(ov::Tensor& destinationTensor, const ov::Tensor& sourceTensor
     }
     OV_LOGGER("ov::Tensor(ov::element::type, shape)");
     destinationTensor = ov::Tensor(sourceTensor.get_element_type(), sourceTensor.get_shape());
+    return tensorCopyData(destinationTensor, sourceTensor);
+}
+
+Status tensorCopyData(ov::Tensor& destinationTensor, const ov::Tensor& sourceTensor) {
     if (destinationTensor.get_byte_size() != sourceTensor.get_byte_size()) {
-        SPDLOG_ERROR("tensorClone byte size mismatch destination:{}; source:{}",
+        SPDLOG_ERROR("tensorCopyData byte size mismatch destination:{}; source:{}",
             destinationTensor.get_byte_size(),
             sourceTensor.get_byte_size());
         return StatusCode::OV_CLONE_TENSOR_ERROR;
@@ -39,6 +39,8 @@ ov::Tensor createTensorWithNoDataOwnership(ov::element::Type_t precision, const
 std::string getTensorMapString(const std::map<std::string, std::shared_ptr<const TensorInfo>>& tensorMap);
 
 Status tensorClone(ov::Tensor& destinationTensor, const ov::Tensor& sourceTensor);
+// Copies data of non string tensor into already allocated destination of the same byte size
+Status tensorCopyData(ov::Tensor& destinationTensor, const ov::Tensor& sourceTensor);
 
 std::optional<ov::Layout> getLayoutFromRTMap(const ov::RTMap& rtMap);
 
@@ -0,0 +1,291 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "precision_conversion.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <openvino/core/type/float16.hpp>
+
+#include "logging.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+namespace {
+enum class SimdLevel {
+    NONE,
+    AVX2,
+    AVX512
+};
+
+SimdLevel getSimdLevel() {
+#if defined(__x86_64__)
+    static const SimdLevel level = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+            return SimdLevel::AVX2;
+        }
+        return SimdLevel::NONE;
+    }();
+    return level;
+#else
+    return SimdLevel::NONE;
+#endif
+}
+
+float bf16ToFp32(uint16_t value) {
+    uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+uint16_t fp32ToBf16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        // Rounding could turn NaN into infinity, keep it quiet NaN instead
+        return static_cast<uint16_t>((bits | 0x00400000) >> 16);
+    }
+    // Round to nearest even
+    bits += 0x7FFF + ((bits >> 16) & 1);
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+void convertFp16ToFp32Scalar(const uint16_t* src, float* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<float>(ov::float16::from_bits(src[i]));
+    }
+}
+
+void convertFp32ToFp16Scalar(const float* src, uint16_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = ov::float16(src[i]).to_bits();
+    }
+}
+
+void convertBf16ToFp32Scalar(const uint16_t* src, float* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = bf16ToFp32(src[i]);
+    }
+}
+
+void convertFp32ToBf16Scalar(const float* src, uint16_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = fp32ToBf16(src[i]);
+    }
+}
+
+void convertU8ToFp32Scalar(const uint8_t* src, float* dst, size_t count, float scale) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale;
+    }
+}
+
+#if defined(__x86_64__)
+// AVX2 kernels process blocks of 8 elements. Remaining elements are processed
+// by the same instructions on zero padded copy, so results do not depend on buffer length.
+constexpr size_t AVX2_STEP = 8;
+constexpr size_t AVX512_STEP = 16;
+
+template <typename Src, typename Dst, typename... Args>
+void processTail(const Src* src, Dst* dst, size_t count, void (*block)(const Src*, Dst*, Args...), Args... args) {
+    if (count == 0) {
+        return;
+    }
+    Src srcTail[AVX2_STEP] = {};
+    Dst dstTail[AVX2_STEP];
+    std::memcpy(srcTail, src, count * sizeof(Src));
+    block(srcTail, dstTail, args...);
+    std::memcpy(dst, dstTail, count * sizeof(Dst));
+}
+
+template <typename Src, typename Dst, typename... Args>
+void processBlocks(const Src* src, Dst* dst, size_t count, void (*block)(const Src*, Dst*, Args...), Args... args) {
+    size_t i = 0;
+    for (; i + AVX2_STEP <= count; i += AVX2_STEP) {
+        block(src + i, dst + i, args...);
+    }
+    processTail(src + i, dst + i, count - i, block, args...);
+}
+
+__attribute__((target("avx2,f16c"))) void convertFp16ToFp32Block(const uint16_t* src, float* dst) {
+    __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    _mm256_storeu_ps(dst, _mm256_cvtph_ps(half));
+}
+
+__attribute__((target("avx2,f16c"))) void convertFp32ToFp16Block(const float* src, uint16_t* dst) {
+    __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), half);
+}
+
+__attribute__((target("avx2"))) void convertBf16ToFp32Block(const uint16_t* src, float* dst) {
+    __m256i widened = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    _mm256_storeu_ps(dst, _mm256_castsi256_ps(_mm256_slli_epi32(widened, 16)));
+}
+
+__attribute__((target("avx2"))) void convertFp32ToBf16Block(const float* src, uint16_t* dst) {
+    __m256 values = _mm256_loadu_ps(src);
+    __m256i bits = _mm256_castps_si256(values);
+    __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF)));
+    __m256i quietNan = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+    __m256i isNan = _mm256_castps_si256(_mm256_cmp_ps(values, values, _CMP_UNORD_Q));
+    __m256i result = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quietNan, isNan), 16);
+    // Pack works within 128 bit lanes, permute moves both halves into lower lane
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0xD8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+}
+
+__attribute__((target("avx2"))) void convertU8ToFp32Block(const uint8_t* src, float* dst, float scale) {
+    __m256i widened = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+    _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(widened), _mm256_set1_ps(scale)));
+}
+
+void convertFp16ToFp32Avx2(const uint16_t* src, float* dst, size_t count) {
+    processBlocks(src, dst, count, convertFp16ToFp32Block);
+}
+
+void convertFp32ToFp16Avx2(const float* src, uint16_t* dst, size_t count) {
+    processBlocks(src, dst, count, convertFp32ToFp16Block);
+}
+
+void convertBf16ToFp32Avx2(const uint16_t* src, float* dst, size_t count) {
+    processBlocks(src, dst, count, convertBf16ToFp32Block);
+}
+
+void convertFp32ToBf16Avx2(const float* src, uint16_t* dst, size_t count) {
+    processBlocks(src, dst, count, convertFp32ToBf16Block);
+}
+
+void convertU8ToFp32Avx2(const uint8_t* src, float* dst, size_t count, float scale) {
+    processBlocks(src, dst, count, convertU8ToFp32Block, scale);
+}
+
+// AVX-512 kernels leave remainder shorter than 16 elements to AVX2 kernels
+// Some GCC versions report undefined vectors initialized inside AVX-512 intrinsics
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+__attribute__((target("avx512f"))) void convertFp16ToFp32Avx512(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + AVX512_STEP <= count; i += AVX512_STEP) {
+        __m256i half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(half));
+    }
+    convertFp16ToFp32Avx2(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void convertFp32ToFp16Avx512(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + AVX512_STEP <= count; i += AVX512_STEP) {
+        __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), half);
+    }
+    convertFp32ToFp16Avx2(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void convertBf16ToFp32Avx512(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + AVX512_STEP <= count; i += AVX512_STEP) {
+        __m512i widened = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, _mm512_castsi512_ps(_mm512_slli_epi32(widened, 16)));
+    }
+    convertBf16ToFp32Avx2(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void convertFp32ToBf16Avx512(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + AVX512_STEP <= count; i += AVX512_STEP) {
+        __m512 values = _mm512_loadu_ps(src + i);
+        __m512i bits = _mm512_castps_si512(values);
+        __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+        __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF)));
+        __m512i quietNan = _mm512_or_si512(bits, _mm512_set1_epi32(0x00400000));
+        __mmask16 isNan = _mm512_cmp_ps_mask(values, values, _CMP_UNORD_Q);
+        __m512i result = _mm512_srli_epi32(_mm512_mask_blend_epi32(isNan, rounded, quietNan), 16);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtepi32_epi16(result));
+    }
+    convertFp32ToBf16Avx2(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void convertU8ToFp32Avx512(const uint8_t* src, float* dst, size_t count, float scale) {
+    const __m512 scaleVector = _mm512_set1_ps(scale);
+    size_t i = 0;
+    for (; i + AVX512_STEP <= count; i += AVX512_STEP) {
+        __m512i widened = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm512_storeu_ps(dst + i, _mm512_mul_ps(_mm512_cvtepi32_ps(widened), scaleVector));
+    }
+    convertU8ToFp32Avx2(src + i, dst + i, count - i, scale);
+}
+#pragma GCC diagnostic pop
+#endif
+
+#if defined(__x86_64__)
+#define DISPATCH_CONVERSION(NAME, ...)        \
+    switch (getSimdLevel()) {                 \
+    case SimdLevel::AVX512:                   \
+        NAME##Avx512(__VA_ARGS__);            \
+        break;                                \
+    case SimdLevel::AVX2:                     \
+        NAME##Avx2(__VA_ARGS__);              \
+        break;                                \
+    case SimdLevel::NONE:                     \
+    default:                                  \
+        NAME##Scalar(__VA_ARGS__);            \
+    }
+#else
+#define DISPATCH_CONVERSION(NAME, ...) NAME##Scalar(__VA_ARGS__);
+#endif
+}  // namespace
+
+bool isPrecisionConversionSupported(Precision from, Precision to) {
+    switch (to) {
+    case Precision::FP32:
+        return from == Precision::FP16 || from == Precision::BF16 || from == Precision::U8;
+    case Precision::FP16:
+    case Precision::BF16:
+        return from == Precision::FP32;
+    default:
+        return false;
+    }
+}
+
+Status convertPrecision(const void* src, Precision from, void* dst, Precision to, size_t count, float scale) {
+    if (from == Precision::FP16 && to == Precision::FP32) {
+        DISPATCH_CONVERSION(convertFp16ToFp32, reinterpret_cast<const uint16_t*>(src), reinterpret_cast<float*>(dst), count);
+    } else if (from == Precision::BF16 && to == Precision::FP32) {
+        DISPATCH_CONVERSION(convertBf16ToFp32, reinterpret_cast<const uint16_t*>(src), reinterpret_cast<float*>(dst), count);
+    } else if (from == Precision::U8 && to == Precision::FP32) {
+        DISPATCH_CONVERSION(convertU8ToFp32, reinterpret_cast<const uint8_t*>(src), reinterpret_cast<float*>(dst), count, scale);
+    } else if (from == Precision::FP32 && to == Precision::FP16) {
+        DISPATCH_CONVERSION(convertFp32ToFp16, reinterpret_cast<const float*>(src), reinterpret_cast<uint16_t*>(dst), count);
+    } else if (from == Precision::FP32 && to == Precision::BF16) {
+        DISPATCH_CONVERSION(convertFp32ToBf16, reinterpret_cast<const float*>(src), reinterpret_cast<uint16_t*>(dst), count);
+    } else {
+        SPDLOG_DEBUG("Conversion from precision: {} to precision: {} is not supported", toString(from), toString(to));
+        return StatusCode::INVALID_PRECISION;
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,37 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+
+#include "precision.hpp"
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief Checks if request data in given precision can be converted into model input precision.
+ * Supported conversions: FP16, BF16, U8 -> FP32 and FP32 -> FP16, BF16
+ */
+bool isPrecisionConversionSupported(Precision from, Precision to);
+
+/**
+ * @brief Converts count elements from src buffer into dst buffer. Uses AVX-512 or AVX2 kernels when CPU supports them.
+ *
+ * @param scale multiplier applied to values converted from integer precision, ignored otherwise
+ */
+Status convertPrecision(const void* src, Precision from, void* dst, Precision to, size_t count, float scale = 1.0f);
+}  // namespace ovms
@@ -19,6 +19,7 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -95,15 +96,17 @@ const signed_shape_t& RequestShapeInfo<InferenceTensor, signed_shape_t>::getShap
 template <typename RequestType, typename InputTensorType, typename InputIterator, typename ShapeType>
 class RequestValidator {
     const RequestType& request;
-    const tensor_map_t& inputsInfo;
+    const ValidationPlan& plan;
     const std::string& servableName;
     const model_version_t servableVersion;
     const std::set<std::string>& optionalAllowedInputNames;
     const Mode batchingMode;
-    const shapes_info_map_t& shapeInfo;
 
     InputIterator it;
 
+    // Position of each plan input in KFS request inputs, -1 if missing
+    std::vector<int> requestInputPositions;
+
     RequestValidator() = delete;
 
     const std::string* currentlyValidatedName;
@@ -113,29 +116,30 @@ class RequestValidator {
 
 public:
     RequestValidator(
-        const RequestType& request, const tensor_map_t& inputsInfo,
+        const RequestType& request, const ValidationPlan& plan,
         const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames,
-        const Mode batchingMode, const shapes_info_map_t& shapeInfo) :
+        const Mode batchingMode) :
         request(request),
-        inputsInfo(inputsInfo),
+        plan(plan),
         servableName(servableName),
         servableVersion(servableVersion),
         optionalAllowedInputNames(optionalAllowedInputNames),
-        batchingMode(batchingMode),
-        shapeInfo(shapeInfo) {}
+        batchingMode(batchingMode) {}
 
     Status validateInferenceTensorBufferType(const InferenceTensor& it) const;
     Status validateNumberOfInputs() const;
-    Status validateAndGetInput(const RequestType& request, const std::string& name, InputIterator& it, size_t& bufferId);
+    Status indexRequestInputs();
+    Status validateAndGetInput(const RequestType& request, const ValidationPlan::Input& input, size_t inputIndex, InputIterator& it, size_t& bufferId);
     Status checkIfShapeValuesNegative(const InputTensorType& proto) const;
     Status validateNumberOfBinaryInputShapeDimensions(const InputTensorType& proto) const;
     Status checkBatchSizeMismatch(const InputTensorType& proto, const std::optional<Dimension>& servableBatchSize, const std::optional<size_t>& batchSizeIndex, Status& finalStatus, Mode batchingMode, Mode shapeMode) const;
     Status checkBinaryBatchSizeMismatch(const InputTensorType& proto, const std::optional<Dimension>& servableBatchSize, Status& finalStatus, Mode batchingMode, Mode shapeMode, int32_t inputBatchSize) const;
     Status checkShapeMismatch(const InputTensorType& proto, const ovms::TensorInfo& inputInfo, const std::optional<size_t>& batchSizeIndex, Status& finalStatus, Mode batchingMode, Mode shapeMode) const;
-    Status validateTensorContent(const InputTensorType& proto, ovms::Precision expectedPrecision, size_t bufferId) const;
+    size_t getExpectedValueCount(const InputTensorType& proto, const ValidationPlan::Input& input) const;
+    Status validateTensorContent(const InputTensorType& proto, const ValidationPlan::Input& input, size_t bufferId) const;
     Status validateNumberOfShapeDimensions(const ovms::TensorInfo& inputInfo, const InputTensorType& proto) const;
     Status validateRawInputContentsFormatAndShape(const ovms::TensorInfo& inputInfo, const RequestType& request, const size_t& bufferId, Status& finalStatus, Mode batchingMode, Mode shapeMode) const;
-    Status validatePrecision(const ovms::TensorInfo& inputInfo, const InputTensorType& proto) const;
+    Status validatePrecision(const ValidationPlan::Input& input, const InputTensorType& proto) const;
     Status checkStringShapeMismatch(const InputTensorType& proto, const ovms::TensorInfo& inputInfo, Status& finalStatus, Mode batchingMode, Mode shapeMode, int32_t inputBatchSize, size_t inputWidth) const;
     Status validateRequestCoherency() const;
     Status validate();
@@ -169,7 +173,7 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
 
 template <>
 Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateNumberOfInputs() const {
-    size_t expectedNumberOfInputs = inputsInfo.size();
+    size_t expectedNumberOfInputs = plan.getInputs().size();
 
     if (optionalAllowedInputNames.size() > 0) {
         auto it = request.inputs().begin();
@@ -218,7 +222,7 @@ const InferenceTensor& RequestValidator<ovms::InferenceRequest, InferenceTensor,
 
 template <>
 Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateNumberOfInputs() const {
-    size_t expectedNumberOfInputs = inputsInfo.size();
+    size_t expectedNumberOfInputs = plan.getInputs().size();
     for (auto& optionalAllowedInputName : optionalAllowedInputNames) {
         if (request.inputs().count(optionalAllowedInputName))
             expectedNumberOfInputs++;
@@ -234,7 +238,7 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 }
 template <>
 Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateNumberOfInputs() const {
-    size_t expectedNumberOfInputs = inputsInfo.size();
+    size_t expectedNumberOfInputs = plan.getInputs().size();
     if (request.getInputsSize() > 0 && expectedNumberOfInputs == static_cast<size_t>(request.getInputsSize())) {
         return StatusCode::OK;
     }
@@ -246,52 +250,70 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
 }
 
 template <>
-Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateAndGetInput(const TFSRequestType& request, const std::string& name, TFSInputTensorIteratorType& it, size_t& bufferId) {
-    it = request.inputs().find(name);
+Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::indexRequestInputs() {
+    return StatusCode::OK;
+}
+template <>
+Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::indexRequestInputs() {
+    // Single pass over request inputs instead of searching request for each model input
+    requestInputPositions.assign(plan.getInputs().size(), -1);
+    int position = 0;
+    for (const auto& input : request.inputs()) {
+        size_t index = plan.find(input.name());
+        if (index != ValidationPlan::NOT_FOUND && requestInputPositions[index] < 0) {
+            requestInputPositions[index] = position;
+        }
+        ++position;
+    }
+    return StatusCode::OK;
+}
+template <>
+Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::indexRequestInputs() {
+    return StatusCode::OK;
+}
+
+template <>
+Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateAndGetInput(const TFSRequestType& request, const ValidationPlan::Input& input, size_t inputIndex, TFSInputTensorIteratorType& it, size_t& bufferId) {
+    it = request.inputs().find(input.name);
     if (it != request.inputs().end()) {
-        currentlyValidatedName = &name;
+        currentlyValidatedName = &input.name;
         return StatusCode::OK;
     }
     currentlyValidatedName = nullptr;
     std::stringstream ss;
-    ss << "Required input: " << name;
+    ss << "Required input: " << input.name;
     const std::string details = ss.str();
     SPDLOG_DEBUG("[servable name: {} version: {}] Missing input with specific name - {}", servableName, servableVersion, details);
     return Status(StatusCode::INVALID_MISSING_INPUT, details);
 }
 template <>
-Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateAndGetInput(const KFSRequest& request, const std::string& name, KFSInputTensorIteratorType& it, size_t& bufferId) {
-    it = request.inputs().begin();
-    bufferId = 0;
-    while (it != request.inputs().end()) {
-        if (it->name() == name) {
-            break;
-        }
-        ++it;
-        ++bufferId;
-    }
-    if (it != request.inputs().end()) {
-        currentlyValidatedName = &name;
+Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateAndGetInput(const KFSRequest& request, const ValidationPlan::Input& input, size_t inputIndex, KFSInputTensorIteratorType& it, size_t& bufferId) {
+    const int position = requestInputPositions[inputIndex];
+    if (position >= 0) {
+        it = request.inputs().begin() + position;
+        bufferId = position;
+        currentlyValidatedName = &input.name;
         return StatusCode::OK;
     }
+    it = request.inputs().end();
     currentlyValidatedName = nullptr;
     std::stringstream ss;
-    ss << "Required input: " << name;
+    ss << "Required input: " << input.name;
     const std::string details = ss.str();
     SPDLOG_DEBUG("[servable name: {} version: {}] Missing input with specific name - {}", servableName, servableVersion, details);
     return Status(StatusCode::INVALID_MISSING_INPUT, details);
 }
 
 template <>
-Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateAndGetInput(const InferenceRequest& request, const std::string& name, const InferenceTensor*& it, size_t& bufferId) {
-    if (request.getInput(name.c_str(), &it) != StatusCode::NONEXISTENT_TENSOR) {
-        currentlyValidatedName = &name;
+Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateAndGetInput(const InferenceRequest& request, const ValidationPlan::Input& input, size_t inputIndex, const InferenceTensor*& it, size_t& bufferId) {
+    if (request.getInput(input.name.c_str(), &it) != StatusCode::NONEXISTENT_TENSOR) {
+        currentlyValidatedName = &input.name;
         return StatusCode::OK;
     }
 
     currentlyValidatedName = nullptr;
     std::stringstream ss;
-    ss << "Required input: " << name;
+    ss << "Required input: " << input.name;
     const std::string details = ss.str();
     SPDLOG_DEBUG("[servable name: {} version: {}] Missing input with specific name - {}", servableName, servableVersion, details);
     return Status(StatusCode::INVALID_MISSING_INPUT, details);
@@ -648,8 +670,23 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
     return StatusCode::OK;
 }
 
+// To be called only for proto which passed shape validation
+template <typename RequestType, typename InputTensorType, typename IteratorType, typename ShapeType>
+size_t RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::getExpectedValueCount(const InputTensorType& proto, const ValidationPlan::Input& input) const {
+    // Without AUTO modes request shape already matched static model shape
+    if (input.staticValueCount.has_value() && batchingMode != AUTO && input.shapeMode != AUTO) {
+        return input.staticValueCount.value();
+    }
+    RequestShapeInfo<InputTensorType, ShapeType> rsi(proto);
+    size_t expectedValueCount = 1;
+    for (size_t i = 0; i < rsi.getShapeSize(); i++) {
+        expectedValueCount *= rsi.getDim(i);
+    }
+    return expectedValueCount;
+}
+
 template <>
-Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateTensorContent(const TFSInputTensorType& proto, ovms::Precision expectedPrecision, size_t bufferId) const {
+Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateTensorContent(const TFSInputTensorType& proto, const ValidationPlan::Input& input, size_t bufferId) const {
     /*
     int8        data in request.tensor_content
     uint8       data in request.tensor_content
@@ -668,10 +705,7 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 */
 
     // For POD types
-    size_t expectedValueCount = 1;
-    for (int i = 0; i < proto.tensor_shape().dim_size(); i++) {
-        expectedValueCount *= proto.tensor_shape().dim(i).size();
-    }
+    const size_t expectedValueCount = getExpectedValueCount(proto, input);
 
     // Network expects tensor content size or value count
     if (proto.dtype() == tensorflow::DataType::DT_STRING) {
@@ -701,7 +735,11 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
             return Status(StatusCode::INVALID_VALUE_COUNT, details);
         }
     } else {
-        size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
+        size_t itemsize = input.itemsize;
+        if (!input.acceptedPrecisions.empty() && proto.dtype() != getPrecisionAsDataType(input.precision)) {
+            itemsize = input.findAcceptedPrecision(TFSPrecisionToOvmsPrecision(proto.dtype()))->itemsize;
+        }
+        size_t expectedContentSize = expectedValueCount * itemsize;
         if (expectedContentSize != proto.tensor_content().size()) {
             std::stringstream ss;
             ss << "Expected: " << expectedContentSize << " bytes; Actual: " << proto.tensor_content().size() << " bytes; input name: " << getCurrentlyValidatedInputName();
@@ -763,11 +801,8 @@ static size_t getElementsCount(const KFSTensorInputProto& proto, ovms::Precision
 }
 
 template <>
-Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateTensorContent(const KFSTensorInputProto& proto, ovms::Precision expectedPrecision, size_t bufferId) const {
-    size_t expectedValueCount = 1;
-    for (int i = 0; i < proto.shape().size(); i++) {
-        expectedValueCount *= proto.shape()[i];
-    }
+Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateTensorContent(const KFSTensorInputProto& proto, const ValidationPlan::Input& input, size_t bufferId) const {
+    const size_t expectedValueCount = getExpectedValueCount(proto, input);
     if (request.raw_input_contents().size()) {
         if (proto.datatype() == "BYTES") {
             // Special content validation - 4 byte length metadata
@@ -801,7 +836,11 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
             }
         } else {
             // Plain old data
-            size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
+            size_t itemsize = input.itemsize;
+            if (!input.acceptedPrecisions.empty() && proto.datatype() != input.kfsDatatype) {
+                itemsize = input.findAcceptedPrecision(proto.datatype())->itemsize;
+            }
+            size_t expectedContentSize = expectedValueCount * itemsize;
             if (expectedContentSize != request.raw_input_contents()[bufferId].size()) {
                 std::stringstream ss;
                 ss << "Expected: " << expectedContentSize << " bytes; Actual: " << request.raw_input_contents()[bufferId].size() << " bytes; input name: " << getCurrentlyValidatedInputName();
@@ -811,9 +850,16 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
             }
         }
     } else {  // buffers placed in InputTensor content
+        if (proto.datatype() != input.kfsDatatype) {
+            std::stringstream ss;
+            ss << "Expected: " << input.kfsDatatype << " in tensor contents; Actual: " << proto.datatype() << "; precision conversion requires raw_input_contents; input name: " << getCurrentlyValidatedInputName();
+            const std::string details = ss.str();
+            SPDLOG_DEBUG("[servable name: {} version: {}] Invalid precision - {}", servableName, servableVersion, details);
+            return Status(StatusCode::INVALID_PRECISION, details);
+        }
         // here we should check that the elements count is equal since for some precisions there is padding
         // we need to decide first which exact datatype_contents we extract that information from
-        size_t elementsCount = getElementsCount(proto, expectedPrecision);
+        size_t elementsCount = getElementsCount(proto, input.precision);
         if (expectedValueCount != elementsCount) {
             std::stringstream ss;
             ss << "Expected: " << expectedValueCount << " values; Actual: " << elementsCount << " values; input name: " << getCurrentlyValidatedInputName();
@@ -825,7 +871,7 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
     return StatusCode::OK;
 }
 template <>
-Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateTensorContent(const InferenceTensor& tensor, ovms::Precision expectedPrecision, size_t bufferId) const {
+Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateTensorContent(const InferenceTensor& tensor, const ValidationPlan::Input& input, size_t bufferId) const {
     const Buffer* buffer = tensor.getBuffer();
     if (nullptr == buffer) {
         std::stringstream ss;
@@ -836,11 +882,11 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
         SPDLOG_DEBUG(details);
         return Status(StatusCode::INVALID_CONTENT_SIZE, details);
     }
-    size_t expectedValueCount = 1;
-    for (size_t i = 0; i < tensor.getShape().size(); i++) {
-        expectedValueCount *= tensor.getShape()[i];
+    size_t itemsize = input.itemsize;
+    if (!input.acceptedPrecisions.empty() && tensor.getDataType() != getPrecisionAsOVMSDataType(input.precision)) {
+        itemsize = input.findAcceptedPrecision(getOVMSDataTypeAsPrecision(tensor.getDataType()))->itemsize;
     }
-    size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
+    size_t expectedContentSize = getExpectedValueCount(tensor, input) * itemsize;
     if (expectedContentSize != buffer->getByteSize()) {
         std::stringstream ss;
         ss << "Expected: " << expectedContentSize << " bytes; Actual: " << buffer->getByteSize() << " bytes; input name: " << getCurrentlyValidatedInputName();
@@ -903,10 +949,11 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
 }
 
 template <>
-Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validatePrecision(const ovms::TensorInfo& inputInfo, const TFSInputTensorType& proto) const {
-    if (proto.dtype() != getPrecisionAsDataType(inputInfo.getPrecision())) {
+Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validatePrecision(const ValidationPlan::Input& input, const TFSInputTensorType& proto) const {
+    if (proto.dtype() != getPrecisionAsDataType(input.precision) &&
+        (input.acceptedPrecisions.empty() || input.findAcceptedPrecision(TFSPrecisionToOvmsPrecision(proto.dtype())) == nullptr)) {
         std::stringstream ss;
-        ss << "Expected: " << inputInfo.getPrecisionAsString()
+        ss << "Expected: " << input.info->getPrecisionAsString()
            << "; Actual: " << getDataTypeAsString(proto.dtype())
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -916,10 +963,10 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
     return StatusCode::OK;
 }
 template <>
-Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validatePrecision(const ovms::TensorInfo& inputInfo, const KFSTensorInputProto& proto) const {
-    if (proto.datatype() != ovmsPrecisionToKFSPrecision(inputInfo.getPrecision())) {
+Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validatePrecision(const ValidationPlan::Input& input, const KFSTensorInputProto& proto) const {
+    if (proto.datatype() != input.kfsDatatype && input.findAcceptedPrecision(proto.datatype()) == nullptr) {
         std::stringstream ss;
-        ss << "Expected: " << inputInfo.getPrecisionAsString()
+        ss << "Expected: " << input.info->getPrecisionAsString()
            << "; Actual: " << proto.datatype()
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -929,10 +976,11 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
     return StatusCode::OK;
 }
 template <>
-Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validatePrecision(const ovms::TensorInfo& inputInfo, const InferenceTensor& tensor) const {
-    if (tensor.getDataType() != getPrecisionAsOVMSDataType(inputInfo.getPrecision())) {
+Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validatePrecision(const ValidationPlan::Input& input, const InferenceTensor& tensor) const {
+    if (tensor.getDataType() != getPrecisionAsOVMSDataType(input.precision) &&
+        (input.acceptedPrecisions.empty() || input.findAcceptedPrecision(getOVMSDataTypeAsPrecision(tensor.getDataType())) == nullptr)) {
         std::stringstream ss;
-        ss << "Expected: " << inputInfo.getPrecisionAsString()
+        ss << "Expected: " << input.info->getPrecisionAsString()
            << "; Actual: " << toString(getOVMSDataTypeAsPrecision(tensor.getDataType()))
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -959,6 +1007,122 @@ static Mode getShapeMode(const shapes_info_map_t& shapeInfo, const std::string&
     return it->second.shapeMode;
 }
 
+ValidationPlan::ValidationPlan(const tensor_map_t& inputsInfo, const shapes_info_map_t& shapeInfo) {
+    inputs.reserve(inputsInfo.size());
+    for (const auto& [name, inputInfo] : inputsInfo) {
+        Input input;
+        input.name = name;
+        input.info = inputInfo;
+        input.precision = inputInfo->getPrecision();
+        input.kfsDatatype = ovmsPrecisionToKFSPrecision(input.precision);
+        input.itemsize = ov::element::Type(ovmsPrecisionToIE2Precision(input.precision)).size();
+        input.processingHint = inputInfo->getPreProcessingHint();
+        input.shapeMode = getShapeMode(shapeInfo, name);
+        input.batchSize = inputInfo->getBatchSize();
+        input.batchIndex = inputInfo->getLayout().getBatchIndex();
+        input.batchIndexOutOfRange = input.batchIndex.has_value() && input.batchIndex.value() >= inputInfo->getShape().size();
+        const auto& shape = inputInfo->getShape();
+        if (shape.isStatic()) {
+            size_t valueCount = 1;
+            for (const auto& dim : shape) {
+                valueCount *= dim.getStaticValue();
+            }
+            input.staticValueCount = valueCount;
+        }
+        for (const auto& acceptedPrecision : inputInfo->getAcceptedPrecisions()) {
+            if (acceptedPrecision == input.precision) {
+                continue;
+            }
+            input.acceptedPrecisions.push_back({acceptedPrecision,
+                ovmsPrecisionToKFSPrecision(acceptedPrecision),
+                ov::element::Type(ovmsPrecisionToIE2Precision(acceptedPrecision)).size()});
+        }
+        inputs.push_back(std::move(input));
+    }
+    buildLookupTable();
+}
+
+const ValidationPlan::AcceptedPrecision* ValidationPlan::Input::findAcceptedPrecision(Precision requestPrecision) const {
+    for (const auto& acceptedPrecision : acceptedPrecisions) {
+        if (acceptedPrecision.precision == requestPrecision) {
+            return &acceptedPrecision;
+        }
+    }
+    return nullptr;
+}
+
+const ValidationPlan::AcceptedPrecision* ValidationPlan::Input::findAcceptedPrecision(const std::string& requestKfsDatatype) const {
+    for (const auto& acceptedPrecision : acceptedPrecisions) {
+        if (acceptedPrecision.kfsDatatype == requestKfsDatatype) {
+            return &acceptedPrecision;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t ValidationPlan::hash(const char* name, size_t length, uint64_t seed) {
+    // FNV-1a with seeded offset basis
+    uint64_t result = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+    for (size_t i = 0; i < length; i++) {
+        result ^= static_cast<uint8_t>(name[i]);
+        result *= 1099511628211ULL;
+    }
+    return result ^ (result >> 32);
+}
+
+void ValidationPlan::buildLookupTable() {
+    static const size_t MAX_SEEDS_PER_TABLE_SIZE = 64;
+    static const size_t MAX_TABLE_SIZE = 1 << 20;
+    size_t tableSize = 4;
+    while (tableSize < inputs.size() * 2) {
+        tableSize <<= 1;
+    }
+    // Look for seed without collisions, table stays sparse so it is found in few attempts
+    for (; tableSize <= MAX_TABLE_SIZE; tableSize <<= 1) {
+        std::vector<uint32_t> table(tableSize, 0);
+        for (uint64_t candidate = 0; candidate < MAX_SEEDS_PER_TABLE_SIZE; candidate++) {
+            std::fill(table.begin(), table.end(), 0);
+            bool collision = false;
+            for (size_t i = 0; i < inputs.size(); i++) {
+                auto& slot = table[hash(inputs[i].name.data(), inputs[i].name.size(), candidate) & (tableSize - 1)];
+                if (slot != 0) {
+                    collision = true;
+                    break;
+                }
+                slot = i + 1;
+            }
+            if (!collision) {
+                this->slots = std::move(table);
+                this->seed = candidate;
+                this->mask = tableSize - 1;
+                return;
+            }
+        }
+    }
+    SPDLOG_DEBUG("Could not build perfect hash for model inputs, falling back to linear search");
+    this->slots.clear();
+}
+
+size_t ValidationPlan::find(const char* name, size_t length) const {
+    if (slots.empty()) {
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (inputs[i].name.size() == length && std::memcmp(inputs[i].name.data(), name, length) == 0) {
+                return i;
+            }
+        }
+        return NOT_FOUND;
+    }
+    const uint32_t slot = slots[hash(name, length, seed) & mask];
+    if (slot == 0) {
+        return NOT_FOUND;
+    }
+    const auto& input = inputs[slot - 1];
+    if (input.name.size() != length || std::memcmp(input.name.data(), name, length) != 0) {
+        return NOT_FOUND;
+    }
+    return slot - 1;
+}
+
 static bool dataInRawInputContents(const ovms::InferenceRequest& request) {
     return false;
 }
@@ -1000,27 +1164,32 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
 
     RETURN_IF_ERR(validateNumberOfInputs());
     RETURN_IF_ERR(validateRequestCoherency());
+    RETURN_IF_ERR(indexRequestInputs());
 
     size_t bufferId = 0;
-    for (const auto& [name, inputInfo] : inputsInfo) {
-        RETURN_IF_ERR(validateAndGetInput(request, name, it, bufferId));
+    const auto& inputs = plan.getInputs();
+    for (size_t inputIndex = 0; inputIndex < inputs.size(); inputIndex++) {
+        const auto& input = inputs[inputIndex];
+        const auto& name = input.name;
+        const auto& inputInfo = input.info;
+        RETURN_IF_ERR(validateAndGetInput(request, input, inputIndex, it, bufferId));
 
         const auto& proto = getInputFromIt(it);
 
         RETURN_IF_ERR(checkIfShapeValuesNegative(proto));
 
-        // Batch and mode retrieval for given input
-        auto batchIndex = inputInfo->getLayout().getBatchIndex();
-        if (batchIndex.has_value() && batchIndex.value() >= inputInfo->getShape().size()) {
+        // Batch and mode for given input
+        const auto& batchIndex = input.batchIndex;
+        if (input.batchIndexOutOfRange) {
             SPDLOG_DEBUG("[servable name: {} version: {}] Batch index out of shape range for input: {} layout: {} shape: {}",
                 servableName, servableVersion, name, inputInfo->getLayout(), inputInfo->getShape().toString());
             return StatusCode::INTERNAL_ERROR;
         }
 
-        Mode shapeMode = getShapeMode(shapeInfo, name);
+        const Mode shapeMode = input.shapeMode;
 
         if (requiresPreProcessing(proto)) {
-            const auto processingHint = inputInfo->getPreProcessingHint();
+            const auto processingHint = input.processingHint;
             int32_t inputBatchSize = 0;
             size_t inputWidth = 0;
             if (dataInRawInputContents(request)) {
@@ -1037,14 +1206,14 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
                     servableName, servableVersion, name);
                 RETURN_IF_ERR(validateNumberOfBinaryInputShapeDimensions(proto));
                 RETURN_IF_ERR(validateAgainstMax2DStringArraySize(inputBatchSize, inputWidth));
-                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, inputInfo->getBatchSize(), finalStatus, batchingMode, shapeMode, inputBatchSize));  // 2 dimensions assumed
+                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, input.batchSize, finalStatus, batchingMode, shapeMode, inputBatchSize));  // 2 dimensions assumed
                 RETURN_IF_ERR(checkStringShapeMismatch(proto, *inputInfo, finalStatus, batchingMode, shapeMode, inputBatchSize, inputWidth));
                 continue;
             } else if (processingHint == TensorInfo::ProcessingHint::IMAGE) {
                 SPDLOG_DEBUG("[servable name: {} version: {}] Validating request containing binary image input: name: {}",
                     servableName, servableVersion, name);
                 RETURN_IF_ERR(validateNumberOfBinaryInputShapeDimensions(proto));
-                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, inputInfo->getBatchSize(), finalStatus, batchingMode, shapeMode, inputBatchSize));  // 4/5 dimensions assumed
+                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, input.batchSize, finalStatus, batchingMode, shapeMode, inputBatchSize));  // 4/5 dimensions assumed
                 continue;
             } else {
                 SPDLOG_DEBUG("Request input: {} requires conversion but endpoint specifies no processing hint. Number of dimensions: {}; precision: {}; demultiplexer: {}",
@@ -1054,31 +1223,50 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
         }
 
         // Data Array Proto
-        RETURN_IF_ERR(validatePrecision(*inputInfo, proto));
+        RETURN_IF_ERR(validatePrecision(input, proto));
         RETURN_IF_ERR(validateNumberOfShapeDimensions(*inputInfo, proto));
-        RETURN_IF_ERR(checkBatchSizeMismatch(proto, inputInfo->getBatchSize(), batchIndex, finalStatus, batchingMode, shapeMode));
+        RETURN_IF_ERR(checkBatchSizeMismatch(proto, input.batchSize, batchIndex, finalStatus, batchingMode, shapeMode));
         RETURN_IF_ERR(checkShapeMismatch(proto, *inputInfo, batchIndex, finalStatus, batchingMode, shapeMode));
-        RETURN_IF_ERR(validateTensorContent(proto, inputInfo->getPrecision(), bufferId));
+        RETURN_IF_ERR(validateTensorContent(proto, input, bufferId));
     }
     return finalStatus;
 }
 
+template <>
+Status validate(const TFSRequestType& request, const ValidationPlan& plan, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode) {
+    OVMS_PROFILE_FUNCTION();
+    return RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>(request, plan, servableName, servableVersion, optionalAllowedInputNames, batchingMode).validate();
+}
+
+template <>
+Status validate(const KFSRequest& request, const ValidationPlan& plan, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode) {
+    OVMS_PROFILE_FUNCTION();
+    return RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>(request, plan, servableName, servableVersion, optionalAllowedInputNames, batchingMode).validate();
+}
+
+template <>
+Status validate(const InferenceRequest& request, const ValidationPlan& plan, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode) {
+    OVMS_PROFILE_FUNCTION();
+    return RequestValidator<InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>(request, plan, servableName, servableVersion, optionalAllowedInputNames, batchingMode).validate();
+}
+
+// Used when inputs are not known up front, e.g. by pipelines. Plan is built for single request.
 template <>
 Status validate(const TFSRequestType& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return validate(request, ValidationPlan(inputsInfo, shapeInfo), servableName, servableVersion, optionalAllowedInputNames, batchingMode);
 }
 
 template <>
 Status validate(const KFSRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return validate(request, ValidationPlan(inputsInfo, shapeInfo), servableName, servableVersion, optionalAllowedInputNames, batchingMode);
 }
 
 template <>
 Status validate(const InferenceRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return validate(request, ValidationPlan(inputsInfo, shapeInfo), servableName, servableVersion, optionalAllowedInputNames, batchingMode);
 }
 }  // namespace request_validation_utils
 }  // namespace ovms
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <limits>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -30,6 +32,66 @@ namespace ovms {
 class Status;
 namespace request_validation_utils {
 
+/**
+ * @brief Model inputs data required by request validation, computed once per model load.
+ *
+ * Inputs are kept in a flat vector in the same order as in tensor_map_t so validation errors
+ * are reported for the same input as before. Request input names are resolved with a perfect hash table.
+ */
+class ValidationPlan {
+public:
+    struct AcceptedPrecision {
+        Precision precision;
+        std::string kfsDatatype;
+        size_t itemsize;
+    };
+
+    struct Input {
+        std::string name;
+        std::shared_ptr<const TensorInfo> info;
+        Precision precision;
+        std::string kfsDatatype;
+        size_t itemsize;
+        TensorInfo::ProcessingHint processingHint;
+        Mode shapeMode;
+        std::optional<Dimension> batchSize;
+        std::optional<size_t> batchIndex;
+        bool batchIndexOutOfRange;
+        // Number of elements when model shape is fully static
+        std::optional<size_t> staticValueCount;
+        // Request precisions converted into model precision during deserialization
+        std::vector<AcceptedPrecision> acceptedPrecisions;
+
+        const AcceptedPrecision* findAcceptedPrecision(Precision requestPrecision) const;
+        const AcceptedPrecision* findAcceptedPrecision(const std::string& requestKfsDatatype) const;
+    };
+
+    static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+    ValidationPlan(const tensor_map_t& inputsInfo, const shapes_info_map_t& shapeInfo);
+
+    const std::vector<Input>& getInputs() const { return inputs; }
+
+    /**
+     * @brief Returns position of input in getInputs() or NOT_FOUND
+     */
+    size_t find(const char* name, size_t length) const;
+    size_t find(const std::string& name) const { return find(name.data(), name.size()); }
+
+private:
+    static uint64_t hash(const char* name, size_t length, uint64_t seed);
+    void buildLookupTable();
+
+    std::vector<Input> inputs;
+    // Slot holds input position + 1, 0 marks empty slot
+    std::vector<uint32_t> slots;
+    uint64_t seed = 0;
+    uint64_t mask = 0;
+};
+
+/**
+ * @brief Builds temporary ValidationPlan for each call, request paths should use plan cached per model or pipeline load
+ */
 template <typename RequestType>
 Status validate(
     const RequestType& request,
@@ -40,6 +102,15 @@ Status validate(
     const Mode batchingMode = Mode::FIXED,
     const shapes_info_map_t& shapeInfo = shapes_info_map_t());
 
+template <typename RequestType>
+Status validate(
+    const RequestType& request,
+    const ValidationPlan& plan,
+    const std::string& servableName,
+    const model_version_t servableVersion,
+    const std::set<std::string>& optionalAllowedInputNames = {},
+    const Mode batchingMode = Mode::FIXED);
+
 // This function is expected to be called with already validated shape that does not contain negative dimensions
 template <typename T>
 static bool computeExpectedBufferSizeReturnFalseIfOverflow(const std::vector<T>& shape, const size_t& itemsize, size_t& expectedBufferSize) {
@@ -37,6 +37,7 @@
 #include "ovinferrequestsqueue.hpp"
 #include "prediction_service_utils.hpp"
 #include "profiler.hpp"
+#include "request_tracer.hpp"
 #include "servablemanagermodule.hpp"
 #include "server.hpp"
 #include "status.hpp"
@@ -89,6 +90,7 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
     const PredictRequest* request,
     PredictResponse* response) {
     OVMS_PROFILE_FUNCTION();
+    RequestTraceScope traceScope("gRPC Predict", isTraceRequested(context));
     Timer<TIMER_END> timer;
     timer.start(TOTAL);
     using std::chrono::microseconds;
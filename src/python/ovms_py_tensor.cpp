@@ -16,6 +16,7 @@
 
 #include "ovms_py_tensor.hpp"
 
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <string>
@@ -26,6 +27,25 @@
 namespace py = pybind11;
 using namespace ovms;
 
+namespace {
+// Copies elements from dimension dim onwards in C order, returns position after last written byte
+char* copyStrided(const char* source, char* destination, const std::vector<py::ssize_t>& shape, const std::vector<py::ssize_t>& strides, py::ssize_t itemsize, size_t dim) {
+    if (dim == shape.size()) {
+        memcpy(destination, source, itemsize);
+        return destination + itemsize;
+    }
+    if (dim + 1 == shape.size() && strides[dim] == itemsize) {
+        const size_t bytes = shape[dim] * itemsize;
+        memcpy(destination, source, bytes);
+        return destination + bytes;
+    }
+    for (py::ssize_t i = 0; i < shape[dim]; i++) {
+        destination = copyStrided(source + i * strides[dim], destination, shape, strides, itemsize, dim + 1);
+    }
+    return destination;
+}
+}  // namespace
+
 OvmsPyTensor::OvmsPyTensor(const std::string& name, void* data, const std::vector<py::ssize_t>& shape, const std::string& datatype, py::ssize_t size, bool copy) :
     name(name),
     datatype(datatype),
@@ -81,3 +101,19 @@ OvmsPyTensor::OvmsPyTensor(const std::string& name, const py::buffer& buffer, co
         this->datatype = it != bufferFormatToDatatype.end() ? it->second : format;
     }
 }
+
+bool OvmsPyTensor::isContiguous() const {
+    py::ssize_t expectedStride = itemsize;
+    for (py::ssize_t i = ndim - 1; i >= 0; i--) {
+        if (bufferShape[i] > 1 && strides[i] != expectedStride) {
+            return false;
+        }
+        expectedStride *= bufferShape[i];
+    }
+    return true;
+}
+
+void OvmsPyTensor::copyToContiguous(void* destination) const {
+    // Strides can be negative, ptr points to the first element in C order
+    copyStrided(static_cast<const char*>(ptr), static_cast<char*>(destination), bufferShape, strides, itemsize, 0);
+}
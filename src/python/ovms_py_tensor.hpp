@@ -123,5 +123,11 @@ public:
 
     // Construct object from buffer info. By default shape and datatype are infered from the buffer, but can be set directly if needed.
     OvmsPyTensor(const std::string& name, const py::buffer& buffer, const std::optional<std::vector<py::ssize_t>>& shape, const std::optional<std::string>& datatype);
+
+    // True if buffer elements are laid out in C order without gaps
+    bool isContiguous() const;
+
+    // Copies buffer elements in C order following strides. Destination must hold size bytes.
+    void copyToContiguous(void* destination) const;
 };
 }  // namespace ovms
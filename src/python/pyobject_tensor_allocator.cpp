@@ -0,0 +1,40 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "pyobject_tensor_allocator.hpp"
+
+namespace ovms {
+
+PyObjectTensorAllocator::PyObjectTensorAllocator(const py::object& owner, void* data) :
+    owner(std::make_shared<PyObjectWrapper<py::object>>(owner)),
+    data(data) {}
+
+void* PyObjectTensorAllocator::allocate(const size_t bytes, const size_t alignment) {
+    return this->data;
+}
+
+void PyObjectTensorAllocator::deallocate(void* handle, const size_t bytes, size_t alignment) {
+    // Reference to Python object is released with the last copy of allocator
+}
+
+bool PyObjectTensorAllocator::is_equal(const PyObjectTensorAllocator& other) const {
+    return (this->owner == other.owner) && (this->data == other.data);
+}
+
+ov::Tensor createOvTensorFromPyObject(const py::object& owner, void* data, const ov::element::Type_t precision, const ov::Shape& shape) {
+    return ov::Tensor(precision, shape, ov::Allocator(PyObjectTensorAllocator(owner, data)));
+}
+
+}  // namespace ovms
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <memory>
+
+#include <openvino/openvino.hpp>
+#include <pybind11/pybind11.h>
+
+#include "utils.hpp"
+
+namespace py = pybind11;
+
+namespace ovms {
+
+/**
+ * @brief Allocator for ov::Tensor using memory of Python object instead of allocating it.
+ * Python object is referenced as long as any tensor created with the allocator exists.
+ */
+class PyObjectTensorAllocator {
+    std::shared_ptr<PyObjectWrapper<py::object>> owner;
+    void* data;
+
+public:
+    PyObjectTensorAllocator(const py::object& owner, void* data);
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t));
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t));
+    bool is_equal(const PyObjectTensorAllocator& other) const;
+};
+
+/**
+ * @brief Creates ov::Tensor sharing memory with Python object
+ */
+ov::Tensor createOvTensorFromPyObject(const py::object& owner, void* data, const ov::element::Type_t precision, const ov::Shape& shape);
+
+}  // namespace ovms
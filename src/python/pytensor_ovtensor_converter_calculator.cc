@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -26,6 +27,7 @@
 #include <pybind11/stl.h>
 
 #include "../precision.hpp"
+#include "pyobject_tensor_allocator.hpp"
 #include "python_backend.hpp"
 #include "src/python/ovms_py_tensor.hpp"
 #include "src/python/pytensor_ovtensor_converter_calculator.pb.h"
@@ -159,14 +161,18 @@ public:
                            << "Undefined precision in input tensor: " << inputTensor.get_element_type();
                 }
 
-                pythonBackend.createOvmsPyTensor(
-                    outputName,
-                    const_cast<void*>((const void*)inputTensor.data()),
-                    shape,
-                    datatype,
-                    inputTensor.get_byte_size(),
-                    outputPyTensor,
-                    true);
+                // Python tensor shares memory with input tensor and holds its copy, so data stays valid as long as Python object exists
+                if (!pythonBackend.createOvmsPyTensor(
+                        outputName,
+                        const_cast<void*>((const void*)inputTensor.data()),
+                        shape,
+                        datatype,
+                        inputTensor.get_byte_size(),
+                        std::make_shared<ov::Tensor>(inputTensor),
+                        outputPyTensor)) {
+                    return mediapipe::InvalidArgumentErrorBuilder(MEDIAPIPE_LOC)
+                           << "Failed to create python tensor: " << outputName;
+                }
                 cc->Outputs().Tag(OVMS_PY_TENSOR_TAG_NAME).Add(outputPyTensor.release(), cc->InputTimestamp());
             } else {
                 if (*(cc->Inputs().GetTags().begin()) == OVMS_PY_TENSOR_TAG_NAME) {
@@ -185,14 +191,20 @@ public:
                         }
                         shape.push_back(dim);
                     }
-                    const void* data = reinterpret_cast<const void*>(inputTensor.getProperty<void*>("ptr"));
-                    size_t bufferSize = inputTensor.getProperty<size_t>("size");
-                    std::unique_ptr<ov::Tensor> output = std::make_unique<ov::Tensor>(precision, shape);
-                    if (bufferSize != output->get_byte_size()) {
+                    const OvmsPyTensor& pyTensor = inputTensor.getObject().cast<const OvmsPyTensor&>();
+                    const size_t expectedSize = ov::shape_size(shape) * ov::element::Type(precision).size();
+                    if (pyTensor.size != expectedSize) {
                         return mediapipe::InvalidArgumentErrorBuilder(MEDIAPIPE_LOC)
-                               << "python buffer size: " << bufferSize << "; OV tensor size: " << output->get_byte_size() << "; mismatch";
+                               << "python buffer size: " << pyTensor.size << "; OV tensor size: " << expectedSize << "; mismatch";
+                    }
+                    std::unique_ptr<ov::Tensor> output;
+                    if (pyTensor.isContiguous()) {
+                        // OV tensor references Python object owning the buffer instead of copying it
+                        output = std::make_unique<ov::Tensor>(createOvTensorFromPyObject(inputTensor.getObject(), pyTensor.ptr, precision, shape));
+                    } else {
+                        output = std::make_unique<ov::Tensor>(precision, shape);
+                        pyTensor.copyToContiguous(output->data());
                     }
-                    memcpy((*output).data(), const_cast<void*>(data), output->get_byte_size());
                     cc->Outputs().Tag(OV_TENSOR_TAG_NAME).Add(output.release(), cc->InputTimestamp());
                 }
             }
@@ -19,6 +19,7 @@
 #include <pybind11/stl.h>
 
 #include "../logging.hpp"
+#include "src/python/ovms_py_tensor.hpp"
 
 namespace py = pybind11;
 using namespace py::literals;
@@ -73,6 +74,29 @@ bool PythonBackend::createOvmsPyTensor(const std::string& name, void* ptr, const
     return false;
 }
 
+bool PythonBackend::createOvmsPyTensor(const std::string& name, void* ptr, const std::vector<py::ssize_t>& shape,
+    const std::string& datatype, py::ssize_t size, std::shared_ptr<void> dataOwner, std::unique_ptr<PyObjectWrapper<py::object>>& outTensor) {
+    py::gil_scoped_acquire acquire;
+    try {
+        py::object ovmsPyTensor = tensorClass->attr("create_from_data")(name, ptr, shape, datatype, size, false);
+        ovmsPyTensor.cast<OvmsPyTensor&>().refObj = py::capsule(new std::shared_ptr<void>(std::move(dataOwner)), [](void* owner) {
+            delete static_cast<std::shared_ptr<void>*>(owner);
+        });
+        outTensor = std::make_unique<PyObjectWrapper<py::object>>(ovmsPyTensor);
+        return true;
+    } catch (const pybind11::error_already_set& e) {
+        SPDLOG_DEBUG("PythonBackend::createOvmsPyTensor - Py Error: {}", e.what());
+        return false;
+    } catch (std::exception& e) {
+        SPDLOG_DEBUG("PythonBackend::createOvmsPyTensor - Error: {}", e.what());
+        return false;
+    } catch (...) {
+        SPDLOG_DEBUG("PythonBackend::createOvmsPyTensor - Unknown Error");
+        return false;
+    }
+    return false;
+}
+
 void PythonBackend::validateOvmsPyTensor(const py::object& object) const {
     py::gil_scoped_acquire acquire;
     if (!py::isinstance(object, *tensorClass)) {
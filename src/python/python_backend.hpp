@@ -42,6 +42,10 @@ public:
     bool createOvmsPyTensor(const std::string& name, void* ptr, const std::vector<py::ssize_t>& shape, const std::string& datatype,
         py::ssize_t size, std::unique_ptr<PyObjectWrapper<py::object>>& outTensor, bool copy = false);
 
+    // Creates tensor using data without copying. Data owner is released together with the tensor.
+    bool createOvmsPyTensor(const std::string& name, void* ptr, const std::vector<py::ssize_t>& shape, const std::string& datatype,
+        py::ssize_t size, std::shared_ptr<void> dataOwner, std::unique_ptr<PyObjectWrapper<py::object>>& outTensor);
+
     // Checks if object is tensorClass instance. Throws UnexpectedPythonObjectError if it's not.
     void validateOvmsPyTensor(const py::object& object) const;
 };
@@ -13,6 +13,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <optional>
+#include <stdexcept>
 #include <unordered_map>
 
 #include "pythonnoderesources.hpp"
@@ -26,7 +28,9 @@
 #include <pybind11/embed.h>  // everything needed for embedding
 #include <pybind11/stl.h>
 
+#include "../status.hpp"
 #include "python_backend.hpp"
+#include "python_worker_pool.hpp"
 
 namespace py = pybind11;
 using namespace py::literals;
@@ -162,6 +166,45 @@ class PythonExecutorCalculator : public CalculatorBase {
         }
     }
 
+    // Inputs are passed to worker process through shared memory, GIL is held only while reading and creating tensors
+    void executeInWorkerPool(CalculatorContext* cc) {
+        std::vector<PythonWorkerInput> inputs;
+        {
+            py::gil_scoped_acquire acquire;
+            std::vector<py::object> pyInputs;
+            prepareInputs(cc, &pyInputs);
+            for (const py::object& pyInput : pyInputs) {
+                PythonWorkerInput input;
+                input.name = pyInput.attr("name").cast<std::string>();
+                input.datatype = pyInput.attr("datatype").cast<std::string>();
+                for (py::ssize_t dim : pyInput.attr("shape").cast<std::vector<py::ssize_t>>()) {
+                    input.shape.push_back(dim);
+                }
+                // Data stays valid since input packets are held until Process returns
+                input.data = pyInput.attr("ptr").cast<void*>();
+                input.size = pyInput.attr("size").cast<size_t>();
+                inputs.emplace_back(std::move(input));
+            }
+        }
+        std::vector<PythonWorkerOutput> outputs;
+        auto status = nodeResources->workerPool->execute(inputs, outputs);
+        if (!status.ok()) {
+            throw std::runtime_error(status.string());
+        }
+        py::gil_scoped_acquire acquire;
+        py::list pyOutputs;
+        for (auto& output : outputs) {
+            std::unique_ptr<PyObjectWrapper<py::object>> pyOutput;
+            std::vector<py::ssize_t> shape(output.shape.begin(), output.shape.end());
+            if (!nodeResources->pythonBackend->createOvmsPyTensor(output.name, const_cast<void*>(output.data), shape, output.datatype, output.size, output.segment, pyOutput)) {
+                throw std::runtime_error("Failed to create output tensor: " + output.name);
+            }
+            pyOutputs.append(pyOutput->getObject());
+        }
+        outputTimestamp = cc->InputTimestamp();
+        pushOutputs(cc, pyOutputs, outputTimestamp, false);
+    }
+
 public:
     static absl::Status GetContract(CalculatorContract* cc) {
         LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->GetNodeName() << "] GetContract start";
@@ -205,9 +248,14 @@ public:
 
     absl::Status Process(CalculatorContext* cc) final {
         LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process start";
-        py::gil_scoped_acquire acquire;
+        std::optional<py::gil_scoped_acquire> acquire;
+        if (!nodeResources->workerPool) {
+            acquire.emplace();
+        }
         try {
-            if (generatorInitialized()) {
+            if (nodeResources->workerPool) {
+                executeInWorkerPool(cc);
+            } else if (generatorInitialized()) {
                 if (receivedNewData(cc)) {
                     LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Node is already processing data. Create new stream for another request.";
                     return absl::Status(absl::StatusCode::kResourceExhausted, "Node is already processing data. Create new stream for another request.");
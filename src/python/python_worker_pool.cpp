@@ -0,0 +1,713 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "python_worker_pool.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "../logging.hpp"
+#include "../status.hpp"
+
+namespace ovms {
+
+namespace {
+// Worker runs handler in its own interpreter. It reads newline delimited JSON requests from the socket passed as
+// first argument, maps input tensors from shared memory without copying and writes outputs into a new segment
+// created for each response.
+const char* WORKER_SCRIPT = R"PYTHON(
+import importlib, json, mmap, os, socket, sys, traceback
+from pyovms import Tensor
+
+FORMATS = {"BOOL": "?", "UINT8": "B", "UINT16": "H", "UINT32": "I", "UINT64": "Q", "INT8": "b",
+           "INT16": "h", "INT32": "i", "INT64": "q", "FP32": "f", "FP64": "d"}
+ALIGNMENT = 64
+
+def send(writer, message):
+    writer.write(json.dumps(message).encode() + b"\n")
+    writer.flush()
+
+def open_segment(name, size, create=False):
+    path = "/dev/shm/" + name.lstrip("/")
+    fd = os.open(path, os.O_RDWR | (os.O_CREAT | os.O_EXCL if create else 0), 0o600)
+    try:
+        if create:
+            os.ftruncate(fd, size)
+        return mmap.mmap(fd, size)
+    finally:
+        os.close(fd)
+
+def to_tensor(view, description):
+    data = view[description["offset"]:description["offset"] + description["size"]]
+    shape = description["shape"]
+    datatype = description["datatype"]
+    try:
+        if datatype in FORMATS:
+            data = data.cast(FORMATS[datatype], shape)
+        elif datatype == "FP16":
+            import numpy
+            data = numpy.frombuffer(data, dtype=numpy.float16).reshape(shape)
+    except (ImportError, TypeError, ValueError):
+        pass
+    return Tensor(description["name"], data, shape, datatype)
+
+def write_outputs(outputs, segment_name):
+    if not isinstance(outputs, list):
+        raise TypeError("Unexpected Python object type. Expected: list. Received: " + type(outputs).__name__ +
+                        ". Generators are not supported in worker processes")
+    buffers = []
+    descriptions = []
+    offset = 0
+    for output in outputs:
+        if not isinstance(output, Tensor):
+            raise TypeError("Unexpected Python object type. Expected: Tensor. Received: " + type(output).__name__)
+        view = memoryview(output)
+        raw = view.cast("B") if view.c_contiguous else memoryview(view.tobytes())
+        descriptions.append({"name": output.name, "datatype": output.datatype, "shape": list(output.shape),
+                             "offset": offset, "size": raw.nbytes})
+        buffers.append(raw)
+        offset += (raw.nbytes + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+    if offset == 0:
+        return {"status": "ok", "segment": "", "size": 0, "outputs": descriptions}
+    segment = open_segment(segment_name, offset, create=True)
+    try:
+        for description, raw in zip(descriptions, buffers):
+            segment[description["offset"]:description["offset"] + description["size"]] = raw
+    finally:
+        segment.close()
+    return {"status": "ok", "segment": segment_name, "size": offset, "outputs": descriptions}
+
+def main():
+    channel = socket.socket(fileno=int(sys.argv[1]))
+    reader = channel.makefile("rb")
+    writer = channel.makefile("wb")
+    handler_path = sys.argv[2]
+    try:
+        sys.path.append(os.path.dirname(handler_path))
+        script = importlib.import_module(os.path.splitext(os.path.basename(handler_path))[0])
+        model = script.OvmsPythonModel()
+        if hasattr(model, "initialize"):
+            model.initialize(json.loads(sys.argv[3]))
+    except BaseException:
+        send(writer, {"status": "error", "message": traceback.format_exc()})
+        return 1
+    send(writer, {"status": "ready"})
+    input_segment = memoryview(b"")
+    input_segment_key = None
+    for line in reader:
+        request = json.loads(line)
+        if request["op"] == "finalize":
+            if hasattr(model, "finalize"):
+                model.finalize()
+            send(writer, {"status": "ok"})
+            return 0
+        try:
+            key = (request["segment"], request["segment_size"])
+            if request["segment"] and key != input_segment_key:
+                # Views of previous mapping may still be referenced by handler, so it is released by garbage collector
+                input_segment = memoryview(open_segment(request["segment"], request["segment_size"]))
+                input_segment_key = key
+            inputs = [to_tensor(input_segment, description) for description in request["inputs"]]
+            send(writer, write_outputs(model.execute(inputs), request["output_segment"]))
+        except BaseException:
+            try:
+                os.unlink("/dev/shm/" + request["output_segment"].lstrip("/"))
+            except OSError:
+                pass
+            send(writer, {"status": "error", "message": traceback.format_exc()})
+    return 0
+
+sys.exit(main())
+)PYTHON";
+
+constexpr size_t SEGMENT_ALIGNMENT = 64;
+constexpr size_t MIN_INPUT_SEGMENT_SIZE = 64 * 1024;
+constexpr int WORKER_CHANNEL_FD = 3;
+constexpr int FINALIZE_TIMEOUT_MS = 10000;
+constexpr auto EXIT_TIMEOUT = std::chrono::seconds(5);
+constexpr auto MIN_RESTART_BACKOFF = std::chrono::milliseconds(1000);
+
+std::atomic<uint64_t> poolCounter{0};
+
+size_t alignUp(size_t value) {
+    return (value + SEGMENT_ALIGNMENT - 1) / SEGMENT_ALIGNMENT * SEGMENT_ALIGNMENT;
+}
+
+// Validates output description received from worker before it is accessed
+bool parseOutputDescription(const rapidjson::Value& description, PythonWorkerOutput& output, size_t& offset) {
+    if (!description.IsObject() ||
+        !description.HasMember("name") || !description["name"].IsString() ||
+        !description.HasMember("datatype") || !description["datatype"].IsString() ||
+        !description.HasMember("shape") || !description["shape"].IsArray() ||
+        !description.HasMember("size") || !description["size"].IsUint64() ||
+        !description.HasMember("offset") || !description["offset"].IsUint64()) {
+        return false;
+    }
+    output.name = description["name"].GetString();
+    output.datatype = description["datatype"].GetString();
+    for (auto& dim : description["shape"].GetArray()) {
+        if (!dim.IsInt64()) {
+            return false;
+        }
+        output.shape.push_back(dim.GetInt64());
+    }
+    output.size = description["size"].GetUint64();
+    offset = description["offset"].GetUint64();
+    return true;
+}
+
+template <typename Writer>
+void writeShape(Writer& writer, const std::vector<int64_t>& shape) {
+    writer.StartArray();
+    for (auto dim : shape) {
+        writer.Int64(dim);
+    }
+    writer.EndArray();
+}
+}  // namespace
+
+struct PythonWorker {
+    size_t id;
+    pid_t pid = -1;
+    int channel = -1;
+    std::string readBuffer;
+    std::unique_ptr<SharedMemorySegment> inputSegment;
+    bool alive = false;
+    // Held while handler executes, so shutdown does not stop worker in the middle of execution
+    std::mutex executionMtx;
+
+    bool sendMessage(const std::string& message) {
+        std::string line = message + "\n";
+        size_t sent = 0;
+        while (sent < line.size()) {
+            ssize_t result = ::send(this->channel, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                SPDLOG_DEBUG("Failed to send message to python worker {} (pid: {}): {}", this->id, this->pid, std::strerror(errno));
+                return false;
+            }
+            sent += result;
+        }
+        return true;
+    }
+
+    // Timeout applies to the whole message, -1 waits indefinitely
+    bool receiveMessage(rapidjson::Document& message, int timeoutMs = -1, bool* timedOut = nullptr) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 0));
+        size_t lineEnd;
+        while ((lineEnd = this->readBuffer.find('\n')) == std::string::npos) {
+            int remainingMs = -1;
+            if (timeoutMs >= 0) {
+                remainingMs = static_cast<int>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count()));
+            }
+            struct pollfd pfd = {this->channel, POLLIN, 0};
+            int ready = ::poll(&pfd, 1, remainingMs);
+            if (ready < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ready <= 0) {
+                SPDLOG_DEBUG("Timeout while waiting for message from python worker {} (pid: {})", this->id, this->pid);
+                if (timedOut != nullptr && ready == 0) {
+                    *timedOut = true;
+                }
+                return false;
+            }
+            char chunk[4096];
+            ssize_t received = ::recv(this->channel, chunk, sizeof(chunk), 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received <= 0) {
+                SPDLOG_DEBUG("Python worker {} (pid: {}) closed connection", this->id, this->pid);
+                return false;
+            }
+            this->readBuffer.append(chunk, received);
+        }
+        std::string line = this->readBuffer.substr(0, lineEnd);
+        this->readBuffer.erase(0, lineEnd + 1);
+        if (message.Parse(line.c_str()).HasParseError() || !message.IsObject() || !message.HasMember("status") || !message["status"].IsString()) {
+            SPDLOG_ERROR("Received malformed message from python worker {} (pid: {})", this->id, this->pid);
+            return false;
+        }
+        return true;
+    }
+
+    bool isRunning() {
+        if (this->pid <= 0) {
+            return false;
+        }
+        int status;
+        pid_t result = ::waitpid(this->pid, &status, WNOHANG);
+        if (result == 0) {
+            return true;
+        }
+        if (result == this->pid) {
+            SPDLOG_DEBUG("Python worker {} (pid: {}) exited with status: {}", this->id, this->pid, WIFEXITED(status) ? WEXITSTATUS(status) : -WTERMSIG(status));
+            this->pid = -1;
+        }
+        return false;
+    }
+};
+
+SharedMemorySegment::SharedMemorySegment(const std::string& name, char* ptr, size_t size, int fd, bool owner) :
+    name(name),
+    ptr(ptr),
+    size(size),
+    fd(fd),
+    owner(owner) {}
+
+SharedMemorySegment::~SharedMemorySegment() {
+    if (this->ptr != nullptr) {
+        ::munmap(this->ptr, this->size);
+    }
+    if (this->fd >= 0) {
+        ::close(this->fd);
+    }
+    if (this->owner) {
+        ::shm_unlink(this->name.c_str());
+    }
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::create(const std::string& name, size_t size) {
+    int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        SPDLOG_ERROR("Failed to create shared memory segment: {}; error: {}", name, std::strerror(errno));
+        return nullptr;
+    }
+    if (::ftruncate(fd, size) != 0) {
+        SPDLOG_ERROR("Failed to resize shared memory segment: {} to {} bytes; error: {}", name, size, std::strerror(errno));
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        return nullptr;
+    }
+    void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        SPDLOG_ERROR("Failed to map shared memory segment: {}; error: {}", name, std::strerror(errno));
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemorySegment>(new SharedMemorySegment(name, static_cast<char*>(ptr), size, fd, true));
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::openAndUnlink(const std::string& name, size_t size) {
+    int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0) {
+        SPDLOG_ERROR("Failed to open shared memory segment: {}; error: {}", name, std::strerror(errno));
+        return nullptr;
+    }
+    ::shm_unlink(name.c_str());
+    struct stat segmentStat;
+    if (::fstat(fd, &segmentStat) != 0 || static_cast<size_t>(segmentStat.st_size) < size) {
+        SPDLOG_ERROR("Shared memory segment: {} is smaller than expected {} bytes", name, size);
+        ::close(fd);
+        return nullptr;
+    }
+    void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+        SPDLOG_ERROR("Failed to map shared memory segment: {}; error: {}", name, std::strerror(errno));
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemorySegment>(new SharedMemorySegment(name, static_cast<char*>(ptr), size, -1, false));
+}
+
+bool SharedMemorySegment::reserve(size_t requestedSize) {
+    if (requestedSize <= this->size) {
+        return true;
+    }
+    if (this->fd < 0) {
+        return false;
+    }
+    ::munmap(this->ptr, this->size);
+    this->ptr = nullptr;
+    if (::ftruncate(this->fd, requestedSize) != 0) {
+        SPDLOG_ERROR("Failed to resize shared memory segment: {} to {} bytes; error: {}", this->name, requestedSize, std::strerror(errno));
+        return false;
+    }
+    void* newPtr = ::mmap(nullptr, requestedSize, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+    if (newPtr == MAP_FAILED) {
+        SPDLOG_ERROR("Failed to map shared memory segment: {}; error: {}", this->name, std::strerror(errno));
+        return false;
+    }
+    this->ptr = static_cast<char*>(newPtr);
+    this->size = requestedSize;
+    return true;
+}
+
+PythonWorkerPool::PythonWorkerPool(const std::string& handlerPath, const std::string& initializeArguments, size_t workersCount, const std::string& pythonExecutable, std::chrono::milliseconds executeTimeout) :
+    handlerPath(handlerPath),
+    initializeArguments(initializeArguments),
+    pythonExecutable(pythonExecutable),
+    segmentPrefix("/ovms_py_" + std::to_string(::getpid()) + "_" + std::to_string(poolCounter.fetch_add(1))),
+    executeTimeout(executeTimeout) {
+    for (size_t i = 0; i < workersCount; i++) {
+        this->workers.emplace_back(std::make_unique<PythonWorker>());
+        this->workers.back()->id = i;
+        this->idleWorkers.push_back(i);
+    }
+}
+
+PythonWorkerPool::~PythonWorkerPool() {
+    this->shutdown();
+}
+
+Status PythonWorkerPool::start() {
+    for (auto& worker : this->workers) {
+        auto status = this->startWorker(*worker);
+        if (!status.ok()) {
+            this->shutdown();
+            return status;
+        }
+    }
+    this->restartThread = std::thread(&PythonWorkerPool::restartLoop, this);
+    SPDLOG_INFO("Started {} python worker processes for handler: {}", this->workers.size(), this->handlerPath);
+    return StatusCode::OK;
+}
+
+Status PythonWorkerPool::startWorker(PythonWorker& worker) {
+    int sockets[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0) {
+        SPDLOG_ERROR("Failed to create python worker channel: {}", std::strerror(errno));
+        return StatusCode::PYTHON_NODE_WORKER_START_FAILED;
+    }
+    // Everything used by the child is prepared before fork since only async-signal-safe calls are allowed there
+    const std::string channelFd = std::to_string(WORKER_CHANNEL_FD);
+    std::vector<const char*> argv{this->pythonExecutable.c_str(), "-c", WORKER_SCRIPT, channelFd.c_str(), this->handlerPath.c_str(), this->initializeArguments.c_str(), nullptr};
+    struct rlimit fdLimit;
+    const int maxFd = (::getrlimit(RLIMIT_NOFILE, &fdLimit) == 0 && fdLimit.rlim_cur != RLIM_INFINITY) ? static_cast<int>(fdLimit.rlim_cur) : 4096;
+    const pid_t parentPid = ::getpid();
+
+    pid_t pid = ::fork();
+    if (pid < 0) {
+        SPDLOG_ERROR("Failed to fork python worker process: {}", std::strerror(errno));
+        ::close(sockets[0]);
+        ::close(sockets[1]);
+        return StatusCode::PYTHON_NODE_WORKER_START_FAILED;
+    }
+    if (pid == 0) {
+        ::prctl(PR_SET_PDEATHSIG, SIGKILL);
+        if (::getppid() != parentPid) {
+            ::_exit(1);
+        }
+        int channel = ::fcntl(sockets[1], F_DUPFD, WORKER_CHANNEL_FD + 1);
+        if (channel < 0 || ::dup2(channel, WORKER_CHANNEL_FD) < 0) {
+            ::_exit(1);
+        }
+        // Do not leak server sockets and files to the worker
+        for (int fd = WORKER_CHANNEL_FD + 1; fd < maxFd; fd++) {
+            ::close(fd);
+        }
+        ::execvp(argv[0], const_cast<char* const*>(argv.data()));
+        ::_exit(127);
+    }
+    ::close(sockets[1]);
+    worker.pid = pid;
+    worker.channel = sockets[0];
+    worker.readBuffer.clear();
+    worker.inputSegment.reset();
+
+    rapidjson::Document message;
+    if (!worker.receiveMessage(message)) {
+        SPDLOG_ERROR("Python worker {} (pid: {}) for handler: {} exited during initialization", worker.id, pid, this->handlerPath);
+        this->stopWorker(worker, false);
+        return StatusCode::PYTHON_NODE_WORKER_START_FAILED;
+    }
+    if (std::string(message["status"].GetString()) != "ready") {
+        SPDLOG_ERROR("Python worker {} (pid: {}) initialization failed for handler: {} - {}", worker.id, pid, this->handlerPath,
+            message.HasMember("message") && message["message"].IsString() ? message["message"].GetString() : "");
+        this->stopWorker(worker, false);
+        return StatusCode::PYTHON_NODE_FILE_STATE_INITIALIZATION_FAILED;
+    }
+    worker.alive = true;
+    this->aliveWorkers++;
+    SPDLOG_DEBUG("Python worker {} (pid: {}) initialized for handler: {}", worker.id, pid, this->handlerPath);
+    return StatusCode::OK;
+}
+
+void PythonWorkerPool::stopWorker(PythonWorker& worker, bool graceful) {
+    if (worker.alive) {
+        worker.alive = false;
+        this->aliveWorkers--;
+    }
+    if (graceful && worker.isRunning() && worker.sendMessage("{\"op\":\"finalize\"}")) {
+        rapidjson::Document message;
+        if (!worker.receiveMessage(message, FINALIZE_TIMEOUT_MS)) {
+            SPDLOG_ERROR("Python worker {} (pid: {}) did not finalize handler: {}", worker.id, worker.pid, this->handlerPath);
+        }
+    }
+    if (worker.channel >= 0) {
+        ::close(worker.channel);
+        worker.channel = -1;
+    }
+    // Worker exits once channel is closed, it is killed if it does not
+    auto deadline = std::chrono::steady_clock::now() + (graceful ? EXIT_TIMEOUT : std::chrono::seconds(0));
+    while (worker.isRunning() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (worker.pid > 0) {
+        ::kill(worker.pid, SIGKILL);
+        ::waitpid(worker.pid, nullptr, 0);
+        worker.pid = -1;
+    }
+    worker.inputSegment.reset();
+}
+
+void PythonWorkerPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(this->restartMtx);
+        if (this->stopped) {
+            return;
+        }
+        this->stopped = true;
+    }
+    this->restartCv.notify_all();
+    if (this->restartThread.joinable()) {
+        this->restartThread.join();
+    }
+    for (auto& worker : this->workers) {
+        std::lock_guard<std::mutex> lock(worker->executionMtx);
+        this->stopWorker(*worker, true);
+    }
+    SPDLOG_DEBUG("Stopped python worker processes for handler: {}", this->handlerPath);
+}
+
+void PythonWorkerPool::scheduleRestart(size_t workerId) {
+    {
+        std::lock_guard<std::mutex> lock(this->restartMtx);
+        this->workersToRestart.push(workerId);
+    }
+    this->restartCv.notify_one();
+}
+
+void PythonWorkerPool::restartLoop() {
+    std::chrono::milliseconds backoff = MIN_RESTART_BACKOFF;
+    std::unique_lock<std::mutex> lock(this->restartMtx);
+    while (true) {
+        this->restartCv.wait(lock, [this]() { return this->stopped || !this->workersToRestart.empty(); });
+        if (this->stopped) {
+            return;
+        }
+        size_t workerId = this->workersToRestart.front();
+        this->workersToRestart.pop();
+        lock.unlock();
+        auto& worker = *this->workers[workerId];
+        this->stopWorker(worker, false);
+        SPDLOG_WARN("Restarting python worker {} for handler: {}", workerId, this->handlerPath);
+        auto status = this->startWorker(worker);
+        lock.lock();
+        if (status.ok()) {
+            this->restarts++;
+            backoff = MIN_RESTART_BACKOFF;
+            this->releaseWorker(workerId);
+            continue;
+        }
+        // Retry later so handler failing on every start does not keep the server busy
+        this->workersToRestart.push(workerId);
+        SPDLOG_ERROR("Failed to restart python worker {} for handler: {}; retrying in {} ms", workerId, this->handlerPath, backoff.count());
+        this->restartCv.wait_for(lock, backoff, [this]() { return this->stopped; });
+        backoff = std::min(backoff * 2, MAX_RESTART_BACKOFF);
+    }
+}
+
+std::vector<pid_t> PythonWorkerPool::getWorkerPids() const {
+    std::vector<pid_t> pids;
+    for (auto& worker : this->workers) {
+        pids.push_back(worker->pid);
+    }
+    return pids;
+}
+
+Status PythonWorkerPool::acquireWorker(size_t& workerId) {
+    std::unique_lock<std::mutex> lock(this->idleMtx);
+    auto deadline = std::chrono::steady_clock::now() + WORKER_AVAILABILITY_TIMEOUT;
+    while (this->idleWorkers.empty()) {
+        if (this->idleCv.wait_until(lock, deadline) == std::cv_status::no_timeout || !this->idleWorkers.empty()) {
+            continue;
+        }
+        // Busy workers are returned once execution finishes, dead ones only if restart succeeds
+        if (this->aliveWorkers.load() == 0) {
+            SPDLOG_ERROR("No python worker for handler: {} became available in {} ms", this->handlerPath, WORKER_AVAILABILITY_TIMEOUT.count());
+            return StatusCode::PYTHON_NODE_WORKER_UNAVAILABLE;
+        }
+        deadline = std::chrono::steady_clock::now() + WORKER_AVAILABILITY_TIMEOUT;
+    }
+    workerId = this->idleWorkers.front();
+    this->idleWorkers.pop_front();
+    return StatusCode::OK;
+}
+
+void PythonWorkerPool::releaseWorker(size_t workerId) {
+    {
+        std::lock_guard<std::mutex> lock(this->idleMtx);
+        this->idleWorkers.push_back(workerId);
+    }
+    this->idleCv.notify_one();
+}
+
+Status PythonWorkerPool::execute(const std::vector<PythonWorkerInput>& inputs, std::vector<PythonWorkerOutput>& outputs) {
+    // Each dead worker is acquired at most once until restarted, so the loop ends when acquisition times out
+    while (true) {
+        size_t workerId;
+        auto status = this->acquireWorker(workerId);
+        if (!status.ok()) {
+            return status;
+        }
+        auto& worker = *this->workers[workerId];
+        std::unique_lock<std::mutex> executionLock(worker.executionMtx);
+        if (!worker.isRunning()) {
+            SPDLOG_WARN("Python worker {} for handler: {} is not running", workerId, this->handlerPath);
+            this->stopWorker(worker, false);
+            executionLock.unlock();
+            this->scheduleRestart(workerId);
+            continue;
+        }
+        status = this->executeInWorker(worker, inputs, outputs);
+        executionLock.unlock();
+        if (worker.alive) {
+            this->releaseWorker(workerId);
+        } else {
+            this->scheduleRestart(workerId);
+        }
+        return status;
+    }
+}
+
+Status PythonWorkerPool::executeInWorker(PythonWorker& worker, const std::vector<PythonWorkerInput>& inputs, std::vector<PythonWorkerOutput>& outputs) {
+    size_t inputsSize = 0;
+    for (auto& input : inputs) {
+        inputsSize += alignUp(input.size);
+    }
+    if (inputsSize > 0) {
+        if (!worker.inputSegment) {
+            worker.inputSegment = SharedMemorySegment::create(this->segmentPrefix + "_" + std::to_string(worker.id) + "_in_" + std::to_string(worker.pid), std::max(inputsSize, MIN_INPUT_SEGMENT_SIZE));
+        }
+        if (!worker.inputSegment || !worker.inputSegment->reserve(inputsSize)) {
+            worker.inputSegment.reset();
+            return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+        }
+    }
+    const std::string outputSegmentName = this->segmentPrefix + "_out_" + std::to_string(this->outputSegmentCounter.fetch_add(1));
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("op");
+    writer.String("execute");
+    writer.Key("segment");
+    writer.String(inputsSize > 0 ? worker.inputSegment->getName().c_str() : "");
+    writer.Key("segment_size");
+    writer.Uint64(inputsSize > 0 ? worker.inputSegment->getSize() : 0);
+    writer.Key("output_segment");
+    writer.String(outputSegmentName.c_str());
+    writer.Key("inputs");
+    writer.StartArray();
+    size_t offset = 0;
+    for (auto& input : inputs) {
+        if (input.size > 0) {
+            std::memcpy(worker.inputSegment->data() + offset, input.data, input.size);
+        }
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(input.name.c_str());
+        writer.Key("datatype");
+        writer.String(input.datatype.c_str());
+        writer.Key("shape");
+        writeShape(writer, input.shape);
+        writer.Key("offset");
+        writer.Uint64(offset);
+        writer.Key("size");
+        writer.Uint64(input.size);
+        writer.EndObject();
+        offset += alignUp(input.size);
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    rapidjson::Document response;
+    bool timedOut = false;
+    const int timeoutMs = this->executeTimeout.count() > 0 ? static_cast<int>(this->executeTimeout.count()) : -1;
+    if (!worker.sendMessage(buffer.GetString()) || !worker.receiveMessage(response, timeoutMs, &timedOut)) {
+        if (timedOut) {
+            SPDLOG_ERROR("Python worker {} (pid: {}) for handler: {} did not finish execution in {} ms, killing it", worker.id, worker.pid, this->handlerPath, timeoutMs);
+        } else {
+            SPDLOG_ERROR("Lost connection with python worker {} (pid: {}) for handler: {}", worker.id, worker.pid, this->handlerPath);
+        }
+        this->stopWorker(worker, false);
+        ::shm_unlink(outputSegmentName.c_str());
+        return timedOut ? StatusCode::PYTHON_NODE_WORKER_EXECUTION_TIMEOUT : StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+    }
+    if (std::string(response["status"].GetString()) != "ok") {
+        SPDLOG_DEBUG("Python node execution failed in worker {} for handler: {} - {}", worker.id, this->handlerPath,
+            response.HasMember("message") && response["message"].IsString() ? response["message"].GetString() : "");
+        return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+    }
+
+    if (!response.HasMember("size") || !response["size"].IsUint64() || !response.HasMember("outputs") || !response["outputs"].IsArray()) {
+        SPDLOG_ERROR("Received malformed response from python worker {} (pid: {})", worker.id, worker.pid);
+        return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+    }
+    std::shared_ptr<SharedMemorySegment> outputSegment;
+    const size_t outputsSize = response["size"].GetUint64();
+    if (outputsSize > 0) {
+        if (!response.HasMember("segment") || !response["segment"].IsString()) {
+            SPDLOG_ERROR("Received malformed response from python worker {} (pid: {})", worker.id, worker.pid);
+            return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+        }
+        outputSegment = SharedMemorySegment::openAndUnlink(response["segment"].GetString(), outputsSize);
+        if (!outputSegment) {
+            return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+        }
+    }
+    for (auto& description : response["outputs"].GetArray()) {
+        PythonWorkerOutput output;
+        size_t outputOffset;
+        if (!parseOutputDescription(description, output, outputOffset)) {
+            SPDLOG_ERROR("Received malformed output description from python worker {} (pid: {})", worker.id, worker.pid);
+            outputs.clear();
+            return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+        }
+        if (output.size > 0 && (!outputSegment || outputOffset > outputsSize || output.size > outputsSize - outputOffset)) {
+            SPDLOG_ERROR("Python worker {} returned output: {} outside of shared memory segment", worker.id, output.name);
+            outputs.clear();
+            return StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED;
+        }
+        output.data = outputSegment ? outputSegment->data() + outputOffset : nullptr;
+        output.segment = outputSegment;
+        outputs.emplace_back(std::move(output));
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
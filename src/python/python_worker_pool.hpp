@@ -0,0 +1,164 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief POSIX shared memory segment mapped into the server process. Segment is unmapped on destruction.
+ */
+class SharedMemorySegment {
+public:
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+    ~SharedMemorySegment();
+
+    /**
+     * @brief Creates new segment with read-write mapping
+     */
+    static std::unique_ptr<SharedMemorySegment> create(const std::string& name, size_t size);
+    /**
+     * @brief Maps existing segment read-only and removes its name, so it is released once unmapped
+     */
+    static std::unique_ptr<SharedMemorySegment> openAndUnlink(const std::string& name, size_t size);
+
+    /**
+     * @brief Grows segment to at least requested size. Content is not preserved.
+     */
+    bool reserve(size_t size);
+
+    const std::string& getName() const { return this->name; }
+    char* data() const { return this->ptr; }
+    size_t getSize() const { return this->size; }
+
+private:
+    SharedMemorySegment(const std::string& name, char* ptr, size_t size, int fd, bool owner);
+
+    const std::string name;
+    char* ptr;
+    size_t size;
+    int fd;
+    bool owner;
+};
+
+struct PythonWorkerInput {
+    std::string name;
+    std::string datatype;
+    std::vector<int64_t> shape;
+    const void* data;
+    size_t size;
+};
+
+struct PythonWorkerOutput {
+    std::string name;
+    std::string datatype;
+    std::vector<int64_t> shape;
+    const void* data;
+    size_t size;
+    // Keeps data mapped as long as output is used
+    std::shared_ptr<SharedMemorySegment> segment;
+};
+
+struct PythonWorker;
+
+/**
+ * @brief Pool of Python processes executing single Python node handler outside of the server interpreter.
+ *
+ * Each worker is a separate interpreter loading handler and calling its initialize, execute and finalize methods,
+ * so executions in different workers do not contend for the server GIL. Control messages are passed through a socketpair per worker,
+ * while tensor data is passed through shared memory segments. Dead workers are detected on acquisition and
+ * when communication fails, then restarted in the background. Workers exceeding execute timeout are killed and restarted.
+ */
+class PythonWorkerPool {
+public:
+    static constexpr std::chrono::milliseconds MAX_RESTART_BACKOFF{30000};
+    // Time execute waits for a worker while none of them is alive
+    static constexpr std::chrono::milliseconds WORKER_AVAILABILITY_TIMEOUT{10000};
+
+    /**
+     * @param initializeArguments JSON object passed to handler initialize method
+     * @param executeTimeout maximum duration of single handler execute call, 0 for no limit
+     */
+    PythonWorkerPool(const std::string& handlerPath, const std::string& initializeArguments, size_t workersCount, const std::string& pythonExecutable, std::chrono::milliseconds executeTimeout = std::chrono::milliseconds(0));
+    ~PythonWorkerPool();
+    PythonWorkerPool(const PythonWorkerPool&) = delete;
+    PythonWorkerPool& operator=(const PythonWorkerPool&) = delete;
+
+    /**
+     * @brief Starts all workers and waits until handler is initialized in each of them
+     */
+    Status start();
+    /**
+     * @brief Waits for executions in progress, then calls handler finalize in all workers and waits for them to exit
+     */
+    void shutdown();
+
+    /**
+     * @brief Executes handler in first idle worker. Blocks while all workers are busy.
+     * Fails if no worker becomes available within WORKER_AVAILABILITY_TIMEOUT while none of them is alive.
+     */
+    Status execute(const std::vector<PythonWorkerInput>& inputs, std::vector<PythonWorkerOutput>& outputs);
+
+    size_t getWorkersCount() const { return this->workers.size(); }
+    size_t getAliveWorkersCount() const { return this->aliveWorkers.load(); }
+    size_t getRestartsCount() const { return this->restarts.load(); }
+    std::vector<pid_t> getWorkerPids() const;
+
+private:
+    Status acquireWorker(size_t& workerId);
+    void releaseWorker(size_t workerId);
+    Status startWorker(PythonWorker& worker);
+    void stopWorker(PythonWorker& worker, bool graceful);
+    void scheduleRestart(size_t workerId);
+    void restartLoop();
+    Status executeInWorker(PythonWorker& worker, const std::vector<PythonWorkerInput>& inputs, std::vector<PythonWorkerOutput>& outputs);
+
+    const std::string handlerPath;
+    const std::string initializeArguments;
+    const std::string pythonExecutable;
+    const std::string segmentPrefix;
+    const std::chrono::milliseconds executeTimeout;
+
+    std::vector<std::unique_ptr<PythonWorker>> workers;
+    std::mutex idleMtx;
+    std::condition_variable idleCv;
+    std::deque<size_t> idleWorkers;
+    std::atomic<size_t> aliveWorkers{0};
+    std::atomic<size_t> restarts{0};
+    std::atomic<uint64_t> outputSegmentCounter{0};
+
+    std::mutex restartMtx;
+    std::condition_variable restartCv;
+    std::queue<size_t> workersToRestart;
+    bool stopped = false;
+    std::thread restartThread;
+};
+}  // namespace ovms
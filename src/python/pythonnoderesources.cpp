@@ -15,15 +15,19 @@
 //*****************************************************************************
 #include "pythonnoderesources.hpp"
 
+#include <chrono>
 #include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <spdlog/spdlog.h>
 
 #include "../logging.hpp"
 #include "../status.hpp"
+#include "python_worker_pool.hpp"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -43,6 +47,10 @@ PythonNodeResources::PythonNodeResources(PythonBackend* pythonBackend) {
 }
 
 void PythonNodeResources::finalize() {
+    if (this->workerPool) {
+        // Workers call finalize of their handler instances
+        this->workerPool->shutdown();
+    }
     if (this->ovmsPythonModel) {
         py::gil_scoped_acquire acquire;
         try {
@@ -85,6 +93,43 @@ py::dict PythonNodeResources::preparePythonNodeInitializeArguments(const ::media
     return kwargsParam;
 }
 
+std::string PythonNodeResources::serializePythonNodeInitializeArguments(const ::mediapipe::CalculatorGraphConfig::Node& graphNodeConfig) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("input_names");
+    writer.StartArray();
+    for (auto& name : graphNodeConfig.input_stream()) {
+        writer.String(getStreamName(name).c_str());
+    }
+    writer.EndArray();
+    writer.Key("output_names");
+    writer.StartArray();
+    for (auto& name : graphNodeConfig.output_stream()) {
+        writer.String(getStreamName(name).c_str());
+    }
+    writer.EndArray();
+    writer.Key("node_name");
+    writer.String(graphNodeConfig.name().c_str());
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+Status PythonNodeResources::createWorkerPool(std::shared_ptr<PythonNodeResources>& nodeResources, const ::mediapipe::CalculatorGraphConfig::Node& graphNodeConfig, uint32_t workersCount, const std::string& pythonExecutable, uint32_t executeTimeoutMs) {
+    for (auto& name : graphNodeConfig.input_stream()) {
+        if (name.rfind("LOOPBACK:", 0) == 0) {
+            SPDLOG_ERROR("Python node: {} with LOOPBACK cannot be executed in worker processes. Python node handler_path: {}", graphNodeConfig.name(), nodeResources->handlerPath);
+            return StatusCode::PYTHON_NODE_FILE_STATE_INITIALIZATION_FAILED;
+        }
+    }
+    nodeResources->workerPool = std::make_unique<PythonWorkerPool>(nodeResources->handlerPath, serializePythonNodeInitializeArguments(graphNodeConfig), workersCount, pythonExecutable, std::chrono::milliseconds(executeTimeoutMs));
+    auto status = nodeResources->workerPool->start();
+    if (!status.ok()) {
+        nodeResources->workerPool.reset();
+    }
+    return status;
+}
+
 void createOutputTagNameMapping(std::shared_ptr<PythonNodeResources>& nodeResources, const ::mediapipe::CalculatorGraphConfig::Node& graphNodeConfig) {
     for (auto& name : graphNodeConfig.output_stream()) {
         std::string delimiter = ":";
@@ -124,6 +169,10 @@ Status PythonNodeResources::createPythonNodeResources(std::shared_ptr<PythonNode
     nodeResources->handlerPath = nodeOptions.handler_path();
     createOutputTagNameMapping(nodeResources, graphNodeConfig);
 
+    if (nodeOptions.worker_processes() > 0) {
+        return createWorkerPool(nodeResources, graphNodeConfig, nodeOptions.worker_processes(), nodeOptions.python_executable(), nodeOptions.worker_execute_timeout_ms());
+    }
+
     auto fsHandlerPath = std::filesystem::path(nodeOptions.handler_path());
     fsHandlerPath.replace_extension();
 
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -31,6 +32,7 @@ namespace py = pybind11;
 namespace ovms {
 class Status;
 class PythonBackend;
+class PythonWorkerPool;
 
 struct PythonNodeResources {
 public:
@@ -38,6 +40,8 @@ public:
     PythonNodeResources& operator=(PythonNodeResources&) = delete;
 
     std::unique_ptr<py::object> ovmsPythonModel;
+    // Set instead of ovmsPythonModel when node is executed in worker processes
+    std::unique_ptr<PythonWorkerPool> workerPool;
     PythonBackend* pythonBackend;
     std::string handlerPath;
     std::unordered_map<std::string, std::string> outputsNameTagMapping;
@@ -49,6 +53,8 @@ public:
 
 private:
     static py::dict preparePythonNodeInitializeArguments(const ::mediapipe::CalculatorGraphConfig::Node& graphNodeConfig);
+    static std::string serializePythonNodeInitializeArguments(const ::mediapipe::CalculatorGraphConfig::Node& graphNodeConfig);
+    static Status createWorkerPool(std::shared_ptr<PythonNodeResources>& nodeResources, const ::mediapipe::CalculatorGraphConfig::Node& graphNodeConfig, uint32_t workersCount, const std::string& pythonExecutable, uint32_t executeTimeoutMs);
 };
 using PythonNodeResourcesMap = std::unordered_map<std::string, std::shared_ptr<PythonNodeResources>>;
 }  // namespace ovms
@@ -49,6 +49,7 @@ public:
             value = streams[front_idx];
             streams[front_idx] = -1;  // negative value indicate consumed vector index
             front_idx = (front_idx + 1) % streams.size();
+            streamsInUse.fetch_add(1, std::memory_order_relaxed);
             lk.unlock();
             idleStreamPromise.set_value(value);
         }
@@ -65,6 +66,7 @@ public:
             value = streams[front_idx];
             streams[front_idx] = -1;  // negative value indicate consumed vector index
             front_idx = (front_idx + 1) % streams.size();
+            streamsInUse.fetch_add(1, std::memory_order_relaxed);
             lk.unlock();
             return value;
         }
@@ -80,9 +82,11 @@ public:
             std::promise<int> promise = std::move(promises.front());
             promises.pop();
             lk.unlock();
+            // stream is handed over to waiting request so number of streams in use does not change
             promise.set_value(streamID);
             return;
         }
+        streamsInUse.fetch_sub(1, std::memory_order_relaxed);
         std::uint32_t old_back = back_idx.load();
         while (!back_idx.compare_exchange_weak(
             old_back,
@@ -111,6 +115,20 @@ public:
         return inferRequests[streamID];
     }
 
+    /**
+     * @brief Number of InferRequests in queue
+     */
+    size_t getSize() const {
+        return inferRequests.size();
+    }
+
+    /**
+     * @brief Number of streams currently acquired and not returned yet
+     */
+    size_t getStreamsInUse() const {
+        return streamsInUse.load(std::memory_order_relaxed);
+    }
+
 protected:
     /**
     * @brief Vector representing circular buffer for infer queue
@@ -127,6 +145,11 @@ protected:
     */
     std::atomic<std::uint32_t> back_idx;
 
+    /**
+    * @brief Number of streams consumed from the idle streams list
+    */
+    std::atomic<size_t> streamsInUse{0};
+
     /**
     * @brief Vector representing OV streams and used for notification about completed inference operations
     */
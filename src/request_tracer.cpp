@@ -0,0 +1,254 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "request_tracer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+const std::string RequestTracer::TRACE_HEADER = "ovms-trace";
+
+std::atomic<RequestTracer*> RequestTracer::active{nullptr};
+
+namespace {
+// Buffers outlive threads which created them until exporter drains remaining spans
+std::mutex buffersMtx;
+std::vector<std::shared_ptr<TraceRingBuffer>> buffers;
+std::atomic<uint64_t> threadIdCounter{0};
+
+struct ThreadBufferHolder {
+    std::shared_ptr<TraceRingBuffer> buffer;
+    ~ThreadBufferHolder() {
+        if (buffer) {
+            buffer->markOwnerExited();
+        }
+    }
+};
+
+thread_local uint64_t currentTraceId = 0;
+thread_local ThreadBufferHolder threadBuffer;
+
+TraceRingBuffer& getThreadBuffer() {
+    if (!threadBuffer.buffer) {
+        threadBuffer.buffer = std::make_shared<TraceRingBuffer>(threadIdCounter.fetch_add(1, std::memory_order_relaxed) + 1);
+        std::lock_guard<std::mutex> lock(buffersMtx);
+        buffers.emplace_back(threadBuffer.buffer);
+    }
+    return *threadBuffer.buffer;
+}
+
+void writeEscaped(std::ostream& os, const char* str) {
+    for (; *str; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[7];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            os << escaped;
+        } else {
+            os << c;
+        }
+    }
+}
+}  // namespace
+
+bool TraceRingBuffer::push(uint64_t traceId, const char* name, size_t nameLength, uint64_t startNs, uint64_t durationNs) {
+    const uint64_t currentHead = this->head.load(std::memory_order_relaxed);
+    if (currentHead - this->tail.load(std::memory_order_acquire) >= CAPACITY) {
+        this->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    TraceSpanRecord& record = this->records[currentHead % CAPACITY];
+    record.traceId = traceId;
+    record.startNs = startNs;
+    record.durationNs = durationNs;
+    const size_t length = std::min(nameLength, TraceSpanRecord::MAX_NAME_LENGTH);
+    std::memcpy(record.name, name, length);
+    record.name[length] = '\0';
+    this->head.store(currentHead + 1, std::memory_order_release);
+    return true;
+}
+
+RequestTracer::RequestTracer(uint32_t sampleRate, const std::string& exportPath, std::chrono::milliseconds flushInterval) :
+    sampleRate(sampleRate),
+    exportPath(exportPath),
+    flushInterval(flushInterval) {}
+
+RequestTracer::~RequestTracer() {
+    this->stop();
+}
+
+bool RequestTracer::start() {
+    {
+        std::lock_guard<std::mutex> lock(this->exportMtx);
+        this->exportFile.open(this->exportPath, std::ios::out | std::ios::trunc);
+        if (!this->exportFile.is_open()) {
+            SPDLOG_ERROR("Cannot open trace export file: {}", this->exportPath);
+            return false;
+        }
+        // Chrome trace array format does not require closing bracket so events can be appended until shutdown
+        this->exportFile << "[\n";
+    }
+    this->exporter = std::thread([this]() {
+        std::unique_lock<std::mutex> lock(this->exporterMtx);
+        while (!this->exporterCv.wait_for(lock, this->flushInterval, [this]() { return this->exporterStopped; })) {
+            lock.unlock();
+            this->flush();
+            lock.lock();
+        }
+    });
+    RequestTracer* expected = nullptr;
+    if (!active.compare_exchange_strong(expected, this)) {
+        SPDLOG_WARN("Other request tracer is already active, spans will be exported by the previous one");
+    }
+    SPDLOG_INFO("Request tracing started; sample rate: {}; export path: {}", this->sampleRate, this->exportPath);
+    return true;
+}
+
+void RequestTracer::stop() {
+    RequestTracer* expected = this;
+    active.compare_exchange_strong(expected, nullptr);
+    if (this->exporter.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(this->exporterMtx);
+            this->exporterStopped = true;
+        }
+        this->exporterCv.notify_one();
+        this->exporter.join();
+    }
+    this->flush();
+    std::lock_guard<std::mutex> lock(this->exportMtx);
+    if (this->exportFile.is_open()) {
+        this->exportFile.close();
+    }
+}
+
+bool RequestTracer::shouldSample(bool forced) {
+    if (forced) {
+        return true;
+    }
+    if (this->sampleRate == 0) {
+        return false;
+    }
+    return this->requestCounter.fetch_add(1, std::memory_order_relaxed) % this->sampleRate == 0;
+}
+
+void RequestTracer::flush() {
+    std::vector<std::shared_ptr<TraceRingBuffer>> toDrain;
+    {
+        std::lock_guard<std::mutex> lock(buffersMtx);
+        toDrain = buffers;
+    }
+    std::lock_guard<std::mutex> lock(this->exportMtx);
+    if (!this->exportFile.is_open()) {
+        return;
+    }
+    const auto pid = getpid();
+    std::ostringstream events;
+    uint64_t dropped = 0;
+    for (auto& buffer : toDrain) {
+        const uint64_t tid = buffer->getThreadId();
+        buffer->drain([&events, pid, tid](const TraceSpanRecord& record) {
+            events << "{\"name\":\"";
+            writeEscaped(events, record.name);
+            events << "\",\"cat\":\"ovms\",\"ph\":\"X\",\"ts\":" << record.startNs / 1000 << "." << record.startNs % 1000 / 100
+                   << ",\"dur\":" << record.durationNs / 1000 << "." << record.durationNs % 1000 / 100
+                   << ",\"pid\":" << pid << ",\"tid\":" << tid
+                   << ",\"args\":{\"trace_id\":\"" << std::hex << record.traceId << std::dec << "\"}},\n";
+        });
+        dropped += buffer->takeDroppedCount();
+    }
+    this->exportFile << events.str();
+    this->exportFile.flush();
+    if (dropped > 0) {
+        SPDLOG_WARN("Request tracer dropped {} spans since trace buffers were full", dropped);
+    }
+    // Release buffers of finished threads once all their spans are exported
+    std::lock_guard<std::mutex> buffersLock(buffersMtx);
+    for (auto it = buffers.begin(); it != buffers.end();) {
+        if ((*it)->hasOwnerExited() && (*it)->empty()) {
+            it = buffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool RequestTracer::isTracing() {
+    return currentTraceId != 0;
+}
+
+uint64_t RequestTracer::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RequestTracer::recordSpan(const std::string& name, uint64_t startNs, uint64_t endNs) {
+    recordSpan(name.c_str(), name.size(), startNs, endNs);
+}
+
+void RequestTracer::recordSpan(const char* name, size_t nameLength, uint64_t startNs, uint64_t endNs) {
+    if (currentTraceId == 0) {
+        return;
+    }
+    getThreadBuffer().push(currentTraceId, name, nameLength, startNs, endNs > startNs ? endNs - startNs : 0);
+}
+
+TraceSpan::TraceSpan(const char* name) :
+    name(name),
+    recording(currentTraceId != 0) {
+    if (this->recording) {
+        this->startNs = RequestTracer::nowNs();
+    }
+}
+
+void TraceSpan::end() {
+    if (!this->recording) {
+        return;
+    }
+    this->recording = false;
+    RequestTracer::recordSpan(this->name, std::strlen(this->name), this->startNs, RequestTracer::nowNs());
+}
+
+RequestTraceScope::RequestTraceScope(const char* name, bool forced) {
+    if (currentTraceId == 0) {
+        RequestTracer* tracer = RequestTracer::getActive();
+        if (!tracer || !tracer->shouldSample(forced)) {
+            return;
+        }
+        currentTraceId = tracer->nextTraceId();
+        this->owner = true;
+    }
+    this->span.emplace(name);
+}
+
+RequestTraceScope::~RequestTraceScope() {
+    this->span.reset();
+    if (this->owner) {
+        currentTraceId = 0;
+    }
+}
+
+}  // namespace ovms
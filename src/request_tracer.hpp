@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#define OVMS_TRACE_CONCAT_IMPL(a, b) a##b
+#define OVMS_TRACE_CONCAT(a, b) OVMS_TRACE_CONCAT_IMPL(a, b)
+#define OVMS_TRACE_SPAN(name) ovms::TraceSpan OVMS_TRACE_CONCAT(traceSpan, __LINE__)(name);
+
+namespace ovms {
+
+struct TraceSpanRecord {
+    static constexpr size_t MAX_NAME_LENGTH = 63;
+    uint64_t traceId;
+    uint64_t startNs;
+    uint64_t durationNs;
+    char name[MAX_NAME_LENGTH + 1];
+};
+
+/**
+ * @brief Fixed size ring of finished spans with single producer and single consumer.
+ * Owning thread pushes without locking, exporter thread drains it. When ring is full new spans are dropped.
+ */
+class TraceRingBuffer {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+    TraceRingBuffer(uint64_t threadId) :
+        threadId(threadId) {}
+
+    bool push(uint64_t traceId, const char* name, size_t nameLength, uint64_t startNs, uint64_t durationNs);
+
+    template <typename F>
+    size_t drain(F&& consume) {
+        uint64_t currentTail = this->tail.load(std::memory_order_relaxed);
+        const uint64_t currentHead = this->head.load(std::memory_order_acquire);
+        size_t drained = 0;
+        for (; currentTail < currentHead; ++currentTail, ++drained) {
+            consume(this->records[currentTail % CAPACITY]);
+        }
+        this->tail.store(currentTail, std::memory_order_release);
+        return drained;
+    }
+
+    bool empty() const { return this->tail.load(std::memory_order_acquire) == this->head.load(std::memory_order_acquire); }
+    uint64_t takeDroppedCount() { return this->dropped.exchange(0, std::memory_order_relaxed); }
+    uint64_t getThreadId() const { return this->threadId; }
+    void markOwnerExited() { this->ownerExited.store(true, std::memory_order_release); }
+    bool hasOwnerExited() const { return this->ownerExited.load(std::memory_order_acquire); }
+
+private:
+    std::array<TraceSpanRecord, CAPACITY> records;
+    alignas(64) std::atomic<uint64_t> head{0};
+    alignas(64) std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> ownerExited{false};
+    const uint64_t threadId;
+};
+
+/**
+ * @brief Samples requests for tracing and periodically exports their spans to a file in Chrome trace format.
+ *
+ * Only one tracer is active at a time. Spans are recorded only on threads processing sampled request,
+ * so requests which are not sampled pay for single thread local check.
+ */
+class RequestTracer {
+public:
+    static const std::string TRACE_HEADER;
+
+    RequestTracer(uint32_t sampleRate, const std::string& exportPath, std::chrono::milliseconds flushInterval = std::chrono::milliseconds(1000));
+    ~RequestTracer();
+    RequestTracer(const RequestTracer&) = delete;
+    RequestTracer& operator=(const RequestTracer&) = delete;
+
+    /**
+     * @brief Opens export file, starts exporter thread and makes the tracer active
+     *
+     * @return false if export file cannot be opened
+     */
+    bool start();
+    void stop();
+
+    /**
+     * @brief Decides if request is traced, every sampleRate-th request is traced
+     *
+     * @param forced request explicitly asked for tracing
+     */
+    bool shouldSample(bool forced);
+    uint64_t nextTraceId() { return this->traceIdCounter.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    /**
+     * @brief Writes spans from all thread buffers into export file
+     */
+    void flush();
+
+    static RequestTracer* getActive() { return active.load(std::memory_order_acquire); }
+    static bool isTracing();
+    static uint64_t nowNs();
+    static void recordSpan(const std::string& name, uint64_t startNs, uint64_t endNs);
+    static void recordSpan(const char* name, size_t nameLength, uint64_t startNs, uint64_t endNs);
+
+private:
+    static std::atomic<RequestTracer*> active;
+
+    const uint32_t sampleRate;
+    const std::string exportPath;
+    const std::chrono::milliseconds flushInterval;
+
+    std::atomic<uint64_t> requestCounter{0};
+    std::atomic<uint64_t> traceIdCounter{0};
+
+    std::mutex exportMtx;
+    std::ofstream exportFile;
+
+    std::mutex exporterMtx;
+    std::condition_variable exporterCv;
+    bool exporterStopped = false;
+    std::thread exporter;
+};
+
+/**
+ * @brief Span measuring lifetime of the object, recorded only if current thread processes sampled request
+ */
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name);
+    ~TraceSpan() { end(); }
+    void end();
+
+private:
+    const char* name;
+    uint64_t startNs = 0;
+    bool recording;
+};
+
+/**
+ * @brief Root span of the request created by the frontend. Decides about sampling and sets trace of current thread.
+ * When thread already processes traced request it behaves like a regular span.
+ */
+class RequestTraceScope {
+public:
+    RequestTraceScope(const char* name, bool forced);
+    ~RequestTraceScope();
+
+private:
+    bool owner = false;
+    std::optional<TraceSpan> span;
+};
+
+}  // namespace ovms
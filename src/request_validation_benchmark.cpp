@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Measures KFS request validation with many inputs. Compares deriving validation metadata from inputs info
+// for every request, as done before validation plan was cached, with validation against plan built once per load.
+// Usage: request_validation_benchmark [inputs count] [iterations]
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "modelversion.hpp"
+#include "predict_request_validation_utils.hpp"
+#include "shape.hpp"
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace {
+
+constexpr size_t ELEMENTS_PER_INPUT = 10;
+
+// Returns average microseconds per validation
+double measure(int iterations, const std::function<ovms::Status()>& validate) {
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        auto status = validate();
+        if (!status.ok()) {
+            std::cerr << "validation failed: " << status.string() << std::endl;
+            return -1;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - begin).count() / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int inputsCount = argc > 1 ? std::atoi(argv[1]) : 20;
+    const int iterations = argc > 2 ? std::atoi(argv[2]) : 100000;
+    const std::string servableName = "benchmark";
+    const ovms::model_version_t servableVersion = 1;
+
+    ovms::tensor_map_t inputsInfo;
+    KFSRequest request;
+    request.set_model_name(servableName);
+    const std::string content(ELEMENTS_PER_INPUT * sizeof(float), '\0');
+    for (int i = 0; i < inputsCount; i++) {
+        const std::string name = "input_" + std::to_string(i);
+        inputsInfo.emplace(name, std::make_shared<ovms::TensorInfo>(name, ovms::Precision::FP32, ovms::shape_t{1, ELEMENTS_PER_INPUT}));
+        auto* input = request.add_inputs();
+        input->set_name(name);
+        input->set_datatype("FP32");
+        input->add_shape(1);
+        input->add_shape(ELEMENTS_PER_INPUT);
+        request.add_raw_input_contents()->assign(content);
+    }
+    const ovms::request_validation_utils::ValidationPlan plan(inputsInfo, ovms::shapes_info_map_t());
+
+    double perRequestUs = measure(iterations, [&]() {
+        return ovms::request_validation_utils::validate(request, inputsInfo, servableName, servableVersion);
+    });
+    double cachedPlanUs = measure(iterations, [&]() {
+        return ovms::request_validation_utils::validate(request, plan, servableName, servableVersion);
+    });
+    std::cout << "inputs: " << inputsCount << "; iterations: " << iterations << std::endl;
+    std::cout << std::setw(28) << "per request plan [us]" << std::setw(28) << "cached plan [us]" << std::endl;
+    std::cout << std::setw(28) << std::fixed << std::setprecision(3) << perRequestUs
+              << std::setw(28) << cachedPlanUs << std::endl;
+    return 0;
+}
@@ -29,6 +29,7 @@
 #include <fstream>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -546,6 +547,40 @@ StatusCode S3FileSystem::downloadModelVersions(const std::string& path,
     return result;
 }
 
+StatusCode S3FileSystem::getDirectoryFingerprint(const std::string& path, std::string* fingerprint) {
+    std::string bucket, dir_path;
+    auto status = parsePath(path, &bucket, &dir_path);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+
+    s3::Model::ListObjectsRequest objects_request;
+    objects_request.SetBucket(bucket.c_str());
+    objects_request.SetPrefix(appendSlash(dir_path).c_str());
+
+    // S3 returns keys in lexicographical order so fingerprint is stable
+    std::stringstream ss;
+    // Single response is limited to 1000 keys, follow markers until listing is complete
+    while (true) {
+        auto list_objects_outcome = client_.ListObjects(objects_request);
+        if (!list_objects_outcome.IsSuccess()) {
+            SPDLOG_LOGGER_ERROR(s3_logger, "Could not list contents of directory {}", path);
+            return StatusCode::S3_INVALID_ACCESS;
+        }
+        const auto& result = list_objects_outcome.GetResult();
+        for (auto const& s3_object : result.GetContents()) {
+            ss << s3_object.GetKey().c_str() << ":" << s3_object.GetETag().c_str() << ":" << s3_object.GetSize() << ";";
+        }
+        if (!result.GetIsTruncated() || result.GetContents().empty()) {
+            break;
+        }
+        // NextMarker is returned only for delimited listings, otherwise last key is the marker
+        objects_request.SetMarker(result.GetNextMarker().empty() ? result.GetContents().back().GetKey() : result.GetNextMarker());
+    }
+    *fingerprint = ss.str();
+    return StatusCode::OK;
+}
+
 StatusCode S3FileSystem::deleteFileFolder(const std::string& path) {
     SPDLOG_LOGGER_DEBUG(s3_logger, "Deleting local file folder {}", path);
     if (::remove(path.c_str()) == 0) {
@@ -116,6 +116,15 @@ public:
      */
     StatusCode downloadModelVersions(const std::string& path, std::string* local_path, const std::vector<model_version_t>& versions) override;
 
+    /**
+     * @brief Get a fingerprint of a remote directory content
+     * 
+     * @param path 
+     * @param fingerprint 
+     * @return StatusCode 
+     */
+    StatusCode getDirectoryFingerprint(const std::string& path, std::string* fingerprint) override;
+
     /**
      * @brief Delete a folder
      * 
@@ -118,6 +118,9 @@ const std::string DAG_DEFINITIONS = R"(
 				},
 				"gather_from_node": {
 					"type": "string"
+				},
+				"batch_shards": {
+					"type": "boolean"
 				}
 			},
 			"additionalProperties": false
@@ -209,6 +212,73 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 				"allow_cache": {
 					"type": "boolean"
 				},
+				"shape_cache_size": {
+					"type": "integer",
+					"minimum": 0,
+					"maximum": 100
+				},
+				"accepted_precisions": {
+					"type": "object",
+					"additionalProperties": {
+						"type": "object",
+						"required": ["precisions"],
+						"properties": {
+							"precisions": {
+								"type": "array",
+								"items": {
+									"type": "string"
+								}
+							},
+							"scale": {
+								"type": "number"
+							}
+						},
+						"additionalProperties": false
+					}
+				},
+				"image_preprocessing": {
+					"type": "object",
+					"additionalProperties": {
+						"type": "object",
+						"properties": {
+							"mean": {
+								"type": ["number", "array"],
+								"items": {
+									"type": "number"
+								}
+							},
+							"scale": {
+								"type": ["number", "array"],
+								"items": {
+									"type": "number"
+								}
+							},
+							"color_order": {
+								"type": "string",
+								"enum": ["BGR", "RGB"]
+							},
+							"resize": {
+								"type": "string",
+								"enum": ["nearest", "linear", "cubic", "area"]
+							}
+						},
+						"additionalProperties": false
+					}
+				},
+				"warmup": {
+					"type": "object",
+					"properties": {
+						"iterations": {
+							"type": "integer",
+							"minimum": 0,
+							"maximum": 1000
+						},
+						"requests_path": {
+							"type": "string"
+						}
+					},
+					"additionalProperties": false
+				},
 				"plugin_config": {
 					"type": "object",
 		"additionalProperties": {"anyOf": [
@@ -226,6 +296,9 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 				"low_latency_transformation": {
 					"type": "boolean"
 				},
+				"continuous_batching": {
+					"type": "boolean"
+				},
 				"max_sequence_number": {
 					"type": "integer",
 					"minimum": 0
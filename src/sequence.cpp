@@ -53,6 +53,11 @@ Status Sequence::updateMemoryState(model_memory_state_t& newState) {
     return StatusCode::OK;
 }
 
+void Sequence::updateMemoryState(sequence_memory_state_t&& newState) {
+    memoryState = std::move(newState);
+    setIdle(false);
+}
+
 std::mutex& Sequence::getMutex() {
     return mutex;
 }
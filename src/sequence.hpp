@@ -51,6 +51,8 @@ public:
     void setIdle(bool idle = true);
     // In case updateMemoryState returns non-OK status code the sequence should be dropped
     Status updateMemoryState(model_memory_state_t& newState);
+    // Takes ownership of already copied state tensors
+    void updateMemoryState(sequence_memory_state_t&& newState);
     std::mutex& getMutex();
     bool isTerminated() const;
     void setTerminated();
@@ -51,6 +51,7 @@
 #include "profilermodule.hpp"
 #include "servablemanagermodule.hpp"
 #include "stringutils.hpp"
+#include "tracingmodule.hpp"
 #include "version.hpp"
 
 #if (PYTHON_DISABLE == 0)
@@ -205,6 +206,8 @@ std::unique_ptr<Module> Server::createModule(const std::string& name) {
 #endif
     if (name == METRICS_MODULE_NAME)
         return std::make_unique<MetricModule>();
+    if (name == TRACING_MODULE_NAME)
+        return std::make_unique<TracingModule>();
     return nullptr;
 }
 
@@ -255,6 +258,10 @@ Status Server::startModules(ovms::Config& config) {
     INSERT_MODULE(PROFILER_MODULE_NAME, it);
     START_MODULE(it);
 #endif
+    if (!config.traceExportPath().empty()) {
+        INSERT_MODULE(TRACING_MODULE_NAME, it);
+        START_MODULE(it);
+    }
     // It is required to have the metrics module, it is used by ServableManagerModule.
     INSERT_MODULE(METRICS_MODULE_NAME, it);
     START_MODULE(it);
@@ -306,6 +313,7 @@ void Server::shutdownModules() {
     ensureModuleShutdown(HTTP_SERVER_MODULE_NAME);
     ensureModuleShutdown(SERVABLE_MANAGER_MODULE_NAME);
     ensureModuleShutdown(PROFILER_MODULE_NAME);
+    ensureModuleShutdown(TRACING_MODULE_NAME);
 #if (PYTHON_DISABLE == 0)
     if (ovms::Config::instance().getServerSettings().withPython) {
         ensureModuleShutdown(PYTHON_INTERPRETER_MODULE_NAME);
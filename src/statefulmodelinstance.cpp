@@ -116,12 +116,14 @@ void StatefulModelInstance::retireModel(bool isPermanent) {
         globalSequencesViewer->unregisterFromCleanup(getName(), getVersion());
     }
     ModelInstance::retireModel(isPermanent);
+    continuousBatchingScheduler.reset();
     sequenceManager.reset();
 }
 
 void StatefulModelInstance::cleanupFailedLoad() {
     std::lock_guard<std::recursive_mutex> loadingLock(loadingMutex);
     ModelInstance::cleanupFailedLoad();
+    continuousBatchingScheduler.reset();
     sequenceManager.reset();
 }
 
@@ -144,7 +146,21 @@ Status StatefulModelInstance::loadOVCompiledModel(const ModelConfig& config) {
             return StatusCode::INTERNAL_ERROR;
         }
     }
-    return ModelInstance::loadOVCompiledModel(config);
+    continuousBatchingScheduler.reset();
+    auto status = ModelInstance::loadOVCompiledModel(config);
+    if (!status.ok() || !config.isContinuousBatchingUsed())
+        return status;
+    status = ContinuousBatchingScheduler::validateModel(getName(), getVersion(), *compiledModel);
+    if (!status.ok())
+        return status;
+    try {
+        continuousBatchingScheduler = std::make_shared<ContinuousBatchingScheduler>(getName(), getVersion(), *compiledModel);
+    } catch (ov::Exception& ex) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Error: {}; occurred during continuous batching scheduler creation for model: {} version: {}", ex.what(), getName(), getVersion());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "[Model: {} version: {}] Continuous batching enabled", getName(), getVersion());
+    return StatusCode::OK;
 }
 
 template <>
@@ -182,8 +198,9 @@ const std::set<std::string>& StatefulModelInstance::getOptionalInputNames() {
     return SPECIAL_INPUT_NAMES;
 }
 template <>
-StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>::StatefulRequestProcessor(SequenceManager& sequenceManager) :
-    sequenceManager(sequenceManager) {
+StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>::StatefulRequestProcessor(SequenceManager& sequenceManager, std::shared_ptr<ContinuousBatchingScheduler> continuousBatchingScheduler) :
+    sequenceManager(sequenceManager),
+    continuousBatchingScheduler(std::move(continuousBatchingScheduler)) {
 }
 template <>
 Status StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>::extractRequestParameters(const tensorflow::serving::PredictRequest* request) {
@@ -208,6 +225,9 @@ Status StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow:
 }
 template <>
 Status StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>::preInferenceProcessing(ov::InferRequest& inferRequest) {
+    // Scheduler sets memory state of the whole batch
+    if (continuousBatchingScheduler)
+        return StatusCode::OK;
     if (sequenceProcessingSpec.getSequenceControlInput() == SEQUENCE_START) {
         // On SEQUENCE_START reset memory state of infer request to default
         for (auto&& state : inferRequest.query_state()) {
@@ -226,20 +246,35 @@ Status StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow:
     return StatusCode::OK;
 }
 template <>
+Status StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>::performInference(ModelInstance& modelInstance, ov::InferRequest& inferRequest) {
+    if (!continuousBatchingScheduler)
+        return modelInstance.performInference(inferRequest);
+    if (!sequence) {
+        SPDLOG_DEBUG("sequence is not set");
+        return StatusCode::INTERNAL_ERROR;
+    }
+    return continuousBatchingScheduler->schedule(inferRequest, *sequence,
+        sequenceProcessingSpec.getSequenceControlInput() == SEQUENCE_START,
+        sequenceProcessingSpec.getSequenceControlInput() == SEQUENCE_END);
+}
+template <>
 Status StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>::postInferenceProcessing(tensorflow::serving::PredictResponse* response, ov::InferRequest& inferRequest) {
-    // Reset inferRequest states on SEQUENCE_END
-    if (sequenceProcessingSpec.getSequenceControlInput() == SEQUENCE_END) {
-        SPDLOG_DEBUG("Received SEQUENCE_END signal. Reseting model state");
-        for (auto&& state : inferRequest.query_state()) {
-            state.reset();
-        }
-    } else {
-        auto modelState = inferRequest.query_state();
-        if (!sequence) {
-            SPDLOG_DEBUG("sequence is not set");
-            return StatusCode::INTERNAL_ERROR;
+    // In continuous batching mode sequence memory state was already updated by the scheduler
+    if (!continuousBatchingScheduler) {
+        // Reset inferRequest states on SEQUENCE_END
+        if (sequenceProcessingSpec.getSequenceControlInput() == SEQUENCE_END) {
+            SPDLOG_DEBUG("Received SEQUENCE_END signal. Reseting model state");
+            for (auto&& state : inferRequest.query_state()) {
+                state.reset();
+            }
+        } else {
+            auto modelState = inferRequest.query_state();
+            if (!sequence) {
+                SPDLOG_DEBUG("sequence is not set");
+                return StatusCode::INTERNAL_ERROR;
+            }
+            sequence->updateMemoryState(modelState);
         }
-        sequence->updateMemoryState(modelState);
     }
     // Include sequence_id in server response
     auto& tensorProto = (*response->mutable_outputs())["sequence_id"];
@@ -307,6 +342,6 @@ const Status StatefulModelInstance::postInferenceProcessing(tensorflow::serving:
 }
 
 std::unique_ptr<RequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>> StatefulModelInstance::createRequestProcessor(const tensorflow::serving::PredictRequest*, tensorflow::serving::PredictResponse*) {
-    return std::make_unique<StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>>(*this->getSequenceManager());
+    return std::make_unique<StatefulRequestProcessor<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>>(*this->getSequenceManager(), this->continuousBatchingScheduler);
 }
 }  // namespace ovms
@@ -20,6 +20,7 @@
 #include <set>
 #include <string>
 
+#include "continuous_batching_scheduler.hpp"
 #include "global_sequences_viewer.hpp"
 #include "modelinstance.hpp"
 #include "sequence_manager.hpp"
@@ -44,6 +45,10 @@ public:
         return this->sequenceManager;
     }
 
+    const std::shared_ptr<ContinuousBatchingScheduler>& getContinuousBatchingScheduler() const {
+        return this->continuousBatchingScheduler;
+    }
+
     static const Status extractSequenceId(const tensorflow::TensorProto& proto, uint64_t& sequenceId);
 
     static const Status extractSequenceControlInput(const tensorflow::TensorProto& proto, uint32_t& sequenceControlInput);
@@ -82,6 +87,8 @@ protected:
 
     GlobalSequencesViewer* globalSequencesViewer;
 
+    std::shared_ptr<ContinuousBatchingScheduler> continuousBatchingScheduler;
+
     Status loadModelImpl(const ModelConfig& config, const DynamicModelParameter& parameter = DynamicModelParameter()) override;
 
     Status loadOVCompiledModel(const ModelConfig& config) override;
@@ -102,11 +109,14 @@ struct StatefulRequestProcessor : public RequestProcessor<RequestType, ResponseT
     SequenceProcessingSpec sequenceProcessingSpec;
     Sequence* sequence{nullptr};
     std::optional<uint64_t> sequenceId;
+    // When set, memory state is kept in the sequence and inference is executed in batch with other sequences
+    std::shared_ptr<ContinuousBatchingScheduler> continuousBatchingScheduler;
 
-    StatefulRequestProcessor(SequenceManager& sequenceManager);
+    StatefulRequestProcessor(SequenceManager& sequenceManager, std::shared_ptr<ContinuousBatchingScheduler> continuousBatchingScheduler = nullptr);
     Status extractRequestParameters(const RequestType* request) override;
     Status prepare() override;
     Status preInferenceProcessing(ov::InferRequest& inferRequest) override;
+    Status performInference(ModelInstance& modelInstance, ov::InferRequest& inferRequest) override;
     Status postInferenceProcessing(ResponseType* response, ov::InferRequest& inferRequest) override;
     Status release() override;
 };
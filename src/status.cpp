@@ -62,6 +62,14 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::CONFIG_LAYOUT_IS_NOT_IN_MODEL, "Layout from config not found in model"},
     {StatusCode::CONFIG_SHAPE_MAPPED_BUT_USED_REAL_NAME, "Shape from config has real name. Use mapped name instead"},
     {StatusCode::CONFIG_LAYOUT_MAPPED_BUT_USED_REAL_NAME, "Layout from config has real name. Use mapped name instead"},
+    {StatusCode::CONFIG_ACCEPTED_PRECISIONS_IS_NOT_IN_MODEL, "Accepted precisions from config not found in model"},
+    {StatusCode::CONFIG_ACCEPTED_PRECISIONS_MAPPED_BUT_USED_REAL_NAME, "Accepted precisions from config have real name. Use mapped name instead"},
+    {StatusCode::CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT, "Accepted precisions from config have wrong format"},
+    {StatusCode::CONFIG_ACCEPTED_PRECISION_CONVERSION_NOT_SUPPORTED, "Accepted precision from config cannot be converted into model input precision"},
+    {StatusCode::CONFIG_IMAGE_PREPROCESSING_IS_NOT_IN_MODEL, "Image preprocessing from config not found in model"},
+    {StatusCode::CONFIG_IMAGE_PREPROCESSING_MAPPED_BUT_USED_REAL_NAME, "Image preprocessing from config has real name. Use mapped name instead"},
+    {StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT, "Image preprocessing from config has wrong format"},
+    {StatusCode::CONFIG_IMAGE_PREPROCESSING_NOT_SUPPORTED, "Image preprocessing from config is not supported for model input"},
     {StatusCode::INVALID_NIREQ, "Nireq parameter too high"},
     {StatusCode::REQUESTED_DYNAMIC_PARAMETERS_ON_SUBSCRIBED_MODEL, "Requested dynamic parameters but model is used in pipeline"},
     {StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET, "Node is not ready for execution"},
@@ -191,6 +199,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, "Pipeline execution aborted due to no content from custom node"},
     {StatusCode::PIPELINE_INPUTS_AMBIGUOUS_METADATA, "Multiple nodes connected to the same pipeline input require different tensor metadata"},
     {StatusCode::PIPELINE_STRING_DEMUILTIPLICATION_UNSUPPORTED, "Demultiplication is not supported for string precision"},
+    {StatusCode::PIPELINE_BATCH_SHARDS_INVALID_DEPENDENCY, "Batching shards requires DL model node to be the only dependant of a single demultiplexer node"},
 
     // Mediapipe
     {StatusCode::MEDIAPIPE_DESERIALIZATION_ERROR, "Failed to deserialize tensor for mediapipe graph"},
@@ -223,6 +232,10 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::PYTHON_NODE_FILE_STATE_INITIALIZATION_FAILED, "The Python Node state initialization failed"},
     {StatusCode::PYTHON_NODE_MISSING_OPTIONS, "The Python Node is missing options definition"},
     {StatusCode::PYTHON_NODE_MISSING_NAME, "The Python Node is missing name definition"},
+    {StatusCode::PYTHON_NODE_WORKER_START_FAILED, "The Python Node worker process failed to start"},
+    {StatusCode::PYTHON_NODE_WORKER_EXECUTION_FAILED, "The Python Node execution in worker process failed"},
+    {StatusCode::PYTHON_NODE_WORKER_EXECUTION_TIMEOUT, "The Python Node execution in worker process timed out"},
+    {StatusCode::PYTHON_NODE_WORKER_UNAVAILABLE, "No Python Node worker process is available"},
 
     // Storage errors
     // S3
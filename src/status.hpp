@@ -53,6 +53,14 @@ enum class StatusCode {
     CONFIG_LAYOUT_IS_NOT_IN_MODEL,
     CONFIG_SHAPE_MAPPED_BUT_USED_REAL_NAME,  /*!< Using old name of input/output in config shape when mapped in mapping_config.json*/
     CONFIG_LAYOUT_MAPPED_BUT_USED_REAL_NAME, /*!< Using old name of input/output in config layout when mapped in mapping_config.json*/
+    CONFIG_ACCEPTED_PRECISIONS_IS_NOT_IN_MODEL,
+    CONFIG_ACCEPTED_PRECISIONS_MAPPED_BUT_USED_REAL_NAME, /*!< Using old name of input in config accepted precisions when mapped in mapping_config.json*/
+    CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT,
+    CONFIG_ACCEPTED_PRECISION_CONVERSION_NOT_SUPPORTED, /*!< Accepted precision cannot be converted into model input precision */
+    CONFIG_IMAGE_PREPROCESSING_IS_NOT_IN_MODEL,
+    CONFIG_IMAGE_PREPROCESSING_MAPPED_BUT_USED_REAL_NAME, /*!< Using old name of input in config image preprocessing when mapped in mapping_config.json*/
+    CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT,
+    CONFIG_IMAGE_PREPROCESSING_NOT_SUPPORTED, /*!< Image preprocessing set for input without image shape or with unsupported precision */
     CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE,
     REQUESTED_DYNAMIC_PARAMETERS_ON_SUBSCRIBED_MODEL,
     CANNOT_CONVERT_FLAT_SHAPE,
@@ -236,6 +244,7 @@ enum class StatusCode {
     PIPELINE_DEMULTIPLEXER_NO_RESULTS,
     PIPELINE_INPUTS_AMBIGUOUS_METADATA,
     PIPELINE_STRING_DEMUILTIPLICATION_UNSUPPORTED,
+    PIPELINE_BATCH_SHARDS_INVALID_DEPENDENCY,
 
     // Mediapipe
     MEDIAPIPE_DESERIALIZATION_ERROR,
@@ -268,6 +277,10 @@ enum class StatusCode {
     PYTHON_NODE_FILE_STATE_INITIALIZATION_FAILED,
     PYTHON_NODE_MISSING_OPTIONS,
     PYTHON_NODE_MISSING_NAME,
+    PYTHON_NODE_WORKER_START_FAILED,
+    PYTHON_NODE_WORKER_EXECUTION_FAILED,
+    PYTHON_NODE_WORKER_EXECUTION_TIMEOUT,
+    PYTHON_NODE_WORKER_UNAVAILABLE,
 
     // Custom Loader
     CUSTOM_LOADER_LIBRARY_INVALID,
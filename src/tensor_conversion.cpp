@@ -30,6 +30,8 @@
 
 #include <openvino/openvino.hpp>
 
+#include "image_decoding.hpp"
+#include "image_preprocessing.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "logging.hpp"
 #include "opencv2/opencv.hpp"
@@ -75,19 +77,6 @@ static bool isPrecisionEqual(int matPrecision, ovms::Precision tensorPrecision)
     return false;
 }
 
-static cv::Mat convertStringToMat(const std::string& image) {
-    OVMS_PROFILE_FUNCTION();
-    std::vector<unsigned char> data(image.begin(), image.end());
-    cv::Mat dataMat(data, true);
-
-    try {
-        return cv::imdecode(dataMat, cv::IMREAD_UNCHANGED);
-    } catch (const cv::Exception& e) {
-        SPDLOG_DEBUG("Error during string_val to mat conversion: {}", e.what());
-        return cv::Mat{};
-    }
-}
-
 static Status convertPrecision(const cv::Mat& src, cv::Mat& dst, const ovms::Precision requestedPrecision) {
     OVMS_PROFILE_FUNCTION();
     int type = getMatTypeFromTensorPrecision(requestedPrecision);
@@ -100,8 +89,17 @@ static Status convertPrecision(const cv::Mat& src, cv::Mat& dst, const ovms::Pre
     return StatusCode::OK;
 }
 
+// Inputs with image preprocessing configured can be filled in planar layout
+static bool isPlanarImageLayout(const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    return tensorInfo->getImagePreprocessing() != nullptr &&
+           (tensorInfo->getLayout() == "NCHW" || tensorInfo->getLayout() == "N?CHW");
+}
+
 static Status validateLayout(const std::shared_ptr<const TensorInfo>& tensorInfo) {
     OVMS_PROFILE_FUNCTION();
+    if (isPlanarImageLayout(tensorInfo)) {
+        return StatusCode::OK;
+    }
     static const std::string binarySupportedLayout = "N...HWC";
     if (!tensorInfo->getLayout().createIntersection(Layout(binarySupportedLayout), tensorInfo->getShape().size()).has_value()) {
         SPDLOG_DEBUG("Endpoint needs to be compatible with {} to support binary image inputs, actual: {}",
@@ -119,9 +117,9 @@ static bool resizeNeeded(const cv::Mat& image, const dimension_value_t height, c
     return false;
 }
 
-static Status resizeMat(const cv::Mat& src, cv::Mat& dst, const dimension_value_t height, const dimension_value_t width) {
+static Status resizeMat(const cv::Mat& src, cv::Mat& dst, const dimension_value_t height, const dimension_value_t width, int interpolation = cv::INTER_LINEAR) {
     OVMS_PROFILE_FUNCTION();
-    cv::resize(src, dst, cv::Size(width, height));
+    cv::resize(src, dst, cv::Size(width, height), 0, 0, interpolation);
     return StatusCode::OK;
 }
 
@@ -132,10 +130,11 @@ static Status validateNumberOfChannels(const std::shared_ptr<const TensorInfo>&
 
     // At this point we can either have nhwc format or pretendant to be nhwc but with ANY layout in pipeline info
     Dimension numberOfChannels;
+    const bool planar = isPlanarImageLayout(tensorInfo);
     if (tensorInfo->getShape().size() == 4) {
-        numberOfChannels = tensorInfo->getShape()[3];
+        numberOfChannels = tensorInfo->getShape()[planar ? 1 : 3];
     } else if (tensorInfo->isInfluencedByDemultiplexer() && tensorInfo->getShape().size() == 5) {
-        numberOfChannels = tensorInfo->getShape()[4];
+        numberOfChannels = tensorInfo->getShape()[planar ? 2 : 4];
     } else {
         return StatusCode::INVALID_NO_OF_CHANNELS;
     }
@@ -279,6 +278,9 @@ static Dimension getTensorInfoHeightDim(const std::shared_ptr<const TensorInfo>&
         throw std::logic_error("wrong number of shape dimensions");
     }
     size_t position = numberOfShapeDimensions == 4 ? /*NHWC*/ 1 : /*N?HWC*/ 2;
+    if (isPlanarImageLayout(tensorInfo)) {
+        position++;  // NCHW, N?CHW
+    }
     return tensorInfo->getShape()[position];
 }
 
@@ -288,6 +290,9 @@ static Dimension getTensorInfoWidthDim(const std::shared_ptr<const TensorInfo>&
         throw std::logic_error("wrong number of shape dimensions");
     }
     size_t position = numberOfShapeDimensions == 4 ? /*NHWC*/ 2 : /*N?HWC*/ 3;
+    if (isPlanarImageLayout(tensorInfo)) {
+        position++;  // NCHW, N?CHW
+    }
     return tensorInfo->getShape()[position];
 }
 
@@ -326,6 +331,9 @@ static bool isResizeSupported(const std::shared_ptr<const TensorInfo>& tensorInf
             return false;
         }
     }
+    if (isPlanarImageLayout(tensorInfo)) {
+        return true;
+    }
     if (tensorInfo->getLayout() != "NHWC" &&
         tensorInfo->getLayout() != "N?HWC" &&
         tensorInfo->getLayout() != Layout::getUnspecifiedLayout()) {
@@ -378,6 +386,7 @@ static Status convertTensorToMatsMatchingTensorInfo(const TensorType& src, std::
     // Enforce resolution alignment against first image in the batch if resize is not supported.
     bool resizeSupported = isResizeSupported(tensorInfo);
     bool enforceResolutionAlignment = !resizeSupported;
+    const ImagePreprocessing* preprocessing = tensorInfo->getImagePreprocessing();
 
     bool rawInputsContentsUsed = (buffer != nullptr);
     std::vector<std::string> inputs;
@@ -385,9 +394,16 @@ static Status convertTensorToMatsMatchingTensorInfo(const TensorType& src, std::
     if (status != StatusCode::OK) {
         return status;
     }
+    // With known target resolution JPEG images can be decoded at reduced scale closer to it
+    size_t decodeHeight = 0;
+    size_t decodeWidth = 0;
+    if (resizeSupported && targetHeight.isStatic() && targetWidth.isStatic()) {
+        decodeHeight = targetHeight.getStaticValue();
+        decodeWidth = targetWidth.getStaticValue();
+    }
     int numberOfInputs = (!rawInputsContentsUsed ? getBinaryInputsSize(src) : inputs.size());
     for (int i = 0; i < numberOfInputs; i++) {
-        cv::Mat image = convertStringToMat(!rawInputsContentsUsed ? getBinaryInput(src, i) : inputs[i]);
+        cv::Mat image = decodeImage(!rawInputsContentsUsed ? getBinaryInput(src, i) : inputs[i], decodeHeight, decodeWidth);
         if (image.data == nullptr)
             return StatusCode::IMAGE_PARSING_FAILED;
         cv::Mat* firstImage = images.size() == 0 ? nullptr : &images.at(0);
@@ -399,7 +415,8 @@ static Status convertTensorToMatsMatchingTensorInfo(const TensorType& src, std::
             updateTargetResolution(targetHeight, targetWidth, image);
         }
 
-        if (!isPrecisionEqual(image.depth(), tensorInfo->getPrecision())) {
+        // With image preprocessing precision is converted while writing pixels into tensor
+        if (!preprocessing && !isPrecisionEqual(image.depth(), tensorInfo->getPrecision())) {
             cv::Mat imageCorrectPrecision;
             status = convertPrecision(image, imageCorrectPrecision, tensorInfo->getPrecision());
 
@@ -416,7 +433,7 @@ static Status convertTensorToMatsMatchingTensorInfo(const TensorType& src, std::
                 return StatusCode::INVALID_SHAPE;
             }
             cv::Mat imageResized;
-            status = resizeMat(image, imageResized, targetHeight.getStaticValue(), targetWidth.getStaticValue());
+            status = preprocessing ? resizeMat(image, imageResized, targetHeight.getStaticValue(), targetWidth.getStaticValue(), getResizeInterpolation(preprocessing->resizeAlgorithm)) : resizeMat(image, imageResized, targetHeight.getStaticValue(), targetWidth.getStaticValue());
             if (!status.ok()) {
                 return status;
             }
@@ -438,6 +455,12 @@ static shape_t getShapeFromImages(const std::vector<cv::Mat>& images, const std:
     if (tensorInfo->isInfluencedByDemultiplexer()) {
         dims.push_back(1);
     }
+    if (isPlanarImageLayout(tensorInfo)) {
+        dims.push_back(images[0].channels());
+        dims.push_back(images[0].rows);
+        dims.push_back(images[0].cols);
+        return dims;
+    }
     dims.push_back(images[0].rows);
     dims.push_back(images[0].cols);
     dims.push_back(images[0].channels());
@@ -457,6 +480,27 @@ static ov::Tensor createTensorFromMats(const std::vector<cv::Mat>& images, const
     return tensor;
 }
 
+static Status createPreprocessedTensorFromMats(const std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo, ov::Tensor& tensor) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isImagePreprocessingPrecisionSupported(tensorInfo->getPrecision())) {
+        return StatusCode::INVALID_PRECISION;
+    }
+    ov::Shape shape = getShapeFromImages(images, tensorInfo);
+    ov::element::Type precision = tensorInfo->getOvPrecision();
+    ov::Tensor preprocessed(precision, shape);
+    const bool planar = isPlanarImageLayout(tensorInfo);
+    char* ptr = (char*)preprocessed.data();
+    for (const cv::Mat& image : images) {
+        auto status = preprocessImage(image, *tensorInfo->getImagePreprocessing(), tensorInfo->getPrecision(), planar, ptr);
+        if (!status.ok()) {
+            return status;
+        }
+        ptr += image.total() * image.channels() * precision.size();
+    }
+    tensor = std::move(preprocessed);
+    return StatusCode::OK;
+}
+
 static ov::Tensor convertMatsToTensor(std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo) {
     OVMS_PROFILE_FUNCTION();
     switch (tensorInfo->getPrecision()) {
@@ -493,6 +537,14 @@ static Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& s
         SPDLOG_DEBUG("Input native file format conversion failed");
         return status;
     }
+    if (tensorInfo->getImagePreprocessing() != nullptr) {
+        status = createPreprocessedTensorFromMats(images, tensorInfo, tensor);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Input native file format preprocessing failed");
+            return status;
+        }
+        return StatusCode::OK;
+    }
     tensor = convertMatsToTensor(images, tensorInfo);
     if (!tensor) {
         SPDLOG_DEBUG("Input native file format conversion failed");
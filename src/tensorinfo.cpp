@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "tensorinfo.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -149,6 +150,36 @@ const Shape& TensorInfo::getShape() const {
     return this->shape;
 }
 
+const std::vector<Precision>& TensorInfo::getAcceptedPrecisions() const {
+    return this->acceptedPrecisions;
+}
+
+bool TensorInfo::isPrecisionAccepted(Precision precision) const {
+    return precision == this->precision ||
+           std::find(this->acceptedPrecisions.begin(), this->acceptedPrecisions.end(), precision) != this->acceptedPrecisions.end();
+}
+
+float TensorInfo::getConversionScale() const {
+    return this->conversionScale;
+}
+
+std::shared_ptr<const TensorInfo> TensorInfo::createCopyWithAcceptedPrecisions(const std::vector<Precision>& acceptedPrecisions, float conversionScale) const {
+    auto copy = std::make_shared<TensorInfo>(*this);
+    copy->acceptedPrecisions = acceptedPrecisions;
+    copy->conversionScale = conversionScale;
+    return copy;
+}
+
+const ImagePreprocessing* TensorInfo::getImagePreprocessing() const {
+    return this->imagePreprocessing.get();
+}
+
+std::shared_ptr<const TensorInfo> TensorInfo::createCopyWithImagePreprocessing(const ImagePreprocessing& imagePreprocessing) const {
+    auto copy = std::make_shared<TensorInfo>(*this);
+    copy->imagePreprocessing = std::make_shared<const ImagePreprocessing>(imagePreprocessing);
+    return copy;
+}
+
 std::shared_ptr<const TensorInfo> TensorInfo::createCopyWithNewShape(const Shape& shape) const {
     auto copy = std::make_shared<TensorInfo>(*this);
     copy->shape = shape;
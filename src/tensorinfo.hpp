@@ -23,6 +23,7 @@
 
 #include <openvino/openvino.hpp>
 
+#include "image_preprocessing.hpp"
 #include "layout.hpp"
 #include "precision.hpp"
 #include "shape.hpp"
@@ -177,6 +178,30 @@ public:
 
     bool isInfluencedByDemultiplexer() const;
 
+    /**
+         * @brief Gets request precisions converted on the server into tensor precision
+         *
+         * @return accepted precisions
+         */
+    const std::vector<Precision>& getAcceptedPrecisions() const;
+
+    /**
+         * @brief Checks if request data in given precision can be used for this tensor
+         */
+    bool isPrecisionAccepted(Precision precision) const;
+
+    /**
+         * @brief Gets multiplier applied to data converted from integer precision
+         */
+    float getConversionScale() const;
+
+    /**
+         * @brief Gets preprocessing applied to binary image input, nullptr if not configured
+         */
+    const ImagePreprocessing* getImagePreprocessing() const;
+
+    std::shared_ptr<const TensorInfo> createCopyWithAcceptedPrecisions(const std::vector<Precision>& acceptedPrecisions, float conversionScale) const;
+    std::shared_ptr<const TensorInfo> createCopyWithImagePreprocessing(const ImagePreprocessing& imagePreprocessing) const;
     std::shared_ptr<const TensorInfo> createCopyWithNewShape(const Shape& shape) const;
     std::shared_ptr<const TensorInfo> createCopyWithNewMappedName(const std::string& mappedName) const;
 
@@ -219,6 +244,18 @@ protected:
          */
     bool influencedByDemultiplexer = false;
 
+    /**
+         * @brief Request precisions converted into tensor precision during deserialization
+         */
+    std::vector<Precision> acceptedPrecisions;
+
+    float conversionScale = 1.0f;
+
+    /**
+         * @brief Preprocessing applied to binary image input
+         */
+    std::shared_ptr<const ImagePreprocessing> imagePreprocessing;
+
     void createProcessingHints();
     TensorInfo::ProcessingHint preProcessingHint = TensorInfo::ProcessingHint::NO_PROCESSING;
     TensorInfo::ProcessingHint postProcessingHint = TensorInfo::ProcessingHint::NO_PROCESSING;
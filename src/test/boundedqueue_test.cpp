@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../boundedqueue.hpp"
+
+using ovms::BoundedQueue;
+
+TEST(BoundedQueue, PopsInPushOrder) {
+    BoundedQueue<int> queue(3);
+    size_t depth = 0;
+    std::chrono::microseconds waited{0};
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(queue.push(int{i}, depth, waited));
+        EXPECT_EQ(depth, i + 1);
+    }
+    for (int i = 0; i < 3; i++) {
+        auto element = queue.pop();
+        ASSERT_TRUE(element.has_value());
+        EXPECT_EQ(element.value(), i);
+    }
+    EXPECT_EQ(queue.size(), 0);
+}
+
+TEST(BoundedQueue, PushWaitsForFreeSpace) {
+    BoundedQueue<int> queue(1);
+    size_t depth = 0;
+    std::chrono::microseconds waited{0};
+    ASSERT_TRUE(queue.push(1, depth, waited));
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(queue.pop().value(), 1);
+    });
+    ASSERT_TRUE(queue.push(2, depth, waited));
+    consumer.join();
+    EXPECT_GE(waited.count(), 40'000);
+    EXPECT_EQ(depth, 1);
+    EXPECT_EQ(queue.pop().value(), 2);
+}
+
+TEST(BoundedQueue, CloseDrainsRemainingElementsAndRejectsPush) {
+    BoundedQueue<int> queue(2);
+    size_t depth = 0;
+    std::chrono::microseconds waited{0};
+    ASSERT_TRUE(queue.push(1, depth, waited));
+    queue.close();
+    EXPECT_FALSE(queue.push(2, depth, waited));
+    EXPECT_EQ(queue.pop().value(), 1);
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(BoundedQueue, CloseWakesUpWaitingThreads) {
+    BoundedQueue<int> fullQueue(1);
+    BoundedQueue<int> emptyQueue(1);
+    size_t depth = 0;
+    std::chrono::microseconds waited{0};
+    ASSERT_TRUE(fullQueue.push(1, depth, waited));
+    auto producer = std::async(std::launch::async, [&fullQueue]() {
+        size_t depth = 0;
+        std::chrono::microseconds waited{0};
+        return fullQueue.push(2, depth, waited);
+    });
+    auto consumer = std::async(std::launch::async, [&emptyQueue]() {
+        return emptyQueue.pop();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    fullQueue.close();
+    emptyQueue.close();
+    EXPECT_FALSE(producer.get());
+    EXPECT_FALSE(consumer.get().has_value());
+}
@@ -0,0 +1,281 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../cloudmodelcache.hpp"
+#include "../localfilesystem.hpp"
+#include "../metric_config.hpp"
+#include "../metric_registry.hpp"
+#include "../model.hpp"
+#include "../modelconfig.hpp"
+#include "mockmodelinstancechangingstates.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+namespace {
+class FingerprintingFileSystem : public LocalFileSystem {
+public:
+    std::map<std::string, std::string> fingerprints;
+    uint32_t downloads = 0;
+    uint64_t fileSize = 100;
+
+    StatusCode getDirectoryFingerprint(const std::string& path, std::string* fingerprint) override {
+        auto it = fingerprints.find(path);
+        if (it == fingerprints.end()) {
+            return StatusCode::NOT_IMPLEMENTED;
+        }
+        *fingerprint = it->second;
+        return StatusCode::OK;
+    }
+
+    StatusCode downloadFileFolder(const std::string& path, const std::string& local_path) override {
+        downloads++;
+        std::ofstream file(local_path + "/model.bin", std::ios::binary);
+        file << std::string(fileSize, 'x');
+        return StatusCode::OK;
+    }
+};
+
+class MockModelInstanceKeepingConfig : public MockModelInstanceChangingStates {
+public:
+    using MockModelInstanceChangingStates::MockModelInstanceChangingStates;
+
+    Status loadModel(const ModelConfig& config) override {
+        this->config = config;
+        return MockModelInstanceChangingStates::loadModel(config);
+    }
+    Status reloadModel(const ModelConfig& config, const DynamicModelParameter& parameter = DynamicModelParameter()) override {
+        this->config = config;
+        return MockModelInstanceChangingStates::reloadModel(config, parameter);
+    }
+};
+
+class MockModelKeepingConfig : public Model {
+public:
+    MockModelKeepingConfig() :
+        Model("model", false, nullptr) {}
+
+protected:
+    std::shared_ptr<ModelInstance> modelInstanceFactory(const std::string& modelName, const model_version_t version, ov::Core& ieCore, MetricRegistry* registry = nullptr, const MetricConfig* metricConfig = nullptr) override {
+        return std::make_shared<MockModelInstanceKeepingConfig>(modelName, version, ieCore, registry, metricConfig);
+    }
+};
+}  // namespace
+
+class CloudModelCacheTest : public TestWithTempDir {
+protected:
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        cacheDirectory = directoryPath + "/cache";
+        ASSERT_EQ(cache.configure(cacheDirectory, 250), StatusCode::OK);
+        remoteFs.fingerprints["s3://bucket/model/1"] = "model.bin:etag1";
+        remoteFs.fingerprints["s3://bucket/model/2"] = "model.bin:etag2";
+        remoteFs.fingerprints["s3://bucket/model/3"] = "model.bin:etag3";
+    }
+
+    void TearDown() override {
+        cache.configure("", 0);
+        TestWithTempDir::TearDown();
+    }
+
+    std::string cacheDirectory;
+    CloudModelCache cache;
+    FingerprintingFileSystem remoteFs;
+};
+
+TEST_F(CloudModelCacheTest, UnchangedVersionIsNotDownloadedAgain) {
+    std::string localPath;
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+    EXPECT_EQ(remoteFs.downloads, 1);
+    EXPECT_TRUE(std::filesystem::is_symlink(localPath + "/1"));
+    EXPECT_TRUE(std::filesystem::exists(localPath + "/1/model.bin"));
+    cache.release(localPath + "/1");
+    std::filesystem::remove_all(localPath);
+
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+    EXPECT_EQ(remoteFs.downloads, 1);
+    EXPECT_EQ(cache.getHits(), 1);
+    EXPECT_EQ(cache.getMisses(), 1);
+    EXPECT_EQ(cache.getBytesSaved(), 100);
+    cache.release(localPath + "/1");
+    std::filesystem::remove_all(localPath);
+}
+
+TEST_F(CloudModelCacheTest, ChangedFingerprintTriggersDownload) {
+    std::string localPath;
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+    cache.release(localPath + "/1");
+    std::filesystem::remove_all(localPath);
+
+    remoteFs.fingerprints["s3://bucket/model/1"] = "model.bin:etag1_changed";
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+    EXPECT_EQ(remoteFs.downloads, 2);
+    EXPECT_EQ(cache.getHits(), 0);
+    cache.release(localPath + "/1");
+    std::filesystem::remove_all(localPath);
+}
+
+TEST_F(CloudModelCacheTest, LeastRecentlyUsedUnusedEntryIsEvicted) {
+    std::string localPath;
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1, 2}), StatusCode::OK);
+    cache.release(localPath + "/1");
+    EXPECT_EQ(cache.getCurrentSizeBytes(), 200);
+
+    std::string secondLocalPath;
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &secondLocalPath, {3}), StatusCode::OK);
+    EXPECT_EQ(cache.getCurrentSizeBytes(), 200);
+    EXPECT_TRUE(std::filesystem::exists(localPath + "/2/model.bin"));
+    EXPECT_FALSE(std::filesystem::exists(localPath + "/1/model.bin"));
+    cache.release(localPath + "/2");
+    cache.release(secondLocalPath + "/3");
+    std::filesystem::remove_all(localPath);
+    std::filesystem::remove_all(secondLocalPath);
+}
+
+TEST_F(CloudModelCacheTest, EntriesArePersistedBetweenRestarts) {
+    std::string localPath;
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+    cache.release(localPath + "/1");
+    std::filesystem::remove_all(localPath);
+
+    CloudModelCache restartedCache;
+    ASSERT_EQ(restartedCache.configure(cacheDirectory, 250), StatusCode::OK);
+    EXPECT_EQ(restartedCache.getCurrentSizeBytes(), 100);
+    ASSERT_EQ(restartedCache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+    EXPECT_EQ(remoteFs.downloads, 1);
+    EXPECT_EQ(restartedCache.getHits(), 1);
+    restartedCache.release(localPath + "/1");
+    std::filesystem::remove_all(localPath);
+}
+
+TEST_F(CloudModelCacheTest, FilesystemWithoutFingerprintDownloadsDirectly) {
+    std::string localPath;
+    ASSERT_EQ(cache.downloadModelVersions(remoteFs, "gs://bucket/model", &localPath, {1}), StatusCode::OK);
+    EXPECT_EQ(remoteFs.downloads, 1);
+    EXPECT_FALSE(std::filesystem::is_symlink(localPath + "/1"));
+    EXPECT_TRUE(std::filesystem::exists(localPath + "/1/model.bin"));
+    EXPECT_EQ(cache.getCurrentSizeBytes(), 0);
+    std::filesystem::remove_all(localPath);
+}
+
+TEST_F(CloudModelCacheTest, SlowDownloadDoesNotBlockOtherEntries) {
+    std::promise<void> firstDownloadStarted;
+    std::promise<void> finishFirstDownload;
+    std::shared_future<void> finishFirstDownloadFuture = finishFirstDownload.get_future().share();
+    std::string firstPath;
+    std::thread first([&]() {
+        EXPECT_EQ(cache.acquire(
+                      "first", [&](const std::string& destination) {
+                          firstDownloadStarted.set_value();
+                          finishFirstDownloadFuture.wait();
+                          return remoteFs.downloadFileFolder("", destination);
+                      },
+                      &firstPath),
+            StatusCode::OK);
+    });
+    firstDownloadStarted.get_future().wait();
+
+    std::string secondPath;
+    ASSERT_EQ(cache.acquire(
+                  "second", [&](const std::string& destination) { return remoteFs.downloadFileFolder("", destination); }, &secondPath),
+        StatusCode::OK);
+    EXPECT_TRUE(std::filesystem::exists(secondPath + "/model.bin"));
+
+    // Request for entry being downloaded waits for it and does not download again
+    std::string firstPathAgain;
+    auto sameKey = std::async(std::launch::async, [&]() {
+        return cache.acquire(
+            "first", [](const std::string&) { return StatusCode::INTERNAL_ERROR; }, &firstPathAgain);
+    });
+    finishFirstDownload.set_value();
+    first.join();
+    EXPECT_EQ(sameKey.get(), StatusCode::OK);
+    EXPECT_EQ(firstPathAgain, firstPath);
+    EXPECT_EQ(cache.getMisses(), 2);
+    EXPECT_EQ(cache.getHits(), 1);
+}
+
+TEST_F(CloudModelCacheTest, ReloadedVersionsReleaseEntriesSoTheyCanBeEvicted) {
+    auto& instance = CloudModelCache::instance();
+    ASSERT_EQ(instance.configure(directoryPath + "/instance_cache", 250), StatusCode::OK);
+    auto fingerprintingFs = std::make_shared<FingerprintingFileSystem>();
+    fingerprintingFs->fingerprints = remoteFs.fingerprints;
+    std::shared_ptr<FileSystem> fs = fingerprintingFs;
+    ov::Core ieCore;
+    MockModelKeepingConfig model;
+    ModelConfig config;
+    config.setName("model");
+    config.setBasePath("s3://bucket/model");
+    auto versions = std::make_shared<model_versions_t>(model_versions_t{1, 2});
+    auto versionsFailed = std::make_shared<model_versions_t>();
+    const std::string firstKey = CloudModelCache::createKey("s3://bucket/model/1", "model.bin:etag1");
+    const std::string secondKey = CloudModelCache::createKey("s3://bucket/model/2", "model.bin:etag2");
+
+    ASSERT_EQ(model.addVersions(versions, config, fs, ieCore, versionsFailed), StatusCode::OK);
+    EXPECT_EQ(instance.getUsers(firstKey), 1);
+    EXPECT_EQ(instance.getUsers(secondKey), 1);
+
+    // Versions in LOADING state are downloaded again on reload
+    const uint64_t hitsBeforeReload = instance.getHits();
+    for (auto version : *versions) {
+        std::static_pointer_cast<MockModelInstanceChangingStates>(model.getModelInstanceByVersion(version))->setState(ModelVersionState::LOADING);
+    }
+    ASSERT_EQ(model.reloadVersions(versions, config, fs, ieCore, versionsFailed), StatusCode::OK);
+    EXPECT_EQ(fingerprintingFs->downloads, 2);
+    EXPECT_EQ(instance.getHits() - hitsBeforeReload, 2);
+    EXPECT_EQ(instance.getUsers(firstKey), 1);
+    EXPECT_EQ(instance.getUsers(secondKey), 1);
+
+    ASSERT_EQ(model.retireVersions(versions), StatusCode::OK);
+    EXPECT_EQ(instance.getUsers(firstKey), 0);
+    EXPECT_EQ(instance.getUsers(secondKey), 0);
+
+    // Entries are no longer used, so least recently used one is evicted for new version
+    std::string localPath;
+    ASSERT_EQ(instance.downloadModelVersions(*fs, "s3://bucket/model", &localPath, {3}), StatusCode::OK);
+    EXPECT_EQ(instance.getCurrentSizeBytes(), 200);
+    instance.release(localPath + "/3");
+    std::filesystem::remove_all(localPath);
+    instance.configure("", 0);
+}
+
+TEST_F(CloudModelCacheTest, HitsMissesAndBytesSavedAreReportedAsMetrics) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    ASSERT_EQ(metricConfig.loadFromCLIString(true, METRIC_NAME_CLOUD_MODEL_CACHE_HITS + "," + METRIC_NAME_CLOUD_MODEL_CACHE_MISSES + "," + METRIC_NAME_CLOUD_MODEL_CACHE_BYTES_SAVED), StatusCode::OK);
+    cache.registerMetrics(&registry, &metricConfig);
+    std::string localPath;
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(cache.downloadModelVersions(remoteFs, "s3://bucket/model", &localPath, {1}), StatusCode::OK);
+        cache.release(localPath + "/1");
+        std::filesystem::remove_all(localPath);
+    }
+    auto metrics = registry.collect();
+    EXPECT_THAT(metrics, ::testing::HasSubstr(METRIC_NAME_CLOUD_MODEL_CACHE_HITS + " 1"));
+    EXPECT_THAT(metrics, ::testing::HasSubstr(METRIC_NAME_CLOUD_MODEL_CACHE_MISSES + " 1"));
+    EXPECT_THAT(metrics, ::testing::HasSubstr(METRIC_NAME_CLOUD_MODEL_CACHE_BYTES_SAVED + " 100"));
+    cache.unregisterMetrics(&registry);
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 #include <array>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <numeric>
@@ -46,6 +47,7 @@
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
 #include "../precision.hpp"
+#include "../predict_request_validation_utils.hpp"
 #include "../stringutils.hpp"
 #include "test_utils.hpp"
 
@@ -794,6 +796,149 @@ TEST_F(EnsembleFlowCustomNodePipelineExecutionTest, FailInCustomNodeExecution) {
     ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::NODE_LIBRARY_EXECUTION_FAILED);
 }
 
+template <bool knownOutputShape, CustomNodeTensorPrecision outputPrecision = CustomNodeTensorPrecision::FP32>
+struct LibraryWithServerAllocatedOutputs {
+    static int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeParam* params, int paramsCount) {
+        return 0;
+    }
+    static int deinitialize(void* customNodeLibraryInternalManager) {
+        return 0;
+    }
+    static int execute(const struct CustomNodeTensor*, int, struct CustomNodeTensor**, int*, const struct CustomNodeParam*, int, void* customNodeLibraryInternalManager) {
+        // server allocated outputs interface should be used instead
+        return 1;
+    }
+    static int getInputsInfo(struct CustomNodeTensorInfo**, int*, const struct CustomNodeParam*, int, void* customNodeLibraryInternalManager) {
+        return 0;
+    }
+    static int getOutputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeParam*, int, void* customNodeLibraryInternalManager) {
+        *infoCount = 1;
+        *info = (struct CustomNodeTensorInfo*)malloc(sizeof(struct CustomNodeTensorInfo));
+        (*info)->name = "output_numbers";
+        (*info)->dimsCount = 2;
+        (*info)->dims = (uint64_t*)malloc(2 * sizeof(uint64_t));
+        (*info)->dims[0] = 0;
+        (*info)->dims[1] = 0;
+        (*info)->precision = CustomNodeTensorPrecision::FP32;
+        return 0;
+    }
+    static int release(void* ptr, void* customNodeLibraryInternalManager) {
+        free(ptr);
+        return 0;
+    }
+    static int getOutputsInfoForInputs(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeTensor* inputs, int inputsCount, const struct CustomNodeParam*, int, void* customNodeLibraryInternalManager) {
+        *infoCount = 1;
+        *info = (struct CustomNodeTensorInfo*)malloc(sizeof(struct CustomNodeTensorInfo));
+        (*info)->name = "output_numbers";
+        (*info)->dimsCount = inputs[0].dimsCount;
+        (*info)->dims = (uint64_t*)malloc(inputs[0].dimsCount * sizeof(uint64_t));
+        std::memcpy((*info)->dims, inputs[0].dims, inputs[0].dimsCount * sizeof(uint64_t));
+        if (!knownOutputShape) {
+            (*info)->dims[0] = 0;
+        }
+        (*info)->precision = outputPrecision;
+        return 0;
+    }
+    static int executeWithOutputs(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor* outputs, int outputsCount, const struct CustomNodeParam*, int, void* customNodeLibraryInternalManager) {
+        if (inputsCount != 1 || outputsCount != 1 || outputs[0].dataBytes != inputs[0].dataBytes) {
+            return 1;
+        }
+        const float* input = reinterpret_cast<const float*>(inputs[0].data);
+        float* output = reinterpret_cast<float*>(outputs[0].data);
+        for (uint64_t i = 0; i < inputs[0].dataBytes / sizeof(float); ++i) {
+            output[i] = input[i] * 2;
+        }
+        return 0;
+    }
+};
+
+template <typename T>
+static NodeLibrary createLibraryMockWithServerAllocatedOutputs() {
+    auto library = createLibraryMock<T>();
+    library.getOutputsInfoForInputs = T::getOutputsInfoForInputs;
+    library.executeWithOutputs = T::executeWithOutputs;
+    return library;
+}
+
+TEST_F(EnsembleFlowCustomNodePipelineExecutionTest, CustomNodeWithServerAllocatedOutputs) {
+    const std::vector<float> inputValues{3.5, 2.1, -0.2};
+    this->prepareRequest(inputValues);
+    auto inputTensorInfo = std::make_shared<ovms::TensorInfo>(pipelineInputName,
+        ovms::Precision::FP32,
+        ovms::Shape{1, 3},
+        Layout{"NC"});
+    const tensor_map_t inputsInfo{{pipelineInputName, inputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+    const tensor_map_t outputsInfo{{pipelineOutputName, inputTensorInfo}};
+    auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo);
+    auto custom_node = std::make_unique<CustomNode>(customNodeName,
+        createLibraryMockWithServerAllocatedOutputs<LibraryWithServerAllocatedOutputs<true>>(),
+        parameters_t{});
+
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *custom_node, {{pipelineInputName, customNodeInputName}});
+    pipeline.connect(*custom_node, *output_node, {{customNodeOutputName, pipelineOutputName}});
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(custom_node));
+    pipeline.push(std::move(output_node));
+
+    ASSERT_EQ(pipeline.execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    ASSERT_EQ(response.outputs().size(), 1);
+    this->checkResponse<float>(inputValues, [](float value) -> float {
+        return value * 2;
+    });
+}
+
+TEST_F(EnsembleFlowCustomNodePipelineExecutionTest, CustomNodeWithServerAllocatedOutputsUnknownOutputShape) {
+    const std::vector<float> inputValues{3.5, 2.1, -0.2};
+    this->prepareRequest(inputValues);
+    auto inputTensorInfo = std::make_shared<ovms::TensorInfo>(pipelineInputName,
+        ovms::Precision::FP32,
+        ovms::Shape{1, 3},
+        Layout{"NC"});
+    const tensor_map_t inputsInfo{{pipelineInputName, inputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+    const tensor_map_t outputsInfo{{pipelineOutputName, inputTensorInfo}};
+    auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo);
+    auto custom_node = std::make_unique<CustomNode>(customNodeName,
+        createLibraryMockWithServerAllocatedOutputs<LibraryWithServerAllocatedOutputs<false>>(),
+        parameters_t{});
+
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *custom_node, {{pipelineInputName, customNodeInputName}});
+    pipeline.connect(*custom_node, *output_node, {{customNodeOutputName, pipelineOutputName}});
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(custom_node));
+    pipeline.push(std::move(output_node));
+
+    ASSERT_EQ(pipeline.execute(DEFAULT_TEST_CONTEXT), StatusCode::NODE_LIBRARY_INVALID_SHAPE);
+}
+
+TEST_F(EnsembleFlowCustomNodePipelineExecutionTest, CustomNodeWithServerAllocatedOutputsPrecisionNotMatchingMetadata) {
+    const std::vector<float> inputValues{3.5, 2.1, -0.2};
+    this->prepareRequest(inputValues);
+    auto inputTensorInfo = std::make_shared<ovms::TensorInfo>(pipelineInputName,
+        ovms::Precision::FP32,
+        ovms::Shape{1, 3},
+        Layout{"NC"});
+    const tensor_map_t inputsInfo{{pipelineInputName, inputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+    const tensor_map_t outputsInfo{{pipelineOutputName, inputTensorInfo}};
+    auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo);
+    auto custom_node = std::make_unique<CustomNode>(customNodeName,
+        createLibraryMockWithServerAllocatedOutputs<LibraryWithServerAllocatedOutputs<true, CustomNodeTensorPrecision::I32>>(),
+        parameters_t{});
+
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *custom_node, {{pipelineInputName, customNodeInputName}});
+    pipeline.connect(*custom_node, *output_node, {{customNodeOutputName, pipelineOutputName}});
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(custom_node));
+    pipeline.push(std::move(output_node));
+
+    ASSERT_EQ(pipeline.execute(DEFAULT_TEST_CONTEXT), StatusCode::NODE_LIBRARY_INVALID_PRECISION);
+}
+
 struct LibraryCorruptedOutputHandle {
     static int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeParam* params, int paramsCount) {
         return 0;
@@ -1931,6 +2076,20 @@ TEST_F(EnsembleFlowCustomNodeAndDemultiplexerLoadConfigThenExecuteTest, JustDiff
     EXPECT_EQ(output->getShape(), Shape({4, 1, 10}));
 }
 
+TEST_F(EnsembleFlowCustomNodeAndDemultiplexerLoadConfigThenExecuteTest, PipelineDefinitionCachesInputsValidationPlan) {
+    this->loadConfiguration(pipelineCustomNodeDifferentOperationsConfig);
+    auto pipelineDefinition = manager.getPipelineFactory().findDefinitionByName(pipelineName);
+    ASSERT_NE(pipelineDefinition, nullptr);
+    auto plan = pipelineDefinition->getInputsValidationPlan();
+    ASSERT_NE(plan, nullptr);
+    auto inputs = pipelineDefinition->getInputsInfo();
+    ASSERT_EQ(plan->getInputs().size(), inputs.size());
+    for (const auto& [name, _] : inputs) {
+        EXPECT_NE(plan->find(name), ovms::request_validation_utils::ValidationPlan::NOT_FOUND) << name;
+    }
+    EXPECT_EQ(pipelineDefinition->getInputsValidationPlan(), plan);
+}
+
 static const char* pipelineCustomNodeDifferentOperationsThenDummyConfig = R"(
 {
     "custom_node_library_config_list": [
@@ -3701,6 +3860,83 @@ TEST_F(EnsembleFlowCustomNodePipelineExecutionTest, CustomNodeWithDemultiplexerA
     this->checkResponse(pipelineOutputName, response, expectedOutput, {7, 5, 10});
 }
 
+struct LibraryWithBatchExecution : public LibraryWithServerAllocatedOutputs<true> {
+    inline static int batchCalls = 0;
+    inline static int lastBatchSize = 0;
+    static int executeBatch(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor* outputs, int outputsCount, int batchSize, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager) {
+        batchCalls++;
+        lastBatchSize = batchSize;
+        for (int i = 0; i < batchSize; i++) {
+            int result = executeWithOutputs(inputs + i * inputsCount, inputsCount, outputs + i * outputsCount, outputsCount, params, paramsCount, customNodeLibraryInternalManager);
+            if (result != 0) {
+                return result;
+            }
+        }
+        return 0;
+    }
+};
+
+TEST_F(EnsembleFlowCustomNodePipelineExecutionTest, DemultiplexedShardsAreExecutedInSingleBatchCall) {
+    // input  demultiplexer  batched custom node  output (gather)
+    //  O------->O------------------->O----------------->O
+    std::optional<int32_t> demultiplyCount = 3;
+    std::vector<float> input(3 * 4);
+    std::iota(input.begin(), input.end(), 1);
+    PredictRequest request;
+    PredictResponse response;
+    tensorflow::TensorProto& proto = (*request.mutable_inputs())[pipelineInputName];
+    proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+    proto.mutable_tensor_content()->assign((char*)input.data(), input.size() * sizeof(float));
+    proto.mutable_tensor_shape()->add_dim()->set_size(3);
+    proto.mutable_tensor_shape()->add_dim()->set_size(1);
+    proto.mutable_tensor_shape()->add_dim()->set_size(4);
+
+    std::set<std::string> gather = {"demultiplexer_node"};
+    auto inputTensorInfo = std::make_shared<ovms::TensorInfo>(pipelineInputName,
+        ovms::Precision::FP32,
+        ovms::Shape{3, 1, 4},
+        Layout::getUnspecifiedLayout());
+    const tensor_map_t inputsInfo{{pipelineInputName, inputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+    auto tensorInfo = std::make_shared<ovms::TensorInfo>(pipelineOutputName,
+        ovms::Precision::FP32,
+        ovms::Shape{3, 1, 4},
+        Layout::getUnspecifiedLayout());
+    const tensor_map_t outputsInfo{{pipelineOutputName, tensorInfo}};
+    auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo, gather);
+    auto demultiplexer_node = std::make_unique<CustomNode>(
+        "demultiplexer_node",
+        createLibraryMock<LibraryCustomNodeWithDemultiplexerAndBatchSizeGreaterThan1ThenDummy>(),
+        parameters_t{
+            {"input_dims", "3,1,4;FP32"},
+            {"output_dims", "3,1,4;FP32"}},
+        std::unordered_map<std::string, std::string>{{"out", "out"}}, demultiplyCount);
+    auto library = createLibraryMockWithServerAllocatedOutputs<LibraryWithBatchExecution>();
+    library.executeBatch = LibraryWithBatchExecution::executeBatch;
+    ASSERT_TRUE(library.hasBatchExecution());
+    auto batched_node = std::make_unique<CustomNode>(customNodeName, library, parameters_t{});
+
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *demultiplexer_node, {{pipelineInputName, "in"}});
+    pipeline.connect(*demultiplexer_node, *batched_node, {{"out", customNodeInputName}});
+    pipeline.connect(*batched_node, *output_node, {{customNodeOutputName, pipelineOutputName}});
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(demultiplexer_node));
+    pipeline.push(std::move(batched_node));
+    pipeline.push(std::move(output_node));
+
+    LibraryWithBatchExecution::batchCalls = 0;
+    LibraryWithBatchExecution::lastBatchSize = 0;
+    ASSERT_EQ(pipeline.execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    EXPECT_EQ(LibraryWithBatchExecution::batchCalls, 1);
+    EXPECT_EQ(LibraryWithBatchExecution::lastBatchSize, 3);
+
+    std::vector<float> expectedOutput = input;
+    std::transform(expectedOutput.begin(), expectedOutput.end(), expectedOutput.begin(),
+        [](float f) -> float { return f * 2; });
+    this->checkResponse(pipelineOutputName, response, expectedOutput, {3, 1, 4});
+}
+
 TEST_F(EnsembleConfigurationValidationWithDemultiplexer, ShapesNotMatchBetweenDLModelAndCustomNode) {
     const size_t demultiplyCount = 33;
     std::vector<NodeInfo> info{
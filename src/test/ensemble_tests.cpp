@@ -937,6 +937,72 @@ TEST_F(EnsembleFlowTest, SeriesOfDummyModels) {
     std::cout << "compare results: " << timer.elapsed<std::chrono::microseconds>(COMPARE) / 1000 << "ms\n";
 }
 
+TEST_F(EnsembleFlowTest, StaticShapeModelOutputsArePassedToNextNodesWithoutCopy) {
+    // input      dummy      dummy      output
+    //  O--------->O--------->O--------->O
+    ConstructorEnabledModelManager managerWithDummyModel;
+    config.setNireq(1);
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    const tensor_map_t inputsInfo{{customPipelineInputName, dagDummyModelInputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+    auto first_node = std::make_unique<DLNode>("dummy_node_1", dummyModelName, requestedModelVersion, managerWithDummyModel);
+    auto second_node = std::make_unique<DLNode>("dummy_node_2", dummyModelName, requestedModelVersion, managerWithDummyModel);
+    const tensor_map_t outputsInfo{{customPipelineOutputName, dagDummyModelOutputTensorInfo}};
+    auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo);
+    const DLNode* firstNode = first_node.get();
+    const DLNode* secondNode = second_node.get();
+
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *first_node, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}});
+    pipeline.connect(*first_node, *second_node, {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_INPUT_NAME}});
+    pipeline.connect(*second_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}});
+
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(first_node));
+    pipeline.push(std::move(second_node));
+    pipeline.push(std::move(output_node));
+
+    // Both nodes share single infer request, so outputs must not be overwritten by the following node
+    ASSERT_EQ(pipeline.execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    checkDummyResponse(2);
+    EXPECT_EQ(firstNode->getBytesCopied(), 0);
+    EXPECT_EQ(secondNode->getBytesCopied(), 0);
+}
+
+TEST_F(EnsembleFlowTest, DynamicShapeModelOutputsAreCopied) {
+    tensorflow::TensorProto& proto = (*request.mutable_inputs())[customPipelineInputName];
+    const int batchSize = 3;
+    proto.mutable_tensor_shape()->mutable_dim(0)->set_size(batchSize);
+    requestData = std::vector<float>(batchSize * DUMMY_MODEL_OUTPUT_SIZE, 1.0);
+    proto.mutable_tensor_content()->assign((char*)requestData.data(), requestData.size() * sizeof(float));
+
+    config.setBatchingParams("-1");
+    ConstructorEnabledModelManager managerWithDynamicBatchDummyModel;
+    managerWithDynamicBatchDummyModel.reloadModelWithVersions(config);
+
+    dagDummyModelOutputTensorInfo = std::make_shared<ovms::TensorInfo>(customPipelineOutputName, ovms::Precision::FP32, ovms::Shape{ovms::Dimension::any(), 10}, Layout{"NC"});
+    dagDummyModelInputTensorInfo = std::make_shared<ovms::TensorInfo>(customPipelineInputName, ovms::Precision::FP32, ovms::Shape{ovms::Dimension::any(), 10}, Layout{"NC"});
+    const tensor_map_t inputsInfo{{customPipelineInputName, dagDummyModelInputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<PredictRequest>>(&request, inputsInfo);
+    auto model_node = std::make_unique<DLNode>("dummy_node", dummyModelName, requestedModelVersion, managerWithDynamicBatchDummyModel);
+    const tensor_map_t outputsInfo{{customPipelineOutputName, dagDummyModelOutputTensorInfo}};
+    auto output_node = std::make_unique<ExitNode<PredictResponse>>(&response, outputsInfo);
+    const DLNode* modelNode = model_node.get();
+
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *model_node, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}});
+    pipeline.connect(*model_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}});
+
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(model_node));
+    pipeline.push(std::move(output_node));
+
+    ASSERT_EQ(pipeline.execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    checkDummyResponse(1, batchSize);
+    EXPECT_EQ(modelNode->getBytesCopied(), batchSize * DUMMY_MODEL_OUTPUT_SIZE * sizeof(float));
+}
+
 TEST_F(EnsembleFlowTest, ExecutePipelineWithBatchSizeAny) {
     // Scenario
 
@@ -4777,6 +4843,130 @@ TYPED_TEST(EnsembleFlowBothApiTest, DemultiplexerMultipleBatchSizeWithShapeEqual
         PipelineDefinitionStateCode::AVAILABLE);
 }
 
+static const char* pipelineEntryDemultiplexerWithBatchedShards = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy",
+                "target_device": "CPU",
+                "model_version_policy": {"all": {}},
+                "shape": "(-1,10) ",
+                "nireq": 1
+            }
+        }
+    ],
+    "pipeline_config_list": [
+        {
+            "name": "pipeline1Dummy",
+            "inputs": ["custom_dummy_input"],
+            "demultiply_count": 3,
+            "nodes": [
+                {
+                    "name": "dummyNode",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "batch_shards": true,
+                    "inputs": [
+                        {"b": {"node_name": "request",
+                               "data_item": "custom_dummy_input"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output"}
+                    ]
+                }
+            ],
+            "outputs": [
+                {"custom_dummy_output": {"node_name": "dummyNode",
+                                         "data_item": "new_dummy_output"}
+                }
+            ]
+        }
+    ]
+})";
+
+TEST_F(EnsembleFlowTest, DemultiplexerShardsBatchedIntoSingleInference) {
+    std::string fileToReload = directoryPath + "/config.json";
+    createConfigFileWithContent(pipelineEntryDemultiplexerWithBatchedShards, fileToReload);
+    ConstructorEnabledModelManager manager;
+    ASSERT_EQ(manager.loadConfig(fileToReload), StatusCode::OK);
+
+    const size_t shardsCount = 3;
+    std::vector<float> data(shardsCount * DUMMY_MODEL_INPUT_SIZE);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = i;
+    }
+    prepareRequest(data, request, customPipelineInputName, {shardsCount, 1, DUMMY_MODEL_INPUT_SIZE});
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(manager.getPipelineFactory().create(pipeline, PIPELINE_1_DUMMY_NAME, &request, &response, manager), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+
+    // Response is gathered from shards as if each shard was inferred separately
+    ASSERT_EQ(response.outputs().count(customPipelineOutputName), 1);
+    const auto& proto = response.outputs().at(customPipelineOutputName);
+    ASSERT_EQ(proto.tensor_shape().dim_size(), 3);
+    EXPECT_EQ(proto.tensor_shape().dim(0).size(), shardsCount);
+    EXPECT_EQ(proto.tensor_shape().dim(1).size(), 1);
+    EXPECT_EQ(proto.tensor_shape().dim(2).size(), DUMMY_MODEL_OUTPUT_SIZE);
+    std::for_each(data.begin(), data.end(), [](float& v) { v += 1.0; });
+    ASSERT_EQ(proto.tensor_content().size(), data.size() * sizeof(float));
+    EXPECT_EQ(0, std::memcmp(proto.tensor_content().data(), data.data(), data.size() * sizeof(float)));
+}
+
+static const char* pipelineBatchShardsWithoutDemultiplexer = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy",
+                "target_device": "CPU",
+                "model_version_policy": {"all": {}},
+                "shape": "(-1,10) ",
+                "nireq": 1
+            }
+        }
+    ],
+    "pipeline_config_list": [
+        {
+            "name": "pipeline1Dummy",
+            "inputs": ["custom_dummy_input"],
+            "nodes": [
+                {
+                    "name": "dummyNode",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "batch_shards": true,
+                    "inputs": [
+                        {"b": {"node_name": "request",
+                               "data_item": "custom_dummy_input"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output"}
+                    ]
+                }
+            ],
+            "outputs": [
+                {"custom_dummy_output": {"node_name": "dummyNode",
+                                         "data_item": "new_dummy_output"}
+                }
+            ]
+        }
+    ]
+})";
+
+TEST_F(EnsembleFlowTest, BatchShardsWithoutDemultiplexerDependencyNotAllowed) {
+    std::string fileToReload = directoryPath + "/config.json";
+    createConfigFileWithContent(pipelineBatchShardsWithoutDemultiplexer, fileToReload);
+    ConstructorEnabledModelManager manager;
+    ASSERT_EQ(manager.loadConfig(fileToReload), StatusCode::PIPELINE_BATCH_SHARDS_INVALID_DEPENDENCY);
+    ASSERT_EQ(manager.getPipelineFactory().findDefinitionByName(PIPELINE_1_DUMMY_NAME)->getStateCode(),
+        PipelineDefinitionStateCode::LOADING_PRECONDITION_FAILED);
+}
+
 static const char* pipelineSingleIncrement4DimInputNHWC = R"(
 {
     "model_config_list": [
@@ -16,7 +16,9 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <numeric>
 #include <sstream>
 
 #include <gmock/gmock.h>
@@ -161,6 +163,73 @@ TEST_F(GatherNodeInputHandlerTest, SetInputsWithShardsHavingDifferentShapesShoul
     EXPECT_EQ(status, StatusCode::PIPELINE_INCONSISTENT_SHARD_DIMENSIONS) << status.string();
 }
 
+TEST_F(GatherNodeInputHandlerTest, ShardsAreCopiedIntoConsolidatedTensorOnArrival) {
+    const std::string inputName{"a"};
+    const session_id_t shardsCount = 2;
+    ov::element::Type_t precision{ov::element::Type_t::f32};
+    std::vector<float> firstShardData{1, 2, 3};
+    std::vector<float> secondShardData{4, 5, 6};
+    CollapseDetails collapsingDetails{{std::string("NOT_IMPORTANT_DEMULTIPLEXER_NAME")}, {shardsCount}};
+    GatherNodeInputHandler gInputHandler(1, collapsingDetails);
+    auto secondShard = TensorWithSource(createTensorWithNoDataOwnership(precision, {1, 3}, secondShardData.data()));
+    ASSERT_EQ(gInputHandler.setInput(inputName, secondShard, 1), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    // shard memory may be reused by upstream node once dependency is finished
+    std::fill(secondShardData.begin(), secondShardData.end(), 0);
+    auto firstShard = TensorWithSource(createTensorWithNoDataOwnership(precision, {1, 3}, firstShardData.data()));
+    ASSERT_EQ(gInputHandler.setInput(inputName, firstShard, 0), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    ASSERT_TRUE(gInputHandler.isReady());
+    const auto& tensor = gInputHandler.getInputs().at(inputName);
+    EXPECT_THAT(tensor.get_shape(), ElementsAre(shardsCount, 1, 3));
+    std::vector<float> expected{1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(std::memcmp(tensor.data(), expected.data(), expected.size() * sizeof(float)), 0);
+}
+
+TEST_F(GatherNodeInputHandlerTest, ShardsLaidOutInSourceTensorAreGatheredInPlace) {
+    const std::string inputName{"a"};
+    const session_id_t shardsCount = 3;
+    ov::element::Type_t precision{ov::element::Type_t::f32};
+    ov::Tensor source(precision, {shardsCount, 2});
+    std::iota(source.data<float>(), source.data<float>() + source.get_size(), 0.5);
+    CollapseDetails collapsingDetails{{std::string("NOT_IMPORTANT_DEMULTIPLEXER_NAME")}, {shardsCount}};
+    GatherNodeInputHandler gInputHandler(1, collapsingDetails);
+    for (session_id_t shardId : {2, 0, 1}) {
+        auto shard = TensorWithSource(createTensorWithNoDataOwnership(precision, {1, 2}, source.data<float>() + shardId * 2), source);
+        ASSERT_EQ(gInputHandler.setInput(inputName, shard, shardId), StatusCode::OK);
+        ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    }
+    ASSERT_TRUE(gInputHandler.isReady());
+    const auto& tensor = gInputHandler.getInputs().at(inputName);
+    EXPECT_THAT(tensor.get_shape(), ElementsAre(shardsCount, 1, 2));
+    EXPECT_EQ(tensor.data(), source.data());
+}
+
+TEST_F(GatherNodeInputHandlerTest, ShardOutsideOfSourceTensorSlotIsCopied) {
+    const std::string inputName{"a"};
+    const session_id_t shardsCount = 2;
+    ov::element::Type_t precision{ov::element::Type_t::f32};
+    ov::Tensor source(precision, {shardsCount, 2});
+    std::vector<float> sourceData{1, 2, 3, 4};
+    std::memcpy(source.data(), sourceData.data(), source.get_byte_size());
+    std::vector<float> otherShardData{7, 8};
+    CollapseDetails collapsingDetails{{std::string("NOT_IMPORTANT_DEMULTIPLEXER_NAME")}, {shardsCount}};
+    GatherNodeInputHandler gInputHandler(1, collapsingDetails);
+    auto firstShard = TensorWithSource(createTensorWithNoDataOwnership(precision, {1, 2}, source.data<float>()), source);
+    ASSERT_EQ(gInputHandler.setInput(inputName, firstShard, 0), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    auto secondShard = TensorWithSource(createTensorWithNoDataOwnership(precision, {1, 2}, otherShardData.data()));
+    ASSERT_EQ(gInputHandler.setInput(inputName, secondShard, 1), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    ASSERT_TRUE(gInputHandler.isReady());
+    const auto& tensor = gInputHandler.getInputs().at(inputName);
+    EXPECT_NE(tensor.data(), source.data());
+    std::vector<float> expected{1, 2, 7, 8};
+    EXPECT_EQ(std::memcmp(tensor.data(), expected.data(), expected.size() * sizeof(float)), 0);
+    // upstream tensor must remain untouched
+    EXPECT_EQ(std::memcmp(source.data(), sourceData.data(), source.get_byte_size()), 0);
+}
+
 class GatherNodeTest : public TestWithTempDir {};
 
 static const char* configDummy1BsDummy2Bs = R"(
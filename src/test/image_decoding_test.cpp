@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../image_decoding.hpp"
+#include "opencv2/opencv.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+namespace {
+std::string readImageToString(const std::string& path) {
+    size_t filesize;
+    std::unique_ptr<char[]> imageBytes;
+    readImage(path, filesize, imageBytes);
+    return std::string(imageBytes.get(), filesize);
+}
+
+cv::Mat imdecode(const std::string& data) {
+    std::vector<unsigned char> buffer(data.begin(), data.end());
+    return cv::imdecode(cv::Mat(buffer, true), cv::IMREAD_UNCHANGED);
+}
+
+void expectMatEqual(const cv::Mat& actual, const cv::Mat& expected) {
+    ASSERT_EQ(actual.rows, expected.rows);
+    ASSERT_EQ(actual.cols, expected.cols);
+    ASSERT_EQ(actual.type(), expected.type());
+    EXPECT_EQ(cv::countNonZero(cv::Mat(actual != expected).reshape(1)), 0);
+}
+}  // namespace
+
+TEST(ImageDecoding, JpegMatchesOpenCV) {
+    for (const std::string image : {"rgb.jpg", "rgb2x2.jpg", "rgb4x4.jpg", "grayscale.jpg"}) {
+        SCOPED_TRACE(image);
+        const std::string data = readImageToString("/ovms/src/test/binaryutils/" + image);
+        ASSERT_TRUE(isJpeg(data));
+        cv::Mat decoded = decodeJpeg(data);
+        ASSERT_NE(decoded.data, nullptr);
+        expectMatEqual(decoded, imdecode(data));
+    }
+}
+
+TEST(ImageDecoding, JpegDctScalingNotSmallerThanTarget) {
+    const std::string data = readImageToString("/ovms/src/test/binaryutils/rgb4x4.jpg");
+    const std::vector<std::pair<size_t, size_t>> targetToDecoded{{1, 1}, {2, 2}, {3, 4}, {4, 4}, {8, 4}, {0, 4}};
+    for (const auto& [target, expected] : targetToDecoded) {
+        cv::Mat decoded = decodeJpeg(data, target, target);
+        ASSERT_NE(decoded.data, nullptr);
+        EXPECT_EQ(decoded.rows, expected) << "target: " << target;
+        EXPECT_EQ(decoded.cols, expected) << "target: " << target;
+        EXPECT_EQ(decoded.channels(), 3);
+    }
+    cv::Mat decoded = decodeJpeg(data, 1, 3);
+    EXPECT_EQ(decoded.rows, 4);
+    EXPECT_EQ(decoded.cols, 4);
+}
+
+TEST(ImageDecoding, NonJpegFallsBackToOpenCV) {
+    cv::Mat image(3, 5, CV_8UC3, cv::Scalar(1, 2, 3));
+    std::vector<unsigned char> png;
+    ASSERT_TRUE(cv::imencode(".png", image, png));
+    const std::string data(png.begin(), png.end());
+    EXPECT_FALSE(isJpeg(data));
+    EXPECT_EQ(decodeJpeg(data).data, nullptr);
+    expectMatEqual(decodeImage(data, 1, 1), image);
+}
+
+TEST(ImageDecoding, CorruptedJpeg) {
+    std::string data = readImageToString("/ovms/src/test/binaryutils/rgb.jpg");
+    data.resize(16);
+    EXPECT_EQ(decodeJpeg(data).data, nullptr);
+    EXPECT_EQ(decodeImage(std::string("\xff\xd8\xff", 3)).data, nullptr);
+    EXPECT_EQ(decodeImage("").data, nullptr);
+}
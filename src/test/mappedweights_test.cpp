@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../mappedweights.hpp"
+#include "test_utils.hpp"
+
+using ovms::MappedWeights;
+
+class MappedWeightsTest : public TestWithTempDir {
+protected:
+    void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+};
+
+TEST_F(MappedWeightsTest, SameFileIsMappedOnce) {
+    const std::string path = directoryPath + "/model.bin";
+    writeFile(path, "weights");
+    auto first = MappedWeights::open(path);
+    auto second = MappedWeights::open(path);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->size(), 7);
+    EXPECT_EQ(std::memcmp(first->data(), "weights", 7), 0);
+}
+
+TEST_F(MappedWeightsTest, FileReachedThroughSymlinkSharesMapping) {
+    const std::string path = directoryPath + "/model.bin";
+    const std::string link = directoryPath + "/link.bin";
+    writeFile(path, "weights");
+    std::filesystem::create_symlink(path, link);
+    auto first = MappedWeights::open(path);
+    auto second = MappedWeights::open(link);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(MappedWeightsTest, MappingIsReleasedWithLastUser) {
+    const std::string path = directoryPath + "/model.bin";
+    writeFile(path, "weights");
+    auto before = MappedWeights::getActiveMappingsCount();
+    auto mapping = MappedWeights::open(path);
+    ASSERT_NE(mapping, nullptr);
+    EXPECT_EQ(MappedWeights::getActiveMappingsCount(), before + 1);
+    mapping.reset();
+    EXPECT_EQ(MappedWeights::getActiveMappingsCount(), before);
+}
+
+TEST_F(MappedWeightsTest, ReplacedFileIsMappedSeparately) {
+    const std::string path = directoryPath + "/model.bin";
+    writeFile(path, "weights");
+    auto first = MappedWeights::open(path);
+    std::filesystem::remove(path);
+    writeFile(path, "new weights");
+    auto second = MappedWeights::open(path);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(std::memcmp(first->data(), "weights", 7), 0);
+    EXPECT_EQ(std::memcmp(second->data(), "new weights", 11), 0);
+}
+
+TEST_F(MappedWeightsTest, MissingOrEmptyFileIsNotMapped) {
+    EXPECT_EQ(MappedWeights::open(directoryPath + "/missing.bin"), nullptr);
+    const std::string path = directoryPath + "/empty.bin";
+    writeFile(path, "");
+    EXPECT_EQ(MappedWeights::open(path), nullptr);
+}
@@ -473,6 +473,28 @@ TEST_F(ModelMetricReporterTest, MetricReporterConstructorTest) {
     ASSERT_TRUE(reporter5.requestFailGrpcGetModelMetadata != nullptr);
 }
 
+TEST_F(ModelMetricReporterTest, PrunePipelineNodeTimeRemovesOnlyRemovedNodes) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    ASSERT_EQ(metricConfig.loadFromCLIString(true, METRIC_NAME_PIPELINE_NODE_TIME), StatusCode::OK);
+    ServableMetricReporter reporter(&metricConfig, &registry, "example_pipeline_name", 1);
+    ASSERT_TRUE(reporter.isPipelineNodeTimeEnabled());
+    reporter.observePipelineNodeTime("kept-node", 100);
+    reporter.observePipelineNodeTime("removed-node", 100);
+    auto metrics = registry.collect();
+    ASSERT_THAT(metrics, ::testing::HasSubstr("node=\"kept-node\""));
+    ASSERT_THAT(metrics, ::testing::HasSubstr("node=\"removed-node\""));
+
+    reporter.prunePipelineNodeTime({"kept-node"});
+    metrics = registry.collect();
+    EXPECT_THAT(metrics, ::testing::HasSubstr("node=\"kept-node\""));
+    EXPECT_THAT(metrics, ::testing::Not(::testing::HasSubstr("node=\"removed-node\"")));
+
+    // node added back after reload starts with fresh histogram
+    reporter.observePipelineNodeTime("removed-node", 100);
+    EXPECT_THAT(registry.collect(), ::testing::HasSubstr("node=\"removed-node\""));
+}
+
 class MetricsCli : public ::testing::Test {
 };
 
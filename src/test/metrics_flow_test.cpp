@@ -17,6 +17,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -73,6 +74,15 @@ static void checkRequestsCounter(const std::string& collectedMetricData, const s
     }
 }
 
+template <class W, class R>
+class MockedServerReaderWriter final : public ::grpc::ServerReaderWriterInterface<W, R> {
+public:
+    MOCK_METHOD(void, SendInitialMetadata, (), (override));
+    MOCK_METHOD(bool, NextMessageSize, (uint32_t * sz), (override));
+    MOCK_METHOD(bool, Read, (R * msg), (override));
+    MOCK_METHOD(bool, Write, (const W& msg, ::grpc::WriteOptions options), (override));
+};
+
 class ServableManagerModuleWithMockedManager : public ServableManagerModule {
     ConstructorEnabledModelManager& mockedManager;
 
@@ -215,6 +225,18 @@ TEST_F(MetricFlowTest, GrpcPredict) {
 
     EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(2)));
     EXPECT_THAT(server.collect(), Not(HasSubstr(METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
+
+    // Utilization is observed on each acquisition of inference request, both by model and DAG node requests
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_INFER_REQ_UTILIZATION + std::string{"_count{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests + numberOfSuccessRequests)));
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_INFER_REQ_WAITING + std::string{"{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(0)));
+    EXPECT_THAT(server.collect(), Not(HasSubstr(METRIC_NAME_INFER_REQ_WAITING + std::string{"{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
+
+    // Stages are reported only by direct model requests, DAG reports time of its node sessions
+    for (const std::string stage : {"get_infer_request", "preprocess", "deserialization", "prediction", "serialization", "postprocess"}) {
+        EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_REQUEST_STAGE_TIME + std::string{"_count{name=\""} + modelName + std::string{"\",stage=\""} + stage + std::string{"\",version=\"1\"} "} + std::to_string(numberOfSuccessRequests)));
+    }
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_PIPELINE_NODE_TIME + std::string{"_count{name=\""} + dagName + std::string{"\",node=\"dummy-node\",version=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests)));
+    EXPECT_THAT(server.collect(), Not(HasSubstr(METRIC_NAME_PIPELINE_NODE_TIME + std::string{"_count{name=\""} + modelName + std::string{"\","})));
 }
 
 TEST_F(MetricFlowTest, GrpcGetModelMetadata) {
@@ -330,6 +352,60 @@ TEST_F(MetricFlowTest, GrpcModelInfer) {
     EXPECT_THAT(server.collect(), Not(HasSubstr(METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
 }
 
+TEST_F(MetricFlowTest, GrpcModelStreamInfer) {
+    KFSInferenceServiceImpl impl(server);
+    std::vector<::KFSRequest> requests;
+    std::vector<bool> expectedSuccess;
+    // Model and DAG requests are interleaved, failed requests do not end the stream
+    for (int i = 0; i < numberOfSuccessRequests + numberOfFailedRequests; i++) {
+        const Precision precision = i < numberOfSuccessRequests ? correctPrecision : wrongPrecision;
+        for (const std::string& servableName : {modelName, dagName}) {
+            ::KFSRequest request;
+            inputs_info_t inputsMeta{{DUMMY_MODEL_INPUT_NAME, {servableName == dagName ? ovms::signed_shape_t{dynamicBatch, 1, DUMMY_MODEL_INPUT_SIZE} : DUMMY_MODEL_SHAPE, precision}}};
+            preparePredictRequest(request, inputsMeta);
+            request.mutable_model_name()->assign(servableName);
+            request.set_id(std::to_string(requests.size()));
+            requests.emplace_back(std::move(request));
+            expectedSuccess.push_back(precision == correctPrecision);
+        }
+    }
+
+    MockedServerReaderWriter<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest> stream;
+    size_t nextRequest = 0;
+    std::vector<::inference::ModelStreamInferResponse> responses;
+    EXPECT_CALL(stream, Read(::testing::_))
+        .WillRepeatedly([&requests, &nextRequest](::inference::ModelInferRequest* req) {
+            if (nextRequest == requests.size()) {
+                return false;  // client closes the stream
+            }
+            *req = requests[nextRequest++];
+            return true;
+        });
+    EXPECT_CALL(stream, Write(::testing::_, ::testing::_))
+        .WillRepeatedly([&responses](const ::inference::ModelStreamInferResponse& msg, ::grpc::WriteOptions options) {
+            responses.push_back(msg);
+            return true;
+        });
+    ASSERT_EQ(impl.ModelStreamInferImpl(nullptr, &stream), StatusCode::OK);
+
+    // Responses are delivered in the order of requests
+    ASSERT_EQ(responses.size(), requests.size());
+    for (size_t i = 0; i < responses.size(); i++) {
+        EXPECT_EQ(responses[i].infer_response().id(), requests[i].id());
+        EXPECT_EQ(responses[i].infer_response().model_name(), requests[i].model_name());
+        EXPECT_EQ(responses[i].error_message().empty(), expectedSuccess[i]) << responses[i].error_message();
+    }
+
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_SUCCESS, modelName, 1, "gRPC", "ModelInfer", "KServe", dynamicBatch * numberOfSuccessRequests + numberOfSuccessRequests);  // ran by demultiplexer + real request
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_SUCCESS, dagName, 1, "gRPC", "ModelInfer", "KServe", numberOfSuccessRequests);                                             // ran by real request
+
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_FAIL, modelName, 1, "gRPC", "ModelInfer", "KServe", numberOfFailedRequests);  // ran by real request
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_FAIL, dagName, 1, "gRPC", "ModelInfer", "KServe", numberOfFailedRequests);    // ran by real request
+
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_REQUEST_TIME + std::string{"_count{interface=\"gRPC\",name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(numberOfSuccessRequests)));
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_REQUEST_TIME + std::string{"_count{interface=\"gRPC\",name=\""} + dagName + std::string{"\",version=\"1\"} "} + std::to_string(numberOfSuccessRequests)));
+}
+
 TEST_F(MetricFlowTest, GrpcModelMetadata) {
     KFSInferenceServiceImpl impl(server);
     ::KFSModelMetadataRequest request;
@@ -590,6 +666,8 @@ std::string MetricFlowTest::prepareConfigContent() {
                 "metrics_list": [)"} +
            R"(")" + METRIC_NAME_INFER_REQ_QUEUE_SIZE +
            R"(",")" + METRIC_NAME_INFER_REQ_ACTIVE +
+           R"(",")" + METRIC_NAME_INFER_REQ_WAITING +
+           R"(",")" + METRIC_NAME_INFER_REQ_UTILIZATION +
            R"(",")" + METRIC_NAME_CURRENT_REQUESTS +
            R"(",")" + METRIC_NAME_REQUESTS_SUCCESS +
            R"(",")" + METRIC_NAME_REQUESTS_FAIL +
@@ -597,6 +675,8 @@ std::string MetricFlowTest::prepareConfigContent() {
            R"(",")" + METRIC_NAME_STREAMS +
            R"(",")" + METRIC_NAME_INFERENCE_TIME +
            R"(",")" + METRIC_NAME_WAIT_FOR_INFER_REQ_TIME +
+           R"(",")" + METRIC_NAME_REQUEST_STAGE_TIME +
+           R"(",")" + METRIC_NAME_PIPELINE_NODE_TIME +
            R"("]
             }
         },
@@ -13,8 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <algorithm>
 #include <future>
 #include <memory>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -969,3 +971,48 @@ TEST(MetricsManyOps, MultipleThreads) {
         }
     }
 }
+
+TEST(MetricsManyOps, CollectDuringParallelObservations) {
+    const int numberOfWorkers = 16;
+    const int numberOfOperations = 10000;
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("counter", "desc")->addMetric();
+    auto histogram = registry.createFamily<MetricHistogram>("histogram", "desc")->addMetric({}, {1.0});
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < numberOfWorkers; i++) {
+        workers.emplace_back([&counter, &histogram]() {
+            for (int j = 0; j < numberOfOperations; j++) {
+                counter->increment();
+                histogram->observe(0.5);
+            }
+        });
+    }
+    // Values moved out of shards during collection must not be lost
+    for (int i = 0; i < 100; i++) {
+        registry.collect();
+    }
+    std::for_each(workers.begin(), workers.end(), [](auto& thread) { thread.join(); });
+
+    std::string content = registry.collect();
+    EXPECT_THAT(content, HasSubstr("counter 160000\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_bucket{le=\"1\"} 160000\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_count 160000\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_sum 80000\n"));
+}
+
+TEST(MetricsManyOps, DestroyingMetricsAfterFamilyRemovalIsSafe) {
+    MetricRegistry registry;
+    auto counterFamily = registry.createFamily<MetricCounter>("counter", "desc");
+    auto histogramFamily = registry.createFamily<MetricHistogram>("histogram", "desc");
+    auto counter = counterFamily->addMetric();
+    auto histogram = histogramFamily->addMetric({}, {1.0});
+    counter->increment();
+    histogram->observe(0.5);
+    EXPECT_TRUE(registry.remove(counterFamily));
+    EXPECT_TRUE(registry.remove(histogramFamily));
+    // Pending shard values must not be flushed into removed prometheus metrics
+    counter.reset();
+    histogram.reset();
+    EXPECT_EQ(registry.collect().size(), 0);
+}
@@ -948,6 +948,50 @@ TEST(ModelConfig, ConfigParseNodeWithForbiddenShapeName) {
     EXPECT_EQ(modelConfig.getShapes().size(), 0);
 }
 
+TEST(ModelConfig, ConfigParseNodeWithWarmup) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "warmup": {
+                        "iterations": 3,
+                        "requests_path": "warmup_requests"
+                    }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    EXPECT_FALSE(modelConfig.isWarmupEnabled());
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_TRUE(modelConfig.isWarmupEnabled());
+    EXPECT_EQ(modelConfig.getWarmupIterations(), 3);
+    EXPECT_EQ(modelConfig.getWarmupRequestsPath(), "warmup_requests");
+
+    ovms::ModelConfig otherConfig = modelConfig;
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig.setWarmupIterations(1);
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig = modelConfig;
+    otherConfig.setWarmupRequestsPath("other_warmup_requests");
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+}
+
 TEST(ModelConfig, ConfigParseNodeWithInvalidShapeFormatArray) {
     std::string config = R"#(
         {
@@ -1057,6 +1101,62 @@ TEST(ModelConfig, ConfigParseNodeWithValidShapeFormatArray) {
     EXPECT_EQ(shapes["input"].shape, (ovms::Shape{1, 3, 600, 600}));
 }
 
+TEST(ModelConfig, ConfigParseNodeWithImagePreprocessing) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "image_preprocessing": {
+                "input": {"mean": [123.675, 116.28, 103.53], "scale": 58.4, "color_order": "RGB", "resize": "area"},
+                "mask": {}
+            }
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    ASSERT_FALSE(configJson.Parse(config.c_str()).HasParseError());
+    ovms::ModelConfig modelConfig;
+    ASSERT_EQ(modelConfig.parseNode(configJson), ovms::StatusCode::OK);
+    const auto& imagePreprocessing = modelConfig.getImagePreprocessing();
+    ASSERT_EQ(imagePreprocessing.size(), 2);
+    const auto& input = imagePreprocessing.at("input");
+    EXPECT_EQ(input.mean, (std::vector<float>{123.675f, 116.28f, 103.53f}));
+    EXPECT_EQ(input.scale, std::vector<float>{58.4f});
+    EXPECT_TRUE(input.reverseChannels);
+    EXPECT_EQ(input.resizeAlgorithm, ovms::ResizeAlgorithm::AREA);
+    EXPECT_EQ(imagePreprocessing.at("mask"), ovms::ImagePreprocessing{});
+
+    ovms::ModelConfig otherConfig = modelConfig;
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig.setImagePreprocessing({{"input", {}}});
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+}
+
+TEST(ModelConfig, ShapeCacheSizeChangeRequiresReload) {
+    ovms::ModelConfig modelConfig;
+    ovms::ModelConfig otherConfig = modelConfig;
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig.setShapeCacheSize(2);
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+}
+
+TEST(ModelConfig, ConfigParseNodeWithImagePreprocessingZeroScale) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "image_preprocessing": {
+                "input": {"scale": [1, 0, 1]}
+            }
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    ASSERT_FALSE(configJson.Parse(config.c_str()).HasParseError());
+    ovms::ModelConfig modelConfig;
+    EXPECT_EQ(modelConfig.parseNode(configJson), ovms::StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT);
+}
+
 static std::string config_low_latency_no_stateful = R"#(
     {
     "model_config_list": [
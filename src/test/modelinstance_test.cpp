@@ -72,6 +72,41 @@ TEST_F(TestUnloadModel, SuccessfulUnload) {
     EXPECT_EQ(ovms::ModelVersionState::END, modelInstance.getStatus().getState());
 }
 
+TEST_F(TestUnloadModel, WarmupDurationIsReportedBeforeAvailable) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setWarmupIterations(2);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    ASSERT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+    EXPECT_TRUE(modelInstance.getStatus().getWarmupDuration().has_value());
+    modelInstance.retireModel();
+}
+
+TEST_F(TestUnloadModel, WarmupWithMissingRequestsPathFailsLoading) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setWarmupRequestsPath("/tmp/non_existing_warmup_requests");
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::PATH_INVALID);
+    EXPECT_NE(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+}
+
+TEST_F(TestUnloadModel, WarmupWithInvalidRecordedRequestFailsLoading) {
+    const std::string requestsPath = "/tmp/ovms_warmup_invalid_requests";
+    std::filesystem::remove_all(requestsPath);
+    std::filesystem::create_directories(requestsPath);
+    {
+        // length delimited field truncated after its tag
+        std::ofstream file(requestsPath + "/request.pb", std::ios::binary);
+        file << std::string("\x0a\xff", 2);
+    }
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setWarmupRequestsPath(requestsPath);
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::FILE_INVALID);
+    EXPECT_NE(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+    std::filesystem::remove_all(requestsPath);
+}
+
 TEST_F(TestUnloadModel, SuccessfulUnloadSaved_Model) {
     ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
     ASSERT_EQ(modelInstance.loadModel(DUMMY_SAVED_MODEL_CONFIG), ovms::StatusCode::OK);
@@ -612,6 +647,26 @@ TEST_F(TestLoadModel, UnSuccessfulLoadWhenOutputLayoutIncompatible) {
     EXPECT_EQ(ovms::ModelVersionState::LOADING, modelInstance.getStatus().getState()) << modelInstance.getStatus().getStateString();
 }
 
+TEST_F(TestLoadModel, UnSuccessfulLoadWhenImagePreprocessingMeanDoesNotMatchChannels) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    auto config = INCREMENT_1x3x4x5_MODEL_CONFIG;
+    ovms::ImagePreprocessing preprocessing;
+    preprocessing.mean = {123.675f, 116.28f, 103.53f};
+    config.setImagePreprocessing({{INCREMENT_1x3x4x5_MODEL_INPUT_NAME, preprocessing}});
+    // default layout treats last dimension of 1x3x4x5 as 5 channels
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::CONFIG_IMAGE_PREPROCESSING_WRONG_FORMAT);
+}
+
+TEST_F(TestLoadModel, SuccessfulLoadWhenImagePreprocessingScaleMatchesPlanarChannels) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    auto config = INCREMENT_1x3x4x5_MODEL_CONFIG;
+    config.parseLayoutParameter("nchw");
+    ovms::ImagePreprocessing preprocessing;
+    preprocessing.scale = {58.395f, 57.12f, 57.375f};
+    config.setImagePreprocessing({{INCREMENT_1x3x4x5_MODEL_INPUT_NAME, preprocessing}});
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+}
+
 TEST_F(TestLoadModel, SuccessfulLoadDummyAllDimensionsAny) {
     ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
     ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
@@ -661,6 +716,88 @@ TEST_F(TestLoadModel, ScalarModelWithBatchSetToAuto) {
     ASSERT_EQ(ovms::ModelVersionState::LOADING, modelInstance.getStatus().getState());
 }
 
+TEST_F(TestLoadModel, BatchSizeChangeSwapsCompiledModel) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("auto");
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(modelInstance.waitForLoaded(0, unloadGuard), ovms::StatusCode::OK);
+    auto previousInputInfo = modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME);
+    ASSERT_EQ(modelInstance.reloadModelIfRequired(ovms::StatusCode::BATCHSIZE_CHANGE_REQUIRED, ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    ASSERT_NE(unloadGuard, nullptr);
+    EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape()[0], ovms::Dimension(3));
+    // tensor info of previous compiled model stays valid for requests which still hold it
+    EXPECT_EQ(previousInputInfo->getShape()[0], ovms::Dimension(1));
+    unloadGuard.reset();
+    modelInstance.retireModel();
+}
+
+TEST_F(TestLoadModel, CompiledModelSwapDoesNotWaitForRequestsPinningPreviousSnapshot) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("auto");
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> inProgressGuard;
+    ASSERT_EQ(modelInstance.waitForLoaded(0, inProgressGuard), ovms::StatusCode::OK);
+    std::weak_ptr<const ovms::ModelInstanceSnapshot> previousSnapshot = inProgressGuard->getSnapshot();
+    ASSERT_FALSE(previousSnapshot.expired());
+
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> reloadingGuard;
+    ASSERT_EQ(modelInstance.waitForLoaded(0, reloadingGuard), ovms::StatusCode::OK);
+    ASSERT_EQ(modelInstance.reloadModelIfRequired(ovms::StatusCode::BATCHSIZE_CHANGE_REQUIRED, ovms::Dimension(3), {}, reloadingGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+    EXPECT_NE(reloadingGuard->getSnapshot(), previousSnapshot.lock());
+    EXPECT_EQ(reloadingGuard->getSnapshot()->inputsInfo.at(DUMMY_MODEL_INPUT_NAME)->getShape()[0], ovms::Dimension(3));
+
+    // request in progress keeps using previous compiled model and infer requests
+    ASSERT_FALSE(previousSnapshot.expired());
+    EXPECT_EQ(inProgressGuard->getSnapshot()->inputsInfo.at(DUMMY_MODEL_INPUT_NAME)->getShape()[0], ovms::Dimension(1));
+    EXPECT_EQ(inProgressGuard->getSnapshot()->inferRequestsQueue->getStreamsInUse(), 0);
+    inProgressGuard.reset();
+    EXPECT_TRUE(previousSnapshot.expired());
+    reloadingGuard.reset();
+    modelInstance.retireModel();
+}
+
+TEST_F(TestLoadModel, ShapeCacheReusesCompiledModelForPreviousBatchSize) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("auto");
+    config.setShapeCacheSize(1);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    auto* originalQueue = &modelInstance.getInferRequestsQueue();
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(modelInstance.waitForLoaded(0, unloadGuard), ovms::StatusCode::OK);
+    ASSERT_EQ(modelInstance.reloadModelIfRequired(ovms::StatusCode::BATCHSIZE_CHANGE_REQUIRED, ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_NE(&modelInstance.getInferRequestsQueue(), originalQueue);
+    ASSERT_EQ(modelInstance.reloadModelIfRequired(ovms::StatusCode::BATCHSIZE_CHANGE_REQUIRED, ovms::Dimension(1), {}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(&modelInstance.getInferRequestsQueue(), originalQueue);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape()[0], ovms::Dimension(1));
+    unloadGuard.reset();
+    modelInstance.retireModel();
+}
+
+TEST_F(TestLoadModel, ShapeCacheReusesCompiledModelForPreviousShape) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.parseShapeParameter("auto");
+    config.setShapeCacheSize(1);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    auto originalSnapshot = modelInstance.getSnapshot();
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(modelInstance.waitForLoaded(0, unloadGuard), ovms::StatusCode::OK);
+    ASSERT_EQ(modelInstance.reloadModelIfRequired(ovms::StatusCode::RESHAPE_REQUIRED, std::nullopt, {{DUMMY_MODEL_INPUT_NAME, {1, 20}}}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_NE(modelInstance.getSnapshot(), originalSnapshot);
+    ASSERT_EQ(modelInstance.reloadModelIfRequired(ovms::StatusCode::RESHAPE_REQUIRED, std::nullopt, {{DUMMY_MODEL_INPUT_NAME, {1, 10}}}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getSnapshot(), originalSnapshot);
+    EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+    unloadGuard.reset();
+    originalSnapshot.reset();
+    modelInstance.retireModel();
+}
+
 class TestLoadModelWithMapping : public TestLoadModel {
 protected:
     void SetUp() override {
@@ -131,3 +131,26 @@ TEST(OVInferRequestQueue, AsyncGetInferRequest) {
     const int secondStreamId = secondStreamRequest.get();
     EXPECT_EQ(firstStreamId, secondStreamId);
 }
+
+TEST(OVInferRequestQueue, StreamsInUse) {
+    ov::Core ieCore;
+    auto model = ieCore.read_model(DUMMY_MODEL_PATH);
+    ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
+    ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, 2);
+    EXPECT_EQ(inferRequestsQueue.getStreamsInUse(), 0);
+
+    const int firstStreamId = inferRequestsQueue.getIdleStream().get();
+    auto secondStreamId = inferRequestsQueue.tryToGetIdleStream();
+    ASSERT_TRUE(secondStreamId.has_value());
+    EXPECT_EQ(inferRequestsQueue.getStreamsInUse(), 2);
+
+    // Stream returned while other request waits is handed over directly
+    std::future<int> waitingStreamRequest = inferRequestsQueue.getIdleStream();
+    inferRequestsQueue.returnStream(firstStreamId);
+    EXPECT_EQ(waitingStreamRequest.get(), firstStreamId);
+    EXPECT_EQ(inferRequestsQueue.getStreamsInUse(), 2);
+
+    inferRequestsQueue.returnStream(firstStreamId);
+    inferRequestsQueue.returnStream(secondStreamId.value());
+    EXPECT_EQ(inferRequestsQueue.getStreamsInUse(), 0);
+}
@@ -161,6 +161,12 @@ TEST_F(OvmsConfigDeathTest, metricEnableMissing) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "metrics_enable setting is missing, required when metrics_list is provided");
 }
 
+TEST_F(OvmsConfigDeathTest, traceExportPathMissing) {
+    char* n_argv[] = {"ovms", "--model_path", "/path/to/model", "--model_name", "some_name", "--trace_sample_rate", "100"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "trace_export_path setting is missing, required when trace_sample_rate is provided");
+}
+
 TEST_F(OvmsConfigDeathTest, metricEnablingInCli) {
     char* n_argv[] = {"ovms", "--config_path", "/path/to/config", "--metrics_enable"};
     int arg_count = 4;
@@ -263,6 +269,12 @@ TEST_F(OvmsConfigDeathTest, negativeGrpcWorkersMax) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_workers count should be from 1");
 }
 
+TEST_F(OvmsConfigDeathTest, negativeGrpcStreamMaxInFlightZero) {
+    char* n_argv[] = {"ovms", "--model_path", "/path1", "--model_name", "model", "--grpc_stream_max_in_flight", "0"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_stream_max_in_flight should be greater than 0");
+}
+
 TEST_F(OvmsConfigDeathTest, cpuExtensionMissingPath) {
     char* n_argv[] = {"ovms", "--model_path", "/path1", "--model_name", "model", "--cpu_extension", "/wrong/dir"};
     int arg_count = 7;
@@ -345,8 +357,9 @@ TEST(OvmsConfigTest, positiveMulti) {
         "--log_level", "ERROR",
         "--grpc_max_threads", "100",
         "--grpc_memory_quota", "1000000",
+        "--grpc_stream_max_in_flight", "8",
         "--config_path", "/config.json"};
-    int arg_count = 35;
+    int arg_count = 37;
     ConstructorEnabledConfig config;
     config.parse(arg_count, n_argv);
 
@@ -367,6 +380,7 @@ TEST(OvmsConfigTest, positiveMulti) {
     EXPECT_EQ(config.configPath(), "/config.json");
     EXPECT_EQ(config.grpcMaxThreads(), 100);
     EXPECT_EQ(config.grpcMemoryQuota(), (size_t)1000000);
+    EXPECT_EQ(config.grpcStreamMaxInFlight(), 8);
 }
 
 TEST(OvmsConfigTest, positiveSingle) {
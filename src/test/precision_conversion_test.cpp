@@ -0,0 +1,303 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <openvino/core/type/float16.hpp>
+
+#include "../deserialization.hpp"
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../modelconfig.hpp"
+#include "../precision_conversion.hpp"
+#include "../predict_request_validation_utils.hpp"
+#include "../status.hpp"
+#include "../tensorinfo.hpp"
+#include "test_utils.hpp"
+
+using ovms::convertPrecision;
+using ovms::Precision;
+
+namespace {
+// Covers empty input, tails shorter than SIMD block and multiple blocks
+const std::vector<size_t> CONVERSION_LENGTHS{0, 1, 7, 8, 9, 15, 16, 17, 33, 100, 1023};
+
+std::vector<float> prepareFp32Data(size_t count) {
+    std::vector<float> data(count);
+    for (size_t i = 0; i < count; i++) {
+        data[i] = (static_cast<float>(i) - count / 2.0f) * 0.37f;
+    }
+    return data;
+}
+
+uint16_t toBf16Bits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+float fromBf16Bits(uint16_t value) {
+    uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+}  // namespace
+
+TEST(PrecisionConversion, SupportedConversions) {
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(Precision::FP16, Precision::FP32));
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(Precision::BF16, Precision::FP32));
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(Precision::U8, Precision::FP32));
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(Precision::FP32, Precision::FP16));
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(Precision::FP32, Precision::BF16));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(Precision::FP32, Precision::FP32));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(Precision::FP16, Precision::BF16));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(Precision::I32, Precision::FP32));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(Precision::FP32, Precision::U8));
+}
+
+TEST(PrecisionConversion, UnsupportedConversionReturnsError) {
+    int32_t src = 1;
+    float dst = 0;
+    EXPECT_EQ(convertPrecision(&src, Precision::I32, &dst, Precision::FP32, 1), ovms::StatusCode::INVALID_PRECISION);
+}
+
+TEST(PrecisionConversion, Fp16ToFp32) {
+    for (size_t count : CONVERSION_LENGTHS) {
+        auto expected = prepareFp32Data(count);
+        std::vector<uint16_t> src(count);
+        for (size_t i = 0; i < count; i++) {
+            src[i] = ov::float16(expected[i]).to_bits();
+            expected[i] = static_cast<float>(ov::float16::from_bits(src[i]));
+        }
+        std::vector<float> dst(count, -1.0f);
+        ASSERT_EQ(convertPrecision(src.data(), Precision::FP16, dst.data(), Precision::FP32, count), ovms::StatusCode::OK);
+        EXPECT_EQ(dst, expected) << "count: " << count;
+    }
+}
+
+TEST(PrecisionConversion, Fp32ToFp16) {
+    for (size_t count : CONVERSION_LENGTHS) {
+        auto src = prepareFp32Data(count);
+        std::vector<uint16_t> expected(count);
+        for (size_t i = 0; i < count; i++) {
+            expected[i] = ov::float16(src[i]).to_bits();
+        }
+        std::vector<uint16_t> dst(count, 0xFFFF);
+        ASSERT_EQ(convertPrecision(src.data(), Precision::FP32, dst.data(), Precision::FP16, count), ovms::StatusCode::OK);
+        EXPECT_EQ(dst, expected) << "count: " << count;
+    }
+}
+
+TEST(PrecisionConversion, Bf16ToFp32) {
+    for (size_t count : CONVERSION_LENGTHS) {
+        auto values = prepareFp32Data(count);
+        std::vector<uint16_t> src(count);
+        std::vector<float> expected(count);
+        for (size_t i = 0; i < count; i++) {
+            src[i] = toBf16Bits(values[i]);
+            expected[i] = fromBf16Bits(src[i]);
+        }
+        std::vector<float> dst(count, -1.0f);
+        ASSERT_EQ(convertPrecision(src.data(), Precision::BF16, dst.data(), Precision::FP32, count), ovms::StatusCode::OK);
+        EXPECT_EQ(dst, expected) << "count: " << count;
+    }
+}
+
+TEST(PrecisionConversion, Fp32ToBf16RoundsToNearestEven) {
+    // 1.0 + 2^-8 is a tie between 1.0 and 1.0 + 2^-7, rounded to even 1.0
+    // 1.0 + 3 * 2^-8 is a tie rounded to even 1.0 + 2^-6
+    // 1.0 + 2^-8 + 2^-20 is above tie and rounded up
+    const std::vector<float> src{1.0f + std::ldexp(1.0f, -8), 1.0f + 3 * std::ldexp(1.0f, -8), 1.0f + std::ldexp(1.0f, -8) + std::ldexp(1.0f, -20),
+        -2.5f, 0.0f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 65504.0f, 1e-40f};
+    std::vector<uint16_t> dst(src.size());
+    ASSERT_EQ(convertPrecision(src.data(), Precision::FP32, dst.data(), Precision::BF16, src.size()), ovms::StatusCode::OK);
+    EXPECT_EQ(fromBf16Bits(dst[0]), 1.0f);
+    EXPECT_EQ(fromBf16Bits(dst[1]), 1.0f + std::ldexp(1.0f, -6));
+    EXPECT_EQ(fromBf16Bits(dst[2]), 1.0f + std::ldexp(1.0f, -7));
+    EXPECT_EQ(fromBf16Bits(dst[3]), -2.5f);
+    EXPECT_EQ(fromBf16Bits(dst[4]), 0.0f);
+    EXPECT_EQ(fromBf16Bits(dst[5]), std::numeric_limits<float>::infinity());
+    EXPECT_TRUE(std::isnan(fromBf16Bits(dst[6])));
+    EXPECT_EQ(fromBf16Bits(dst[7]), 65536.0f);
+    EXPECT_EQ(dst[8], toBf16Bits(1e-40f));
+}
+
+TEST(PrecisionConversion, U8ToFp32WithScale) {
+    const float scale = 1.0f / 255;
+    for (size_t count : CONVERSION_LENGTHS) {
+        std::vector<uint8_t> src(count);
+        std::vector<float> expected(count);
+        for (size_t i = 0; i < count; i++) {
+            src[i] = static_cast<uint8_t>(i * 7);
+            expected[i] = static_cast<float>(src[i]) * scale;
+        }
+        std::vector<float> dst(count, -1.0f);
+        ASSERT_EQ(convertPrecision(src.data(), Precision::U8, dst.data(), Precision::FP32, count, scale), ovms::StatusCode::OK);
+        EXPECT_EQ(dst, expected) << "count: " << count;
+    }
+}
+
+TEST(PrecisionConversion, ParseAcceptedPrecisions) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "accepted_precisions": {
+                "b": {"precisions": ["FP16", "BF16"]},
+                "c": {"precisions": ["U8"], "scale": 0.5}
+            }
+        }
+    )#";
+    rapidjson::Document configJson;
+    ASSERT_FALSE(configJson.Parse(config.c_str()).HasParseError());
+    ovms::ModelConfig modelConfig;
+    ASSERT_EQ(modelConfig.parseNode(configJson), ovms::StatusCode::OK);
+    const auto& acceptedPrecisions = modelConfig.getAcceptedPrecisions();
+    ASSERT_EQ(acceptedPrecisions.size(), 2);
+    EXPECT_EQ(acceptedPrecisions.at("b").precisions, (std::vector<Precision>{Precision::FP16, Precision::BF16}));
+    EXPECT_EQ(acceptedPrecisions.at("b").scale, 1.0f);
+    EXPECT_EQ(acceptedPrecisions.at("c").precisions, std::vector<Precision>{Precision::U8});
+    EXPECT_EQ(acceptedPrecisions.at("c").scale, 0.5f);
+
+    ovms::ModelConfig otherConfig = modelConfig;
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig.setAcceptedPrecisions({{"b", {{Precision::FP16}, 1.0f}}});
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+}
+
+TEST(PrecisionConversion, ParseAcceptedPrecisionsWithInvalidPrecision) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "accepted_precisions": {
+                "b": {"precisions": ["FP17"]}
+            }
+        }
+    )#";
+    rapidjson::Document configJson;
+    ASSERT_FALSE(configJson.Parse(config.c_str()).HasParseError());
+    ovms::ModelConfig modelConfig;
+    EXPECT_EQ(modelConfig.parseNode(configJson), ovms::StatusCode::CONFIG_ACCEPTED_PRECISIONS_WRONG_FORMAT);
+}
+
+class AcceptedPrecisionsKFS : public ::testing::Test {
+protected:
+    const std::string inputName{"b"};
+    ovms::tensor_map_t inputsInfo;
+    ::KFSRequest request;
+
+    void SetUp() override {
+        inputsInfo[inputName] = std::make_shared<ovms::TensorInfo>(inputName, Precision::FP32, ovms::shape_t{1, 10}, ovms::Layout{"NC"})
+                                    ->createCopyWithAcceptedPrecisions({Precision::FP16, Precision::BF16, Precision::U8}, 0.5f);
+    }
+
+    void prepareRequest(const std::string& datatype, const void* data, size_t byteSize) {
+        request.Clear();
+        auto* input = request.add_inputs();
+        input->set_name(inputName);
+        input->set_datatype(datatype);
+        input->add_shape(1);
+        input->add_shape(10);
+        request.add_raw_input_contents()->assign(reinterpret_cast<const char*>(data), byteSize);
+    }
+
+    ovms::Status validate() {
+        ovms::request_validation_utils::ValidationPlan plan(inputsInfo, {});
+        return ovms::request_validation_utils::validate(request, plan, "dummy", ovms::model_version_t{1});
+    }
+};
+
+TEST_F(AcceptedPrecisionsKFS, ValidatesContentSizeWithRequestPrecision) {
+    std::vector<uint16_t> data(10);
+    prepareRequest("FP16", data.data(), data.size() * sizeof(uint16_t));
+    EXPECT_EQ(validate(), ovms::StatusCode::OK);
+    prepareRequest("BF16", data.data(), data.size() * sizeof(uint16_t));
+    EXPECT_EQ(validate(), ovms::StatusCode::OK);
+    prepareRequest("FP16", data.data(), data.size() * sizeof(uint16_t) / 2);
+    EXPECT_EQ(validate(), ovms::StatusCode::INVALID_CONTENT_SIZE);
+    std::vector<float> fp32Data(10);
+    prepareRequest("FP32", fp32Data.data(), fp32Data.size() * sizeof(float));
+    EXPECT_EQ(validate(), ovms::StatusCode::OK);
+}
+
+TEST_F(AcceptedPrecisionsKFS, RejectsNotAcceptedPrecision) {
+    std::vector<int32_t> data(10);
+    prepareRequest("INT32", data.data(), data.size() * sizeof(int32_t));
+    EXPECT_EQ(validate(), ovms::StatusCode::INVALID_PRECISION);
+}
+
+TEST_F(AcceptedPrecisionsKFS, RejectsConversionOfTensorContents) {
+    request.Clear();
+    auto* input = request.add_inputs();
+    input->set_name(inputName);
+    input->set_datatype("UINT8");
+    input->add_shape(1);
+    input->add_shape(10);
+    for (size_t i = 0; i < 10; i++) {
+        input->mutable_contents()->add_uint_contents(i);
+    }
+    EXPECT_EQ(validate(), ovms::StatusCode::INVALID_PRECISION);
+}
+
+TEST_F(AcceptedPrecisionsKFS, DeserializesIntoModelPrecision) {
+    std::vector<uint16_t> bf16Data(10);
+    std::vector<uint8_t> u8Data(10);
+    for (size_t i = 0; i < 10; i++) {
+        bf16Data[i] = toBf16Bits(static_cast<float>(i) - 4.5f);
+        u8Data[i] = static_cast<uint8_t>(i * 20);
+    }
+    prepareRequest("BF16", bf16Data.data(), bf16Data.size() * sizeof(uint16_t));
+    ov::Tensor tensor = ovms::deserializeTensorProto<ovms::ConcreteTensorProtoDeserializator>(request.inputs(0), inputsInfo[inputName], &request.raw_input_contents(0));
+    ASSERT_TRUE((bool)tensor);
+    ASSERT_EQ(tensor.get_element_type(), ov::element::f32);
+    ASSERT_EQ(tensor.get_shape(), (ov::Shape{1, 10}));
+    for (size_t i = 0; i < 10; i++) {
+        EXPECT_EQ(tensor.data<float>()[i], static_cast<float>(i) - 4.5f);
+    }
+
+    prepareRequest("UINT8", u8Data.data(), u8Data.size());
+    tensor = ovms::deserializeTensorProto<ovms::ConcreteTensorProtoDeserializator>(request.inputs(0), inputsInfo[inputName], &request.raw_input_contents(0));
+    ASSERT_TRUE((bool)tensor);
+    for (size_t i = 0; i < 10; i++) {
+        EXPECT_EQ(tensor.data<float>()[i], i * 20 * 0.5f);
+    }
+}
+
+TEST(AcceptedPrecisionsTFS, DeserializesHalfValues) {
+    auto tensorInfo = std::make_shared<ovms::TensorInfo>("b", Precision::FP32, ovms::shape_t{1, 3}, ovms::Layout{"NC"})
+                          ->createCopyWithAcceptedPrecisions({Precision::FP16}, 1.0f);
+    tensorflow::TensorProto proto;
+    proto.set_dtype(tensorflow::DataType::DT_HALF);
+    proto.mutable_tensor_shape()->add_dim()->set_size(1);
+    proto.mutable_tensor_shape()->add_dim()->set_size(3);
+    const std::vector<float> expected{1.5f, -2.0f, 0.25f};
+    for (float value : expected) {
+        proto.add_half_val(ov::float16(value).to_bits());
+    }
+    ov::Tensor tensor = ovms::deserializeTensorProto<ovms::ConcreteTensorProtoDeserializator>(proto, tensorInfo);
+    ASSERT_TRUE((bool)tensor);
+    ASSERT_EQ(tensor.get_element_type(), ov::element::f32);
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(tensor.data<float>()[i], expected[i]);
+    }
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <string>
 
 #include <gmock/gmock.h>
@@ -2111,4 +2112,73 @@ TYPED_TEST(PredictValidationStringNativeTest, string_not_allowed_with_demultiple
     EXPECT_EQ(status, ovms::StatusCode::INVALID_NO_OF_SHAPE_DIMENSIONS);
 }
 
+class ValidationPlanTest : public ::testing::Test {
+protected:
+    static constexpr size_t INPUTS_COUNT = 20;
+    ovms::tensor_map_t inputsInfo;
+    ::KFSRequest request;
+
+    void SetUp() override {
+        inputs_info_t requestInputs;
+        for (size_t i = 0; i < INPUTS_COUNT; i++) {
+            const std::string name = "input_" + std::to_string(i);
+            inputsInfo[name] = std::make_shared<ovms::TensorInfo>(name, ovms::Precision::FP32, ovms::shape_t{1, 3, 8, 8}, ovms::Layout{"NCHW"});
+            requestInputs[name] = std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, 3, 8, 8}, ovms::Precision::FP32};
+        }
+        preparePredictRequest(request, requestInputs);
+    }
+};
+
+TEST_F(ValidationPlanTest, FindsEveryInputAndRejectsUnknownNames) {
+    ovms::request_validation_utils::ValidationPlan plan(inputsInfo, {});
+    ASSERT_EQ(plan.getInputs().size(), INPUTS_COUNT);
+    for (size_t i = 0; i < INPUTS_COUNT; i++) {
+        const std::string name = "input_" + std::to_string(i);
+        size_t index = plan.find(name);
+        ASSERT_NE(index, ovms::request_validation_utils::ValidationPlan::NOT_FOUND) << name;
+        EXPECT_EQ(plan.getInputs()[index].name, name);
+    }
+    EXPECT_EQ(plan.find("input_20"), ovms::request_validation_utils::ValidationPlan::NOT_FOUND);
+    EXPECT_EQ(plan.find("input_"), ovms::request_validation_utils::ValidationPlan::NOT_FOUND);
+    EXPECT_EQ(plan.find(""), ovms::request_validation_utils::ValidationPlan::NOT_FOUND);
+}
+
+TEST_F(ValidationPlanTest, PrecomputesInputsData) {
+    inputsInfo["dynamic"] = std::make_shared<ovms::TensorInfo>("dynamic", ovms::Precision::U8, ovms::Shape{ovms::Dimension::any(), 10}, ovms::Layout{"N..."});
+    ovms::shapes_info_map_t shapes;
+    shapes["dynamic"].shapeMode = ovms::Mode::AUTO;
+    ovms::request_validation_utils::ValidationPlan plan(inputsInfo, shapes);
+    const auto& staticInput = plan.getInputs()[plan.find("input_0")];
+    EXPECT_EQ(staticInput.kfsDatatype, "FP32");
+    EXPECT_EQ(staticInput.itemsize, sizeof(float));
+    EXPECT_EQ(staticInput.shapeMode, ovms::Mode::FIXED);
+    ASSERT_TRUE(staticInput.staticValueCount.has_value());
+    EXPECT_EQ(staticInput.staticValueCount.value(), 3 * 8 * 8);
+    const auto& dynamicInput = plan.getInputs()[plan.find("dynamic")];
+    EXPECT_EQ(dynamicInput.kfsDatatype, "UINT8");
+    EXPECT_EQ(dynamicInput.shapeMode, ovms::Mode::AUTO);
+    EXPECT_FALSE(dynamicInput.staticValueCount.has_value());
+}
+
+TEST_F(ValidationPlanTest, ValidatesRequestWithInputsInAnyOrder) {
+    ovms::request_validation_utils::ValidationPlan plan(inputsInfo, {});
+    std::reverse(request.mutable_inputs()->begin(), request.mutable_inputs()->end());
+    std::reverse(request.mutable_raw_input_contents()->begin(), request.mutable_raw_input_contents()->end());
+    auto status = ovms::request_validation_utils::validate(request, plan, "dummy", ovms::model_version_t{1});
+    EXPECT_TRUE(status.ok()) << status.string();
+
+    request.mutable_inputs(0)->set_name("unknown");
+    status = ovms::request_validation_utils::validate(request, plan, "dummy", ovms::model_version_t{1});
+    EXPECT_EQ(status, ovms::StatusCode::INVALID_MISSING_INPUT) << status.string();
+}
+
+TEST_F(ValidationPlanTest, ReportsSameErrorsAsValidationWithInputsInfo) {
+    ovms::request_validation_utils::ValidationPlan plan(inputsInfo, {});
+    request.mutable_raw_input_contents(5)->resize(10);
+    auto planStatus = ovms::request_validation_utils::validate(request, plan, "dummy", ovms::model_version_t{1});
+    auto status = ovms::request_validation_utils::validate(request, inputsInfo, "dummy", ovms::model_version_t{1});
+    EXPECT_EQ(planStatus, ovms::StatusCode::INVALID_CONTENT_SIZE);
+    EXPECT_EQ(planStatus.string(), status.string());
+}
+
 #pragma GCC diagnostic pop
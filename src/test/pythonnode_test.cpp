@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <csignal>
 #include <filesystem>
 #include <fstream>
 #include <set>
@@ -37,7 +38,10 @@
 #include "../metric_module.hpp"
 #include "../model_service.hpp"
 #include "../precision.hpp"
+#include "../python/ovms_py_tensor.hpp"
 #include "../python/pythoninterpretermodule.hpp"
+#include "../python/pyobject_tensor_allocator.hpp"
+#include "../python/python_worker_pool.hpp"
 #include "../python/pythonnoderesources.hpp"
 #include "../servablemanagermodule.hpp"
 #include "../server.hpp"
@@ -1073,6 +1077,179 @@ TEST_F(PythonFlowTest, PythonCalculatorTestSingleInSingleOut) {
     checkDummyResponse("output", data, req, res, 1 /* expect +1 */, 1, "mediaDummy");
 }
 
+static const std::string WORKER_PROCESSES_PBTXT = R"(
+    input_stream: "OVMS_PY_TENSOR:input"
+    output_stream: "OVMS_PY_TENSOR:output"
+        node {
+            name: "pythonNode"
+            calculator: "PythonExecutorCalculator"
+            input_side_packet: "PYTHON_NODE_RESOURCES:py"
+            input_stream: "INPUT:input"
+            output_stream: "OUTPUT:output"
+            node_options: {
+                [type.googleapis.com / mediapipe.PythonExecutorCalculatorOptions]: {
+                    handler_path: "/ovms/src/test/mediapipe/python/scripts/symmetric_increment.py"
+                    worker_processes: 2
+                }
+            }
+        }
+    )";
+
+TEST_F(PythonFlowTest, PythonCalculatorTestSingleInSingleOutInWorkerProcesses) {
+    ConstructorEnabledModelManager manager{"", getPythonBackend()};
+    ovms::MediapipeGraphConfig mgc{"mediaDummy", "", ""};
+    DummyMediapipeGraphDefinition mediapipeDummy("mediaDummy", mgc, WORKER_PROCESSES_PBTXT, getPythonBackend());
+    mediapipeDummy.inputConfig = WORKER_PROCESSES_PBTXT;
+    ASSERT_EQ(mediapipeDummy.validate(manager), StatusCode::OK);
+    auto* nodeResources = mediapipeDummy.getPythonNodeResources("pythonNode");
+    ASSERT_NE(nodeResources, nullptr);
+    ASSERT_NE(nodeResources->workerPool, nullptr);
+    EXPECT_EQ(nodeResources->ovmsPythonModel, nullptr);
+    EXPECT_EQ(nodeResources->workerPool->getAliveWorkersCount(), 2);
+
+    const std::vector<float> data{1.0f, 20.0f, 3.0f, 1.0f, 20.0f, 3.0f, 1.0f, 20.0f, 3.0f, -5.0f};
+    std::vector<std::thread> clients;
+    for (int i = 0; i < 4; i++) {
+        clients.emplace_back([this, &mediapipeDummy, &data]() {
+            std::shared_ptr<MediapipeGraphExecutor> pipeline;
+            ASSERT_EQ(mediapipeDummy.create(pipeline, nullptr, nullptr), StatusCode::OK);
+            KFSRequest req;
+            KFSResponse res;
+            req.set_model_name("mediaDummy");
+            prepareKFSInferInputTensor(req, "input", std::tuple<ovms::signed_shape_t, const ovms::Precision>{{1, DUMMY_MODEL_OUTPUT_SIZE}, ovms::Precision::FP32}, data, false);
+            ServableMetricReporter* smr{nullptr};
+            ASSERT_EQ(pipeline->infer(&req, &res, this->defaultExecutionContext, smr), StatusCode::OK);
+            checkDummyResponse("output", data, req, res, 1 /* expect +1 */, 1, "mediaDummy");
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+}
+
+TEST_F(PythonFlowTest, PythonNodeWorkerProcessIsRestartedAfterCrash) {
+    ConstructorEnabledModelManager manager{"", getPythonBackend()};
+    ovms::MediapipeGraphConfig mgc{"mediaDummy", "", ""};
+    DummyMediapipeGraphDefinition mediapipeDummy("mediaDummy", mgc, WORKER_PROCESSES_PBTXT, getPythonBackend());
+    mediapipeDummy.inputConfig = WORKER_PROCESSES_PBTXT;
+    ASSERT_EQ(mediapipeDummy.validate(manager), StatusCode::OK);
+    auto& workerPool = *mediapipeDummy.getPythonNodeResources("pythonNode")->workerPool;
+    for (pid_t pid : workerPool.getWorkerPids()) {
+        ASSERT_GT(pid, 0);
+        ASSERT_EQ(kill(pid, SIGKILL), 0);
+    }
+
+    // Dead workers are detected on acquisition and request waits until one of them is restarted
+    std::shared_ptr<MediapipeGraphExecutor> pipeline;
+    ASSERT_EQ(mediapipeDummy.create(pipeline, nullptr, nullptr), StatusCode::OK);
+    KFSRequest req;
+    KFSResponse res;
+    const std::vector<float> data{1.0f, 20.0f, 3.0f, 1.0f, 20.0f, 3.0f, 1.0f, 20.0f, 3.0f, -5.0f};
+    req.set_model_name("mediaDummy");
+    prepareKFSInferInputTensor(req, "input", std::tuple<ovms::signed_shape_t, const ovms::Precision>{{1, DUMMY_MODEL_OUTPUT_SIZE}, ovms::Precision::FP32}, data, false);
+    ServableMetricReporter* smr{nullptr};
+    ASSERT_EQ(pipeline->infer(&req, &res, this->defaultExecutionContext, smr), StatusCode::OK);
+    checkDummyResponse("output", data, req, res, 1 /* expect +1 */, 1, "mediaDummy");
+    EXPECT_GE(workerPool.getRestartsCount(), 1);
+}
+
+TEST_F(PythonFlowTest, PythonNodeWorkerProcessIsRestartedAfterExecuteTimeout) {
+    ConstructorEnabledModelManager manager{"", getPythonBackend()};
+    std::string testPbtxt = R"(
+    input_stream: "OVMS_PY_TENSOR:input"
+    output_stream: "OVMS_PY_TENSOR:output"
+        node {
+            name: "pythonNode"
+            calculator: "PythonExecutorCalculator"
+            input_side_packet: "PYTHON_NODE_RESOURCES:py"
+            input_stream: "INPUT:input"
+            output_stream: "OUTPUT:output"
+            node_options: {
+                [type.googleapis.com / mediapipe.PythonExecutorCalculatorOptions]: {
+                    handler_path: "/ovms/src/test/mediapipe/python/scripts/bad_execute_sleep.py"
+                    worker_processes: 1
+                    worker_execute_timeout_ms: 500
+                }
+            }
+        }
+    )";
+    ovms::MediapipeGraphConfig mgc{"mediaDummy", "", ""};
+    DummyMediapipeGraphDefinition mediapipeDummy("mediaDummy", mgc, testPbtxt, getPythonBackend());
+    mediapipeDummy.inputConfig = testPbtxt;
+    ASSERT_EQ(mediapipeDummy.validate(manager), StatusCode::OK);
+    auto& workerPool = *mediapipeDummy.getPythonNodeResources("pythonNode")->workerPool;
+    const pid_t pidBefore = workerPool.getWorkerPids()[0];
+
+    std::shared_ptr<MediapipeGraphExecutor> pipeline;
+    ASSERT_EQ(mediapipeDummy.create(pipeline, nullptr, nullptr), StatusCode::OK);
+    KFSRequest req;
+    KFSResponse res;
+    const std::vector<float> data{1.0f, 20.0f, 3.0f, 1.0f, 20.0f, 3.0f, 1.0f, 20.0f, 3.0f, -5.0f};
+    req.set_model_name("mediaDummy");
+    prepareKFSInferInputTensor(req, "input", std::tuple<ovms::signed_shape_t, const ovms::Precision>{{1, DUMMY_MODEL_OUTPUT_SIZE}, ovms::Precision::FP32}, data, false);
+    ServableMetricReporter* smr{nullptr};
+    ASSERT_EQ(pipeline->infer(&req, &res, this->defaultExecutionContext, smr), StatusCode::MEDIAPIPE_EXECUTION_ERROR);
+
+    // Worker exceeding timeout is killed and restarted in the background
+    for (int i = 0; i < 100 && workerPool.getRestartsCount() == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    EXPECT_EQ(workerPool.getRestartsCount(), 1);
+    EXPECT_EQ(workerPool.getAliveWorkersCount(), 1);
+    EXPECT_NE(workerPool.getWorkerPids()[0], pidBefore);
+}
+
+TEST_F(PythonFlowTest, PythonWorkerPoolShutdownWaitsForExecutionInProgress) {
+    PythonWorkerPool workerPool("/ovms/src/test/mediapipe/python/scripts/slow_execute.py", "{}", 1, "python3");
+    ASSERT_EQ(workerPool.start(), StatusCode::OK);
+    const std::vector<float> data{1.0f, 20.0f, 3.0f};
+    std::vector<PythonWorkerOutput> outputs;
+    Status executeStatus;
+    std::thread client([&workerPool, &data, &outputs, &executeStatus]() {
+        std::vector<PythonWorkerInput> inputs{{"input", "FP32", {1, 3}, data.data(), data.size() * sizeof(float)}};
+        executeStatus = workerPool.execute(inputs, outputs);
+    });
+    // Handler sleeps in execute, so shutdown starts while worker is busy
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    workerPool.shutdown();
+    client.join();
+    EXPECT_EQ(executeStatus, StatusCode::OK) << executeStatus.string();
+    ASSERT_EQ(outputs.size(), 1);
+    EXPECT_EQ(outputs[0].size, data.size() * sizeof(float));
+    EXPECT_EQ(workerPool.getAliveWorkersCount(), 0);
+}
+
+TEST_F(PythonFlowTest, PythonNodeLoopbackNotSupportedInWorkerProcesses) {
+    ConstructorEnabledModelManager manager;
+    std::string testPbtxt = R"(
+    input_stream: "OVMS_PY_TENSOR:input"
+    output_stream: "OVMS_PY_TENSOR:output"
+        node {
+            name: "pythonNode"
+            calculator: "PythonExecutorCalculator"
+            input_side_packet: "PYTHON_NODE_RESOURCES:py"
+            input_stream: "INPUT:input"
+            input_stream: "LOOPBACK:loopback"
+            input_stream_info: {
+                tag_index: 'LOOPBACK:0',
+                back_edge: true
+            }
+            output_stream: "OUTPUT:output"
+            output_stream: "LOOPBACK:loopback"
+            node_options: {
+                [type.googleapis.com / mediapipe.PythonExecutorCalculatorOptions]: {
+                    handler_path: "/ovms/src/test/mediapipe/python/scripts/symmetric_increment.py"
+                    worker_processes: 1
+                }
+            }
+        }
+    )";
+    ovms::MediapipeGraphConfig mgc{"mediaDummy", "", ""};
+    DummyMediapipeGraphDefinition mediapipeDummy("mediaDummy", mgc, testPbtxt, getPythonBackend());
+    mediapipeDummy.inputConfig = testPbtxt;
+    ASSERT_EQ(mediapipeDummy.validate(manager), StatusCode::PYTHON_NODE_FILE_STATE_INITIALIZATION_FAILED);
+}
+
 TEST_F(PythonFlowTest, PythonCalculatorTestReturnCustomDatatype) {
     ConstructorEnabledModelManager manager{"", getPythonBackend()};
     std::string testPbtxt = R"(
@@ -1371,6 +1548,56 @@ TEST_F(PythonFlowTest, PythonCalculatorTestSingleInSingleOutMultiNodeTagsAndInde
     checkDummyResponse("last", data, req, res, 3 /* expect +3 */, 1, "mediaDummy");
 }
 
+TEST_F(PythonFlowTest, OvTensorSharesMemoryWithPythonTensor) {
+    std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f};
+    std::unique_ptr<PyObjectWrapper<py::object>> pyTensor;
+    ASSERT_TRUE(getPythonBackend()->createOvmsPyTensor("input", data.data(), {2, 2}, "FP32", data.size() * sizeof(float), pyTensor));
+    py::gil_scoped_acquire acquire;
+    py::object pyObject = pyTensor->getObject();
+    const auto refCount = pyObject.ref_count();
+    ov::Tensor tensor = createOvTensorFromPyObject(pyObject, data.data(), ov::element::f32, {2, 2});
+    EXPECT_EQ(tensor.data(), data.data());
+    EXPECT_EQ(pyObject.ref_count(), refCount + 1);
+    tensor = ov::Tensor();
+    EXPECT_EQ(pyObject.ref_count(), refCount);
+}
+
+static void expectCopiedInCOrder(const py::object& array) {
+    OvmsPyTensor pyTensor("input", array.cast<py::buffer>(), std::nullopt, std::nullopt);
+    EXPECT_FALSE(pyTensor.isContiguous());
+    std::string copied(pyTensor.size, '\0');
+    pyTensor.copyToContiguous(copied.data());
+    const std::string expected = py::module_::import("numpy").attr("ascontiguousarray")(array).attr("tobytes")().cast<std::string>();
+    EXPECT_EQ(copied, expected);
+}
+
+TEST_F(PythonFlowTest, NonContiguousTransposedPythonTensorIsCopiedInCOrder) {
+    py::gil_scoped_acquire acquire;
+    py::module_ numpy = py::module_::import("numpy");
+    py::object array = numpy.attr("arange")(24, "dtype"_a = "float32").attr("reshape")(2, 3, 4).attr("transpose")(2, 0, 1);
+    expectCopiedInCOrder(array);
+}
+
+TEST_F(PythonFlowTest, NonContiguousNegativeStridePythonTensorIsCopiedInCOrder) {
+    py::gil_scoped_acquire acquire;
+    py::module_ numpy = py::module_::import("numpy");
+    py::object array = numpy.attr("arange")(12, "dtype"_a = "int32").attr("reshape")(3, 4);
+    // View with negative strides in both dimensions
+    expectCopiedInCOrder(numpy.attr("flip")(array));
+}
+
+TEST_F(PythonFlowTest, PythonTensorKeepsOvTensorAlive) {
+    auto tensor = std::make_shared<ov::Tensor>(ov::element::f32, ov::Shape{2, 2});
+    std::weak_ptr<ov::Tensor> weakTensor = tensor;
+    void* data = tensor->data();
+    std::unique_ptr<PyObjectWrapper<py::object>> pyTensor;
+    ASSERT_TRUE(getPythonBackend()->createOvmsPyTensor("output", data, {2, 2}, "FP32", tensor->get_byte_size(), std::move(tensor), pyTensor));
+    EXPECT_EQ(pyTensor->getProperty<void*>("ptr"), data);
+    EXPECT_FALSE(weakTensor.expired());
+    pyTensor.reset();
+    EXPECT_TRUE(weakTensor.expired());
+}
+
 TEST_F(PythonFlowTest, PythonCalculatorTestSingleInSingleOutTwoConvertersOnTheOutside) {
     ConstructorEnabledModelManager manager{"", getPythonBackend()};
     std::string testPbtxt = R"(
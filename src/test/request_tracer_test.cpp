@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "../request_tracer.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+class RequestTracerTest : public TestWithTempDir {
+protected:
+    std::string exportPath;
+
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        exportPath = directoryPath + "/trace.json";
+    }
+
+    // Exported file is not closed with bracket, so it is appended before parsing
+    void readEvents(rapidjson::Document& doc) {
+        std::ifstream file(exportPath);
+        std::stringstream content;
+        content << file.rdbuf();
+        std::string json = content.str();
+        auto lastComma = json.find_last_of(',');
+        if (lastComma != std::string::npos) {
+            json.erase(lastComma);
+        }
+        json += "]";
+        ASSERT_FALSE(doc.Parse(json.c_str()).HasParseError()) << json;
+        ASSERT_TRUE(doc.IsArray());
+    }
+};
+
+TEST_F(RequestTracerTest, EveryNthRequestIsSampled) {
+    RequestTracer tracer(3, exportPath);
+    int sampled = 0;
+    for (int i = 0; i < 9; i++) {
+        sampled += tracer.shouldSample(false);
+    }
+    EXPECT_EQ(sampled, 3);
+    EXPECT_TRUE(tracer.shouldSample(true));
+
+    RequestTracer disabled(0, exportPath);
+    EXPECT_FALSE(disabled.shouldSample(false));
+    EXPECT_TRUE(disabled.shouldSample(true));
+}
+
+TEST_F(RequestTracerTest, SpansOfSampledRequestsAreExported) {
+    RequestTracer tracer(2, exportPath);
+    ASSERT_TRUE(tracer.start());
+    EXPECT_FALSE(RequestTracer::isTracing());
+    for (int i = 0; i < 4; i++) {
+        RequestTraceScope scope("request", false);
+        OVMS_TRACE_SPAN("deserialization");
+        RequestTracer::recordSpan(std::string("node \"a\""), RequestTracer::nowNs(), RequestTracer::nowNs());
+    }
+    {
+        RequestTraceScope scope("tagged", true);
+        EXPECT_TRUE(RequestTracer::isTracing());
+        // Nested scope does not start new trace
+        RequestTraceScope nested("nested", false);
+    }
+    EXPECT_FALSE(RequestTracer::isTracing());
+    tracer.stop();
+
+    rapidjson::Document doc;
+    readEvents(doc);
+    // 2 of 4 sampled requests with 3 spans each and tagged request with nested span
+    ASSERT_EQ(doc.Size(), 8);
+    std::set<std::string> traceIds;
+    for (auto& event : doc.GetArray()) {
+        EXPECT_STREQ(event["ph"].GetString(), "X");
+        traceIds.insert(event["args"]["trace_id"].GetString());
+    }
+    EXPECT_EQ(traceIds.size(), 3);
+    EXPECT_STREQ(doc[1].GetObject()["name"].GetString(), "deserialization");
+    EXPECT_STREQ(doc[0].GetObject()["name"].GetString(), "node \"a\"");
+}
+
+TEST_F(RequestTracerTest, SpansOutsideOfSampledRequestAreNotRecorded) {
+    RequestTracer tracer(0, exportPath);
+    ASSERT_TRUE(tracer.start());
+    {
+        RequestTraceScope scope("request", false);
+        OVMS_TRACE_SPAN("inference");
+    }
+    std::thread([]() {
+        RequestTraceScope scope("other thread", true);
+    }).join();
+    tracer.stop();
+
+    rapidjson::Document doc;
+    readEvents(doc);
+    ASSERT_EQ(doc.Size(), 1);
+    EXPECT_STREQ(doc[0].GetObject()["name"].GetString(), "other thread");
+}
+
+TEST(TraceRingBuffer, SpansAreDroppedWhenFull) {
+    auto buffer = std::make_unique<TraceRingBuffer>(1);
+    for (size_t i = 0; i < TraceRingBuffer::CAPACITY; i++) {
+        ASSERT_TRUE(buffer->push(1, "span", 4, i, 1));
+    }
+    EXPECT_FALSE(buffer->push(1, "span", 4, 0, 1));
+    EXPECT_EQ(buffer->takeDroppedCount(), 1);
+    EXPECT_EQ(buffer->takeDroppedCount(), 0);
+    size_t drained = buffer->drain([](const TraceSpanRecord&) {});
+    EXPECT_EQ(drained, TraceRingBuffer::CAPACITY);
+    EXPECT_TRUE(buffer->empty());
+    EXPECT_TRUE(buffer->push(1, "span", 4, 0, 1));
+}
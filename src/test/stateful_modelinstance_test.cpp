@@ -89,6 +89,25 @@ static const char* modelStatefulConfig = R"(
     ]
 })";
 
+static const char* modelStatefulContinuousBatchingConfig = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy",
+                "target_device": "CPU",
+                "model_version_policy": {"latest": {"num_versions":1}},
+                "nireq": 100,
+                "stateful": true,
+                "continuous_batching": true,
+                "max_sequence_number": 1000,
+                "shape": {"b": "(-1,10) "}
+            }
+        }
+    ]
+})";
+
 constexpr const char* DUMMY_MODEL_INPUT_NAME = "b";
 class StatefulModelInstanceTempDir : public TestWithTempDir {
 public:
@@ -1144,6 +1163,85 @@ TEST_F(StatefulModelInstanceTempDir, loadModel) {
     EXPECT_EQ(modelInstance.getModelConfig().isLowLatencyTransformationUsed(), true);
 }
 
+TEST_F(StatefulModelInstanceTempDir, continuousBatchingRequiresDynamicBatch) {
+    ovms::GlobalSequencesViewer sequencesViewer;
+    ovms::StatefulModelInstance modelInstance(dummyModelName, modelVersion, *ieCore, nullptr, nullptr, &sequencesViewer);
+
+    ovms::ModelConfig config{
+        dummyModelName,
+        modelPath,     // base path
+        "CPU",         // target device
+        "1",           // batchsize
+        1,             // NIREQ
+        true,          // is stateful
+        true,          // idle sequence cleanup enabled
+        false,         // low latency transformation enabled
+        44,            // stateful sequence max number,
+        "",            // cache dir
+        modelVersion,  // version
+        modelPath,     // local path
+    };
+    config.setContinuousBatching(true);
+    auto status = modelInstance.loadModel(config);
+    EXPECT_EQ(status, ovms::StatusCode::INVALID_BATCH_DIMENSION) << status.string();
+    EXPECT_EQ(modelInstance.getContinuousBatchingScheduler(), nullptr);
+}
+
+TEST_F(StatefulModelInstanceTempDir, continuousBatchingConcurrentSequences) {
+    SetUpConfig(modelStatefulContinuousBatchingConfig);
+    ConstructorEnabledModelManager manager;
+    createConfigFileWithContent(ovmsConfig, configFilePath);
+    auto status = manager.loadConfig(configFilePath);
+    ASSERT_TRUE(status.ok());
+    auto modelInstance = manager.findModelInstance(dummyModelName);
+    auto statefulModelInstance = std::static_pointer_cast<ovms::StatefulModelInstance>(modelInstance);
+    auto scheduler = statefulModelInstance->getContinuousBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+
+    const uint64_t sequencesCount = 20;
+    const size_t stepsCount = 10;
+    std::atomic<size_t> failures{0};
+    std::vector<std::thread> threads;
+    for (uint64_t seqId = 1; seqId <= sequencesCount; seqId++) {
+        threads.emplace_back([&, seqId]() {
+            for (size_t step = 0; step < stepsCount; step++) {
+                std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, static_cast<float>(seqId * 100 + step));
+                tensorflow::serving::PredictRequest request;
+                preparePredictRequest(request, modelInput, data);
+                setRequestSequenceId(&request, seqId);
+                setRequestSequenceControl(&request, step == 0 ? ovms::SEQUENCE_START : (step == stepsCount - 1 ? ovms::SEQUENCE_END : ovms::NO_CONTROL_INPUT));
+                tensorflow::serving::PredictResponse response;
+                std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+                if (!modelInstance->infer(&request, &response, unloadGuard).ok() || !CheckSequenceIdResponse(response, seqId)) {
+                    failures++;
+                    continue;
+                }
+                // Each sequence has to receive its own row of batched output
+                const auto& content = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME).tensor_content();
+                if (content.size() != DUMMY_MODEL_INPUT_SIZE * sizeof(float)) {
+                    failures++;
+                    continue;
+                }
+                const float* output = reinterpret_cast<const float*>(content.data());
+                for (int i = 0; i < DUMMY_MODEL_INPUT_SIZE; i++) {
+                    if (output[i] != data[i] + 1) {
+                        failures++;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(statefulModelInstance->getSequenceManager()->getSequencesCount(), 0);
+    EXPECT_GT(scheduler->getIterationsCount(), 0);
+    EXPECT_LE(scheduler->getIterationsCount(), sequencesCount * stepsCount);
+    EXPECT_GE(scheduler->getMaxBatchSize(), 1);
+}
+
 TEST_F(StatefulModelInstanceInputValidation, positiveValidate) {
     std::shared_ptr<MockedValidateStatefulModelInstance> modelInstance = std::make_shared<MockedValidateStatefulModelInstance>("model", 1, *ieCore);
     uint64_t seqId = 1;
@@ -444,6 +444,65 @@ TYPED_TEST(NativeFileInputConversionTest, positive_range_resolution_matching_in_
     }
 }
 
+TYPED_TEST(NativeFileInputConversionTest, positive_image_preprocessing_reverse_channels) {
+    uint8_t rgb_expected_tensor[] = {0xed, 0x1b, 0x24};
+
+    ov::Tensor tensor;
+
+    ImagePreprocessing preprocessing;
+    preprocessing.reverseChannels = true;
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 1, 1, 3}, Layout{"NHWC"})->createCopyWithImagePreprocessing(preprocessing);
+
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(tensor.get_size(), 3);
+    uint8_t* ptr = static_cast<uint8_t*>(tensor.data());
+    EXPECT_EQ(std::equal(ptr, ptr + tensor.get_size(), rgb_expected_tensor), true);
+}
+
+TYPED_TEST(NativeFileInputConversionTest, positive_image_preprocessing_mean_scale) {
+    ov::Tensor tensor;
+
+    ImagePreprocessing preprocessing;
+    preprocessing.mean = {10.0f, 20.0f, 30.0f};
+    preprocessing.scale = {2.0f};
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{1, 1, 1, 3}, Layout{"NHWC"})->createCopyWithImagePreprocessing(preprocessing);
+
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(tensor.get_size(), 3);
+    float* ptr = static_cast<float*>(tensor.data());
+    EXPECT_FLOAT_EQ(ptr[0], (0x24 - 10.0f) / 2.0f);
+    EXPECT_FLOAT_EQ(ptr[1], (0x1b - 20.0f) / 2.0f);
+    EXPECT_FLOAT_EQ(ptr[2], (0xed - 30.0f) / 2.0f);
+}
+
+TYPED_TEST(NativeFileInputConversionTest, positive_image_preprocessing_nchw_layout) {
+    ov::Tensor tensor;
+
+    ImagePreprocessing preprocessing;
+    preprocessing.reverseChannels = true;
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{1, 3, 2, 2}, Layout{"NCHW"})->createCopyWithImagePreprocessing(preprocessing);
+
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(tensor.get_shape(), ov::Shape({1, 3, 2, 2}));
+    float* ptr = static_cast<float*>(tensor.data());
+    const float expectedPlanes[] = {0xed, 0x1b, 0x24};
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t i = 0; i < 4; i++) {
+            EXPECT_FLOAT_EQ(ptr[c * 4 + i], expectedPlanes[c]);
+        }
+    }
+}
+
+TYPED_TEST(NativeFileInputConversionTest, image_preprocessing_mean_number_of_channels_mismatch) {
+    ov::Tensor tensor;
+
+    ImagePreprocessing preprocessing;
+    preprocessing.mean = {1.0f, 2.0f};
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{1, 1, 1, 3}, Layout{"NHWC"})->createCopyWithImagePreprocessing(preprocessing);
+
+    EXPECT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::INVALID_NO_OF_CHANNELS);
+}
+
 class NativeFileInputConversionTFSPrecisionTest : public ::testing::TestWithParam<ovms::Precision> {
 protected:
     void SetUp() override {
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <tuple>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+
+#include "../dags/tensor_pool.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+TEST(TensorPool, ReleasedBufferIsReusedForSameShape) {
+    auto pool = std::make_shared<TensorPool>(1024);
+    void* data = nullptr;
+    {
+        ov::Tensor tensor;
+        ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {1, 10}), StatusCode::OK);
+        data = tensor.data();
+        EXPECT_EQ(pool->getHeldBytes(), 0);
+    }
+    EXPECT_EQ(pool->getHeldBytes(), 40);
+    ov::Tensor tensor;
+    ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {1, 10}), StatusCode::OK);
+    EXPECT_EQ(tensor.data(), data);
+    EXPECT_EQ(pool->getHeldBytes(), 0);
+    EXPECT_EQ(pool->getHits(), 1);
+    EXPECT_EQ(pool->getMisses(), 1);
+}
+
+TEST(TensorPool, BuffersAreKeyedByPrecisionAndShape) {
+    auto pool = std::make_shared<TensorPool>(1024);
+    {
+        ov::Tensor tensor;
+        ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {1, 10}), StatusCode::OK);
+    }
+    ov::Tensor otherShape, otherPrecision;
+    ASSERT_EQ(pool->createTensor(otherShape, ov::element::f32, {10, 1}), StatusCode::OK);
+    ASSERT_EQ(pool->createTensor(otherPrecision, ov::element::i32, {1, 10}), StatusCode::OK);
+    EXPECT_EQ(pool->getHits(), 0);
+    EXPECT_EQ(pool->getMisses(), 3);
+    EXPECT_EQ(pool->getHeldBytes(), 40);
+}
+
+TEST(TensorPool, LeastRecentlyReleasedBuffersAreFreedAboveLimit) {
+    auto pool = std::make_shared<TensorPool>(100);
+    {
+        ov::Tensor first, second, third;
+        ASSERT_EQ(pool->createTensor(first, ov::element::u8, {40}), StatusCode::OK);
+        ASSERT_EQ(pool->createTensor(second, ov::element::u8, {50}), StatusCode::OK);
+        ASSERT_EQ(pool->createTensor(third, ov::element::u8, {30}), StatusCode::OK);
+        first = ov::Tensor();
+        second = ov::Tensor();
+        EXPECT_EQ(pool->getHeldBytes(), 90);
+        third = ov::Tensor();
+        // first buffer is evicted to make place for the third one
+        EXPECT_EQ(pool->getHeldBytes(), 80);
+    }
+    ov::Tensor tensor;
+    ASSERT_EQ(pool->createTensor(tensor, ov::element::u8, {40}), StatusCode::OK);
+    EXPECT_EQ(pool->getHits(), 0);
+    ASSERT_EQ(pool->createTensor(tensor, ov::element::u8, {50}), StatusCode::OK);
+    EXPECT_EQ(pool->getHits(), 1);
+}
+
+TEST(TensorPool, BufferLargerThanLimitIsNotKept) {
+    auto pool = std::make_shared<TensorPool>(10);
+    {
+        ov::Tensor tensor;
+        ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {1, 10}), StatusCode::OK);
+    }
+    EXPECT_EQ(pool->getHeldBytes(), 0);
+}
+
+TEST(TensorPool, TensorsCanOutlivePoolOwner) {
+    auto pool = std::make_shared<TensorPool>(1024);
+    ov::Tensor tensor;
+    ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {2, 3}), StatusCode::OK);
+    std::weak_ptr<TensorPool> weakPool = pool;
+    pool.reset();
+    EXPECT_FALSE(weakPool.expired());
+    std::iota(tensor.data<float>(), tensor.data<float>() + tensor.get_size(), 0);
+    tensor = ov::Tensor();
+    EXPECT_TRUE(weakPool.expired());
+}
+
+TEST(TensorPool, ClonedTensorHasSourceContent) {
+    auto pool = std::make_shared<TensorPool>(1024);
+    ov::Tensor source(ov::element::i32, {2, 2});
+    std::iota(source.data<int32_t>(), source.data<int32_t>() + source.get_size(), 7);
+    ov::Tensor clone;
+    ASSERT_EQ(pool->cloneTensor(clone, source), StatusCode::OK);
+    EXPECT_NE(clone.data(), source.data());
+    EXPECT_EQ(clone.get_shape(), source.get_shape());
+    EXPECT_EQ(std::memcmp(clone.data(), source.data(), source.get_byte_size()), 0);
+}
+
+TEST(TensorPool, StringTensorsAreNotPooled) {
+    auto pool = std::make_shared<TensorPool>(1024);
+    {
+        ov::Tensor tensor;
+        ASSERT_EQ(pool->createTensor(tensor, ov::element::string, {2}), StatusCode::OK);
+        tensor.data<std::string>()[0] = "abc";
+    }
+    EXPECT_EQ(pool->getMisses(), 0);
+    EXPECT_EQ(pool->getHeldBytes(), 0);
+}
+
+TEST(TensorPool, StatisticsAreCollectedSincePreviousCall) {
+    auto pool = std::make_shared<TensorPool>(1024);
+    for (int i = 0; i < 3; ++i) {
+        ov::Tensor tensor;
+        ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {4}), StatusCode::OK);
+    }
+    auto [hits, misses] = pool->collectStatistics();
+    EXPECT_EQ(hits, 2);
+    EXPECT_EQ(misses, 1);
+    ov::Tensor tensor;
+    ASSERT_EQ(pool->createTensor(tensor, ov::element::f32, {4}), StatusCode::OK);
+    std::tie(hits, misses) = pool->collectStatistics();
+    EXPECT_EQ(hits, 1);
+    EXPECT_EQ(misses, 0);
+}
@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tracingmodule.hpp"
+
+#include <memory>
+
+#include "config.hpp"
+#include "logging.hpp"
+#include "module_names.hpp"
+#include "request_tracer.hpp"
+#include "status.hpp"
+
+namespace ovms {
+TracingModule::TracingModule() = default;
+
+Status TracingModule::start(const Config& config) {
+    state = ModuleState::STARTED_INITIALIZE;
+    SPDLOG_INFO("{} starting", TRACING_MODULE_NAME);
+    this->tracer = std::make_unique<RequestTracer>(config.traceSampleRate(), config.traceExportPath());
+    if (!this->tracer->start()) {
+        SPDLOG_ERROR("Cannot open file for request tracing, --trace_export_path: {}", config.traceExportPath());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    state = ModuleState::INITIALIZED;
+    SPDLOG_INFO("{} started", TRACING_MODULE_NAME);
+    return StatusCode::OK;
+}
+
+void TracingModule::shutdown() {
+    if (state == ModuleState::SHUTDOWN)
+        return;
+    state = ModuleState::STARTED_SHUTDOWN;
+    SPDLOG_INFO("{} shutting down", TRACING_MODULE_NAME);
+    tracer.reset();
+    state = ModuleState::SHUTDOWN;
+    SPDLOG_INFO("{} shutdown", TRACING_MODULE_NAME);
+}
+
+TracingModule::~TracingModule() {
+    this->shutdown();
+}
+}  // namespace ovms